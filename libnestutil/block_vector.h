@@ -254,6 +254,13 @@ public:
    */
   size_t size() const;
 
+  /**
+   * Returns the number of elements for which storage is allocated.
+   *
+   * Storage is allocated in blocks of max_block_size elements.
+   */
+  size_t capacity() const;
+
   /**
    * @brief Remove a range of elements.
    * @param first Iterator pointing to the first element to be erased.
@@ -451,6 +458,18 @@ BlockVector< value_type_ >::clear()
   finish_ = begin();
 }
 
+template < typename value_type_ >
+inline size_t
+BlockVector< value_type_ >::capacity() const
+{
+  size_t capacity = 0;
+  for ( const auto& block : blockmap_ )
+  {
+    capacity += block.capacity();
+  }
+  return capacity;
+}
+
 template < typename value_type_ >
 inline size_t
 BlockVector< value_type_ >::size() const
@@ -0,0 +1,270 @@
+/*
+ *  rkf45_integrator.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RKF45_INTEGRATOR_H
+#define RKF45_INTEGRATOR_H
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace nest
+{
+
+/**
+ * Coefficients and step size control of the Runge-Kutta-Fehlberg 4(5) method.
+ *
+ * Steps and step size control follow gsl_odeiv_step_rkf45 with the standard
+ * control of gsl_odeiv_control_standard_new(), so that models integrated with
+ * RKF45Integrator behave as with gsl_odeiv_evolve_apply().
+ */
+namespace rkf45
+{
+constexpr double ah[] = { 1.0 / 4.0, 3.0 / 8.0, 12.0 / 13.0, 1.0, 1.0 / 2.0 };
+constexpr double b3[] = { 3.0 / 32.0, 9.0 / 32.0 };
+constexpr double b4[] = { 1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0 };
+constexpr double b5[] = { 8341.0 / 4104.0, -32832.0 / 4104.0, 29440.0 / 4104.0, -845.0 / 4104.0 };
+constexpr double b6[] = {
+  -6080.0 / 20520.0, 41040.0 / 20520.0, -28352.0 / 20520.0, 9295.0 / 20520.0, -5643.0 / 20520.0
+};
+
+constexpr double c1 = 902880.0 / 7618050.0;
+constexpr double c3 = 3953664.0 / 7618050.0;
+constexpr double c4 = 3855735.0 / 7618050.0;
+constexpr double c5 = -1371249.0 / 7618050.0;
+constexpr double c6 = 277020.0 / 7618050.0;
+
+//! Differences of fifth and fourth order coefficients for the error estimate
+constexpr double ec[] = { 0.0, 1.0 / 360.0, 0.0, -128.0 / 4275.0, -2197.0 / 75240.0, 1.0 / 50.0, 2.0 / 55.0 };
+
+//! Order of the method used for step size control
+constexpr double ORDER = 5.0;
+
+/**
+ * Admissible local error of each state variable.
+ *
+ * The error of state variable i is admissible if it is at most
+ * eps_abs + eps_rel * ( a_y * |y_i| + a_dydt * h * |dy_i/dt| ).
+ */
+struct ErrorControl
+{
+  double eps_abs;
+  double eps_rel;
+  double a_y;
+  double a_dydt;
+};
+
+/**
+ * Return ratio of largest error to admissible error, for a step of size h.
+ *
+ * dydt is only read if control.a_dydt is not zero.
+ */
+template < size_t N >
+inline double
+max_error_ratio( const ErrorControl& control,
+  const double h,
+  const double y[],
+  const double y_err[],
+  const double dydt[] )
+{
+  double rmax = std::numeric_limits< double >::min();
+  for ( size_t i = 0; i < N; ++i )
+  {
+    const double scale = control.a_dydt == 0.0
+      ? control.a_y * std::fabs( y[ i ] )
+      : control.a_y * std::fabs( y[ i ] ) + control.a_dydt * std::fabs( h * dydt[ i ] );
+    const double r = std::fabs( y_err[ i ] ) / std::fabs( control.eps_rel * scale + control.eps_abs );
+    if ( r > rmax )
+    {
+      rmax = r;
+    }
+  }
+  return rmax;
+}
+
+/**
+ * Adjust step size h from the error ratio of a step of size h.
+ *
+ * @returns true if the step size was decreased and the step must be repeated
+ */
+inline bool
+adjust_step_size( const double rmax, double& h )
+{
+  const double S = 0.9;  // safety factor
+  if ( rmax > 1.1 )
+  {
+    // decrease by no more than a factor of 5, but a fraction S more than scaling suggests
+    h *= std::max( S / std::pow( rmax, 1.0 / ORDER ), 0.2 );
+    return true;
+  }
+  if ( rmax < 0.5 )
+  {
+    // increase by no more than a factor of 5, never decrease because of S < 1
+    h *= std::min( std::max( S / std::pow( rmax, 1.0 / ( ORDER + 1.0 ) ), 1.0 ), 5.0 );
+  }
+  return false;
+}
+
+}  // namespace rkf45
+
+/**
+ * Adaptive Runge-Kutta-Fehlberg 4(5) integrator for systems of N ordinary differential equations.
+ *
+ * The integrator replaces the GSL stepping, control and evolution objects of
+ * a model. It is templated on the right-hand side of the system, which the
+ * compiler can thus inline, and does not allocate memory. The right-hand side
+ * is a callable dynamics( const double y[], double dydt[] ); inputs to the
+ * system are taken to be constant during a step of the integrator.
+ *
+ * It is used by aeif_cond_alpha, aeif_cond_exp, iaf_cond_alpha and
+ * iaf_cond_exp, all other models with ODE solvers still use the GSL.
+ */
+template < size_t N >
+class RKF45Integrator
+{
+public:
+  RKF45Integrator()
+    : control_( { 0.0, 0.0, 1.0, 0.0 } )
+  {
+  }
+
+  /**
+   * Set the admissible local error, see rkf45::ErrorControl.
+   *
+   * Equivalent to gsl_odeiv_control_y_new( eps_abs, eps_rel ) for a_y = 1, a_dydt = 0
+   * and to gsl_odeiv_control_yp_new( eps_abs, eps_rel ) for a_y = 0, a_dydt = 1.
+   */
+  void
+  set_error_control( const double eps_abs, const double eps_rel, const double a_y, const double a_dydt )
+  {
+    control_ = { eps_abs, eps_rel, a_y, a_dydt };
+  }
+
+  /**
+   * Perform a single integration step from t, bounded by t1.
+   *
+   * The step is repeated with smaller step size until its error is
+   * admissible. On return, y holds the new state, t the time reached and h
+   * the step size proposed for the next step. If h exceeds t1 - t, the step
+   * is shortened to end at t1 and the next step size is proposed based on
+   * the shortened step, as gsl_odeiv_evolve_apply() does.
+   */
+  template < typename Dynamics >
+  void evolve( const Dynamics& dynamics, double& t, const double t1, double& h, double y[] ) const;
+
+private:
+  rkf45::ErrorControl control_;
+};
+
+template < size_t N >
+template < typename Dynamics >
+void
+RKF45Integrator< N >::evolve( const Dynamics& dynamics, double& t, const double t1, double& h, double y[] ) const
+{
+  using namespace rkf45;
+
+  assert( h > 0.0 and t < t1 );
+
+  const double t0 = t;
+  const double dt = t1 - t0;
+  double h0 = h;
+
+  double k1[ N ], k2[ N ], k3[ N ], k4[ N ], k5[ N ], k6[ N ];
+  double y_tmp[ N ], y_new[ N ], y_err[ N ], dydt_out[ N ];
+
+  // the derivative at the start is the same for all attempts
+  dynamics( y, k1 );
+
+  while ( true )
+  {
+    const bool final_step = h0 > dt;
+    if ( final_step )
+    {
+      h0 = dt;
+    }
+
+    for ( size_t i = 0; i < N; ++i )
+    {
+      y_tmp[ i ] = y[ i ] + ah[ 0 ] * h0 * k1[ i ];
+    }
+    dynamics( y_tmp, k2 );
+    for ( size_t i = 0; i < N; ++i )
+    {
+      y_tmp[ i ] = y[ i ] + h0 * ( b3[ 0 ] * k1[ i ] + b3[ 1 ] * k2[ i ] );
+    }
+    dynamics( y_tmp, k3 );
+    for ( size_t i = 0; i < N; ++i )
+    {
+      y_tmp[ i ] = y[ i ] + h0 * ( b4[ 0 ] * k1[ i ] + b4[ 1 ] * k2[ i ] + b4[ 2 ] * k3[ i ] );
+    }
+    dynamics( y_tmp, k4 );
+    for ( size_t i = 0; i < N; ++i )
+    {
+      y_tmp[ i ] = y[ i ] + h0 * ( b5[ 0 ] * k1[ i ] + b5[ 1 ] * k2[ i ] + b5[ 2 ] * k3[ i ] + b5[ 3 ] * k4[ i ] );
+    }
+    dynamics( y_tmp, k5 );
+    for ( size_t i = 0; i < N; ++i )
+    {
+      y_tmp[ i ] = y[ i ]
+        + h0 * ( b6[ 0 ] * k1[ i ] + b6[ 1 ] * k2[ i ] + b6[ 2 ] * k3[ i ] + b6[ 3 ] * k4[ i ] + b6[ 4 ] * k5[ i ] );
+    }
+    dynamics( y_tmp, k6 );
+
+    for ( size_t i = 0; i < N; ++i )
+    {
+      y_new[ i ] = y[ i ] + h0 * ( c1 * k1[ i ] + c3 * k3[ i ] + c4 * k4[ i ] + c5 * k5[ i ] + c6 * k6[ i ] );
+      y_err[ i ] =
+        h0 * ( ec[ 1 ] * k1[ i ] + ec[ 3 ] * k3[ i ] + ec[ 4 ] * k4[ i ] + ec[ 5 ] * k5[ i ] + ec[ 6 ] * k6[ i ] );
+    }
+    if ( control_.a_dydt != 0.0 )
+    {
+      dynamics( y_new, dydt_out );
+    }
+
+    t = final_step ? t1 : t0 + h0;
+
+    // repeat step if the step size was decreased by at least one ulp of t
+    const double h_old = h0;
+    if ( adjust_step_size( max_error_ratio< N >( control_, h_old, y_new, y_err, dydt_out ), h0 ) )
+    {
+      if ( h0 < h_old and t + h0 != t )
+      {
+        continue;
+      }
+      h0 = h_old;
+    }
+    break;
+  }
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    y[ i ] = y_new[ i ];
+  }
+  h = h0;
+}
+
+}  // namespace nest
+
+#endif /* RKF45_INTEGRATOR_H */
@@ -24,7 +24,13 @@
 #define SORT_H
 
 #include <algorithm>
+#include <array>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 // Generated includes:
@@ -32,143 +38,355 @@
 
 #include "block_vector.h"
 
-#ifdef HAVE_BOOST
-#include "iterator_pair.h"
-#include <boost/sort/spreadsort/spreadsort.hpp>
+#ifdef _OPENMP
+#include <omp.h>
 #endif
 
-#define INSERTION_SORT_CUTOFF 10  // use insertion sort for smaller arrays
+#define RADIX_SORT_CUTOFF 64          // use comparison sort for smaller arrays in radix_sort
+#define RADIX_SORT_BITS 11            // bits per pass of radix_sort and radix_sort_in_team
+#define RADIX_SORT_TEAM_CUTOFF 65536  // smallest array worth sorting with radix_sort_in_team
 
 namespace nest
 {
 /**
- * Calculates the median of three elements.
- * See http://algs4.cs.princeton.edu/23quicksort/QuickX.java.html.
+ * Returns the radix sort key of an integral value.
+ *
+ * Keys of other types are provided by overloads of sort_key() in the
+ * namespace of the type, which are found by argument-dependent lookup.
+ * The keys alone define the order in which radix_sort() arranges elements,
+ * which need not be the order given by operator<. Source, for example,
+ * places disabled sources after all others.
  */
-template < typename T >
-inline size_t
-median3_( const BlockVector< T >& vec, const size_t i, const size_t j, const size_t k )
+template < typename T, typename std::enable_if< std::is_integral< T >::value, int >::type = 0 >
+inline uint64_t
+sort_key( const T value )
 {
-  return ( ( vec[ i ] < vec[ j ] ) ? ( ( vec[ j ] < vec[ k ] )     ? j
-                                         : ( vec[ i ] < vec[ k ] ) ? k
-                                                                   : i )
-                                   : ( ( vec[ k ] < vec[ j ] )     ? j
-                                         : ( vec[ k ] < vec[ i ] ) ? k
-                                                                   : i ) );
+  if constexpr ( std::is_signed< T >::value )
+  {
+    // flip the sign bit so that negative values precede positive ones
+    return static_cast< uint64_t >( static_cast< int64_t >( value ) ) ^ ( uint64_t( 1 ) << 63 );
+  }
+  else
+  {
+    return static_cast< uint64_t >( value );
+  }
 }
 
 /**
- * Insertion sort, adapted from Sedgewick & Wayne
- * (2011), Algorithms 4th edition, p251ff.
- * Sorts the two vectors vec_sort and vec_perm, by sorting the
- * entries in vec_sort and applying the same exchanges to
- * vec_perm.
+ * Reorders the two vectors vec_sort and vec_perm in place so that the
+ * element at position i is the one previously at position perm[ i ].
+ *
+ * Each element is moved exactly once by following the cycles of the
+ * permutation, so no copies of the vectors are needed. perm is reset to
+ * the identity on return.
  */
-template < typename T1, typename T2 >
+template < typename T1, typename T2, typename IndexT >
 void
-insertion_sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm, const size_t lo, const size_t hi )
+apply_permutation( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm, std::vector< IndexT >& perm )
 {
-  for ( size_t i = lo + 1; i < hi + 1; ++i )
+  for ( size_t i = 0; i < perm.size(); ++i )
   {
-    for ( size_t j = i; j > lo and ( vec_sort[ j ] < vec_sort[ j - 1 ] ); --j )
+    if ( perm[ i ] == i )
+    {
+      continue;
+    }
+
+    T1 tmp_sort = std::move( vec_sort[ i ] );
+    T2 tmp_perm = std::move( vec_perm[ i ] );
+    size_t j = i;
+    while ( perm[ j ] != i )
     {
-      std::swap( vec_sort[ j ], vec_sort[ j - 1 ] );
-      std::swap( vec_perm[ j ], vec_perm[ j - 1 ] );
+      const size_t k = perm[ j ];
+      vec_sort[ j ] = std::move( vec_sort[ k ] );
+      vec_perm[ j ] = std::move( vec_perm[ k ] );
+      perm[ j ] = j;
+      j = k;
     }
+    vec_sort[ j ] = std::move( tmp_sort );
+    vec_perm[ j ] = std::move( tmp_perm );
+    perm[ j ] = j;
   }
 }
 
 /**
- * Quicksort with 3-way partitioning, adapted from Sedgewick & Wayne
- * (2011), Algorithms 4th edition, p296ff
- * (see http://algs4.cs.princeton.edu/23quicksort/QuickX.java.html).
+ * Implementation of radix_sort() with positions of type IndexT, which
+ * must be able to represent all positions in vec_sort.
  *
- * Recursively sorts the two vectors vec_sort and vec_perm, by
- * sorting the entries in vec_sort and applying the same exchanges
- * to vec_perm.
+ * Keys and positions are kept in separate arrays, so that the positions
+ * left after the last pass are the permutation handed to
+ * apply_permutation(). The scatter buffers are only allocated if at least
+ * one pass is needed and are released before the permutation is applied.
  */
-template < typename T1, typename T2 >
+template < typename IndexT, typename T1, typename T2 >
 void
-quicksort3way( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm, const size_t lo, const size_t hi )
+radix_sort_( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
 {
-  if ( lo >= hi )
+  constexpr unsigned int radix_bits = RADIX_SORT_BITS;
+  constexpr size_t num_buckets = size_t( 1 ) << radix_bits;
+  constexpr uint64_t digit_mask = num_buckets - 1;
+
+  const size_t n = vec_sort.size();
+
+  std::vector< uint64_t > keys( n );
+  std::vector< IndexT > indices( n );
+  uint64_t all_bits = 0;
+  size_t i = 0;
+  for ( const auto& element : vec_sort )
   {
-    return;
+    keys[ i ] = sort_key( element );
+    indices[ i ] = static_cast< IndexT >( i );
+    all_bits |= keys[ i ];
+    ++i;
+  }
+
+  if ( n <= RADIX_SORT_CUTOFF )
+  {
+    std::stable_sort( indices.begin(),
+      indices.end(),
+      [ &keys ]( const IndexT lhs, const IndexT rhs ) { return keys[ lhs ] < keys[ rhs ]; } );
+    all_bits = 0;  // skip the radix passes
+  }
+
+  std::vector< uint64_t > key_buffer;
+  std::vector< IndexT > index_buffer;
+  std::array< size_t, num_buckets > offsets;
+  for ( unsigned int shift = 0; shift < 64 and ( all_bits >> shift ) != 0; shift += radix_bits )
+  {
+    offsets.fill( 0 );
+    for ( const uint64_t key : keys )
+    {
+      ++offsets[ ( key >> shift ) & digit_mask ];
+    }
+
+    // all keys have the same digit, the pass would not change the order
+    if ( offsets[ ( keys[ 0 ] >> shift ) & digit_mask ] == n )
+    {
+      continue;
+    }
+
+    size_t sum = 0;
+    for ( auto& offset : offsets )
+    {
+      const size_t count = offset;
+      offset = sum;
+      sum += count;
+    }
+
+    key_buffer.resize( n );
+    index_buffer.resize( n );
+    for ( size_t j = 0; j < n; ++j )
+    {
+      const size_t pos = offsets[ ( keys[ j ] >> shift ) & digit_mask ]++;
+      key_buffer[ pos ] = keys[ j ];
+      index_buffer[ pos ] = indices[ j ];
+    }
+    keys.swap( key_buffer );
+    indices.swap( index_buffer );
   }
+  std::vector< uint64_t >().swap( keys );
+  std::vector< uint64_t >().swap( key_buffer );
+  std::vector< IndexT >().swap( index_buffer );
 
-  const size_t n = hi - lo + 1;
+  apply_permutation( vec_sort, vec_perm, indices );
+}
 
-  // switch to insertion sort for small arrays
-  if ( n <= INSERTION_SORT_CUTOFF )
+/**
+ * Stable LSD radix sort of the two vectors vec_sort and vec_perm by the
+ * keys sort_key() of the entries in vec_sort.
+ *
+ * Keys are sorted in passes of 11 bits together with the original
+ * positions of the entries, or by std::stable_sort for short vectors.
+ * Passes in which all keys have the same digit are skipped, so that sorting node IDs typically takes two or three
+ * passes. The resulting permutation is then applied to both vectors in
+ * place, see apply_permutation().
+ *
+ * Positions are stored as 32-bit integers whenever the vectors are short
+ * enough, so that the transient memory is 24 bytes per entry during the
+ * passes and 4 bytes per entry while the permutation is applied.
+ */
+template < typename T1, typename T2 >
+void
+radix_sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
+{
+  const size_t n = vec_sort.size();
+  if ( n < 2 )
   {
-    insertion_sort( vec_sort, vec_perm, lo, hi );
     return;
   }
 
-  // use median-of-3 as partitioning element
-  size_t m = median3_(
-    vec_sort, lo + std::rand() % ( hi - lo ), lo + std::rand() % ( hi - lo ), lo + std::rand() % ( hi - lo ) );
+  if ( n <= std::numeric_limits< uint32_t >::max() )
+  {
+    radix_sort_< uint32_t >( vec_sort, vec_perm );
+  }
+  else
+  {
+    radix_sort_< size_t >( vec_sort, vec_perm );
+  }
+}
+
+/**
+ * Arrays shared by the threads that sort together in radix_sort_in_team().
+ *
+ * One object has to be provided for the whole team. It keeps its
+ * capacity between sorts until release() is called.
+ */
+struct RadixSortTeamBuffers
+{
+  std::vector< uint64_t > keys;
+  std::vector< uint64_t > key_buffer;
+  std::vector< uint32_t > indices;
+  std::vector< uint32_t > index_buffer;
 
-  // in case of many equal entries, make sure to use first entry with
-  // this value (useful for sorted arrays)
-  const T1 m_val = vec_sort[ m ];
-  while ( m > 0 and vec_sort[ m - 1 ] == m_val )
+  //! Digit counts of the chunk of each thread, turned into its scatter offsets
+  std::vector< std::array< size_t, size_t( 1 ) << RADIX_SORT_BITS > > offsets;
+
+  //! Bits set in any key
+  uint64_t all_bits = 0;
+
+  //! Whether all keys have the same digit in the current pass
+  bool skip_pass = false;
+
+  void
+  release()
   {
-    --m;
+    std::vector< uint64_t >().swap( keys );
+    std::vector< uint64_t >().swap( key_buffer );
+    std::vector< uint32_t >().swap( indices );
+    std::vector< uint32_t >().swap( index_buffer );
   }
+};
 
-  // move pivot to the front
-  std::swap( vec_sort[ m ], vec_sort[ lo ] );
-  std::swap( vec_perm[ m ], vec_perm[ lo ] );
+/**
+ * Sort vec_sort and vec_perm as radix_sort(), sharing the radix passes
+ * among all threads of the enclosing parallel region.
+ *
+ * Must be called by all threads of the team with the same arguments.
+ * Each thread computes the keys of one contiguous chunk and counts its
+ * digits per pass. A prefix sum over the digits and, within each digit,
+ * over the chunks in order yields the scatter offsets of each thread, so
+ * that the threads scatter their chunks independently and the sort stays
+ * stable. Only the thread owner then applies the permutation to the
+ * vectors, while the others wait at the final barrier.
+ *
+ * The shared arrays are allocated by one thread. This does not matter for
+ * first-touch placement, as the scatter passes access them at positions
+ * given by the keys, which are not local to any thread. The vectors
+ * themselves are only modified by owner, and only by moving elements
+ * within their existing blocks, so their placement by the thread that
+ * created them is kept.
+ */
+template < typename T1, typename T2 >
+void
+radix_sort_in_team( BlockVector< T1 >& vec_sort,
+  BlockVector< T2 >& vec_perm,
+  const size_t owner,
+  RadixSortTeamBuffers& team )
+{
+  constexpr unsigned int radix_bits = RADIX_SORT_BITS;
+  constexpr size_t num_buckets = size_t( 1 ) << radix_bits;
+  constexpr uint64_t digit_mask = num_buckets - 1;
 
-  // Dijkstra's three-way-sort
-  size_t lt = lo;
-  size_t i = lo + 1;
-  size_t gt = hi;
-  const T1 v = vec_sort[ lt ];  // pivot
+#ifdef _OPENMP
+  const size_t num_threads = omp_get_num_threads();
+  const size_t thread = omp_get_thread_num();
+#else
+  const size_t num_threads = 1;
+  const size_t thread = 0;
+#endif
+  assert( owner < num_threads );
 
-  // adjust position of i and lt (useful for sorted arrays)
-  while ( vec_sort[ i ] < v and i < vec_sort.size() - 1 )
+  const size_t n = vec_sort.size();
+  if ( n <= RADIX_SORT_CUTOFF or n > std::numeric_limits< uint32_t >::max() )
   {
-    ++i;
+    if ( thread == owner )
+    {
+      radix_sort( vec_sort, vec_perm );
+    }
+#pragma omp barrier
+    return;
   }
-  std::swap( vec_sort[ lo ], vec_sort[ i - 1 ] );
-  std::swap( vec_perm[ lo ], vec_perm[ i - 1 ] );
-  lt = i - 1;
 
-  // adjust position of gt (useful for sorted arrays)
-  while ( vec_sort[ gt ] > v and gt > 0 )
+#pragma omp single
   {
-    --gt;
+    team.keys.resize( n );
+    team.key_buffer.resize( n );
+    team.indices.resize( n );
+    team.index_buffer.resize( n );
+    team.offsets.resize( num_threads );
+    team.all_bits = 0;
+  }  // implicit barrier
+
+  const size_t begin = n * thread / num_threads;
+  const size_t end = n * ( thread + 1 ) / num_threads;
+
+  uint64_t all_bits = 0;
+  for ( size_t i = begin; i < end; ++i )
+  {
+    team.keys[ i ] = sort_key( vec_sort[ i ] );
+    team.indices[ i ] = static_cast< uint32_t >( i );
+    all_bits |= team.keys[ i ];
   }
+#pragma omp atomic
+  team.all_bits |= all_bits;
+#pragma omp barrier
 
-  while ( i <= gt )
+  auto& offsets = team.offsets[ thread ];
+  for ( unsigned int shift = 0; shift < 64 and ( team.all_bits >> shift ) != 0; shift += radix_bits )
   {
-    if ( vec_sort[ i ] < v )
+    offsets.fill( 0 );
+    for ( size_t i = begin; i < end; ++i )
     {
-      std::swap( vec_sort[ lt ], vec_sort[ i ] );
-      std::swap( vec_perm[ lt ], vec_perm[ i ] );
-      ++lt;
-      ++i;
+      ++offsets[ ( team.keys[ i ] >> shift ) & digit_mask ];
     }
-    else if ( vec_sort[ i ] > v )
+#pragma omp barrier
+
+#pragma omp single
     {
-      std::swap( vec_sort[ i ], vec_sort[ gt ] );
-      std::swap( vec_perm[ i ], vec_perm[ gt ] );
-      --gt;
+      team.skip_pass = false;
+      size_t sum = 0;
+      for ( size_t digit = 0; digit < num_buckets; ++digit )
+      {
+        const size_t digit_begin = sum;
+        for ( auto& thread_offsets : team.offsets )
+        {
+          const size_t count = thread_offsets[ digit ];
+          thread_offsets[ digit ] = sum;
+          sum += count;
+        }
+        // all keys have the same digit, the pass would not change the order
+        team.skip_pass = team.skip_pass or sum - digit_begin == n;
+      }
+    }  // implicit barrier
+
+    if ( team.skip_pass )
+    {
+      continue;
     }
-    else
+
+    for ( size_t i = begin; i < end; ++i )
     {
-      ++i;
+      const size_t pos = offsets[ ( team.keys[ i ] >> shift ) & digit_mask ]++;
+      team.key_buffer[ pos ] = team.keys[ i ];
+      team.index_buffer[ pos ] = team.indices[ i ];
     }
+#pragma omp barrier
+
+#pragma omp single
+    {
+      team.keys.swap( team.key_buffer );
+      team.indices.swap( team.index_buffer );
+    }  // implicit barrier
   }
 
-  quicksort3way( vec_sort, vec_perm, lo, lt - 1 );
-  quicksort3way( vec_sort, vec_perm, gt + 1, hi );
+  if ( thread == owner )
+  {
+    apply_permutation( vec_sort, vec_perm, team.indices );
+  }
+#pragma omp barrier
 }
 
 /**
- * Sorts two vectors according to elements in
+ * Sorts two vectors according to the sort keys of the elements in the
  * first vector. Convenience function.
  */
 
@@ -176,13 +394,7 @@ template < typename T1, typename T2 >
 void
 sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
 {
-#ifdef HAVE_BOOST
-  boost::sort::spreadsort::integer_sort( make_iterator_pair( vec_sort.begin(), vec_perm.begin() ),
-    make_iterator_pair( vec_sort.end(), vec_perm.end() ),
-    rightshift_iterator_pair() );
-#else
-  quicksort3way( vec_sort, vec_perm, 0, vec_sort.size() - 1 );
-#endif
+  radix_sort( vec_sort, vec_perm );
 }
 
 }  // namespace sort
@@ -47,6 +47,30 @@ grow( std::vector< T >& v )
   }
 }
 
+/**
+ * Return number of bytes allocated by vector, excluding the vector object itself.
+ *
+ * For nested vectors, the memory allocated by the inner vectors is included.
+ */
+template < typename T >
+inline size_t
+memory_size( const std::vector< T >& v )
+{
+  return v.capacity() * sizeof( T );
+}
+
+template < typename T >
+inline size_t
+memory_size( const std::vector< std::vector< T > >& v )
+{
+  size_t bytes = v.capacity() * sizeof( std::vector< T > );
+  for ( const auto& inner : v )
+  {
+    bytes += memory_size( inner );
+  }
+  return bytes;
+}
+
 }  // namespace vector_util
 
 #endif  // VECTOR_UTIL_H
@@ -22,8 +22,6 @@
 
 #include "aeif_cond_alpha.h"
 
-#ifdef HAVE_GSL
-
 // C++ includes:
 #include <cmath>
 #include <cstdio>
@@ -70,20 +68,16 @@ RecordablesMap< aeif_cond_alpha >::create()
 }
 }
 
-extern "C" int
-nest::aeif_cond_alpha_dynamics( double, const double y[], double f[], void* pnode )
+inline void
+nest::aeif_cond_alpha::dynamics_( const double y[], double f[] ) const
 {
   // a shorthand
   typedef nest::aeif_cond_alpha::State_ S;
 
-  // get access to node so we can almost work as in a member function
-  assert( pnode );
-  const nest::aeif_cond_alpha& node = *( reinterpret_cast< nest::aeif_cond_alpha* >( pnode ) );
-
-  const bool is_refractory = node.S_.r_ > 0;
+  const bool is_refractory = S_.r_ > 0;
 
   // y[] here is---and must be---the state vector supplied by the integrator,
-  // not the state vector in the node, node.S_.y[].
+  // not the state vector in the node, S_.y[].
 
   // The following code is verbose for the sake of clarity. We assume that a
   // good compiler will optimize the verbosity away ...
@@ -91,7 +85,7 @@ nest::aeif_cond_alpha_dynamics( double, const double y[], double f[], void* pnod
   // Clamp membrane potential to V_reset while refractory, otherwise bound
   // it to V_peak. Do not use V_.V_peak_ here, since that is set to V_th if
   // Delta_T == 0.
-  const double& V = is_refractory ? node.P_.V_reset_ : std::min( y[ S::V_M ], node.P_.V_peak_ );
+  const double& V = is_refractory ? P_.V_reset_ : std::min( y[ S::V_M ], P_.V_peak_ );
   // shorthand for the other state variables
   const double& dg_ex = y[ S::DG_EXC ];
   const double& g_ex = y[ S::G_EXC ];
@@ -99,30 +93,26 @@ nest::aeif_cond_alpha_dynamics( double, const double y[], double f[], void* pnod
   const double& g_in = y[ S::G_INH ];
   const double& w = y[ S::W ];
 
-  const double I_syn_exc = g_ex * ( V - node.P_.E_ex );
-  const double I_syn_inh = g_in * ( V - node.P_.E_in );
+  const double I_syn_exc = g_ex * ( V - P_.E_ex );
+  const double I_syn_inh = g_in * ( V - P_.E_in );
 
-  const double I_spike =
-    node.P_.Delta_T == 0. ? 0. : ( node.P_.g_L * node.P_.Delta_T * std::exp( ( V - node.P_.V_th ) / node.P_.Delta_T ) );
+  const double I_spike = P_.Delta_T == 0. ? 0. : ( P_.g_L * P_.Delta_T * std::exp( ( V - P_.V_th ) / P_.Delta_T ) );
 
   // dv/dt
   f[ S::V_M ] = is_refractory
     ? 0.
-    : ( -node.P_.g_L * ( V - node.P_.E_L ) + I_spike - I_syn_exc - I_syn_inh - w + node.P_.I_e + node.B_.I_stim_ )
-      / node.P_.C_m;
+    : ( -P_.g_L * ( V - P_.E_L ) + I_spike - I_syn_exc - I_syn_inh - w + P_.I_e + B_.I_stim_ ) / P_.C_m;
 
-  f[ S::DG_EXC ] = -dg_ex / node.P_.tau_syn_ex;
+  f[ S::DG_EXC ] = -dg_ex / P_.tau_syn_ex;
   // Synaptic Conductance (nS)
-  f[ S::G_EXC ] = dg_ex - g_ex / node.P_.tau_syn_ex;
+  f[ S::G_EXC ] = dg_ex - g_ex / P_.tau_syn_ex;
 
-  f[ S::DG_INH ] = -dg_in / node.P_.tau_syn_in;
+  f[ S::DG_INH ] = -dg_in / P_.tau_syn_in;
   // Synaptic Conductance (nS)
-  f[ S::G_INH ] = dg_in - g_in / node.P_.tau_syn_in;
+  f[ S::G_INH ] = dg_in - g_in / P_.tau_syn_in;
 
   // Adaptation current w.
-  f[ S::W ] = ( node.P_.a * ( V - node.P_.E_L ) - w ) / node.P_.tau_w;
-
-  return GSL_SUCCESS;
+  f[ S::W ] = ( P_.a * ( V - P_.E_L ) - w ) / P_.tau_w;
 }
 
 
@@ -311,9 +301,6 @@ nest::aeif_cond_alpha::State_::set( const Dictionary& d, const Parameters_&, Nod
 
 nest::aeif_cond_alpha::Buffers_::Buffers_( aeif_cond_alpha& n )
   : logger_( n )
-  , s_( nullptr )
-  , c_( nullptr )
-  , e_( nullptr )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
@@ -321,16 +308,13 @@ nest::aeif_cond_alpha::Buffers_::Buffers_( aeif_cond_alpha& n )
 
 nest::aeif_cond_alpha::Buffers_::Buffers_( const Buffers_&, aeif_cond_alpha& n )
   : logger_( n )
-  , s_( nullptr )
-  , c_( nullptr )
-  , e_( nullptr )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
 }
 
 /* ----------------------------------------------------------------
- * Default and copy constructor for node, and destructor
+ * Default and copy constructor for node
  * ---------------------------------------------------------------- */
 
 nest::aeif_cond_alpha::aeif_cond_alpha()
@@ -350,23 +334,6 @@ nest::aeif_cond_alpha::aeif_cond_alpha( const aeif_cond_alpha& n )
 {
 }
 
-nest::aeif_cond_alpha::~aeif_cond_alpha()
-{
-  // GSL structs may not have been allocated, so we need to protect destruction
-  if ( B_.s_ )
-  {
-    gsl_odeiv_step_free( B_.s_ );
-  }
-  if ( B_.c_ )
-  {
-    gsl_odeiv_control_free( B_.c_ );
-  }
-  if ( B_.e_ )
-  {
-    gsl_odeiv_evolve_free( B_.e_ );
-  }
-}
-
 /* ----------------------------------------------------------------
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -382,41 +349,9 @@ nest::aeif_cond_alpha::init_buffers_()
   B_.logger_.reset();
 
   B_.step_ = Time::get_resolution().get_ms();
-  B_.IntegrationStep_ =
-    B_.step_;  // reasonable initial value for numerical integrator step size; this will anyway be overwritten by
-               // gsl_odeiv_evolve_apply(), but it might confuse the integrator if it contains uninitialised data
-
-  if ( not B_.s_ )
-  {
-    B_.s_ = gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_step_reset( B_.s_ );
-  }
-
-  if ( not B_.c_ )
-  {
-    B_.c_ = gsl_odeiv_control_yp_new( P_.gsl_error_tol, P_.gsl_error_tol );
-  }
-  else
-  {
-    gsl_odeiv_control_init( B_.c_, P_.gsl_error_tol, P_.gsl_error_tol, 0.0, 1.0 );
-  }
-
-  if ( not B_.e_ )
-  {
-    B_.e_ = gsl_odeiv_evolve_alloc( State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_evolve_reset( B_.e_ );
-  }
-
-  B_.sys_.jacobian = nullptr;
-  B_.sys_.dimension = State_::STATE_VEC_SIZE;
-  B_.sys_.params = reinterpret_cast< void* >( this );
-  B_.sys_.function = aeif_cond_alpha_dynamics;
+  // reasonable initial value for numerical integrator step size; this will
+  // anyway be overwritten by the integrator
+  B_.IntegrationStep_ = B_.step_;
 
   B_.I_stim_ = 0.0;
 }
@@ -427,7 +362,9 @@ nest::aeif_cond_alpha::pre_run_hook()
   // ensures initialization in case mm connected after Simulate
   B_.logger_.init();
 
-  // set the right threshold and GSL function depending on Delta_T
+  B_.integrator_.set_error_control( P_.gsl_error_tol, P_.gsl_error_tol, 0.0, 1.0 );
+
+  // set the right threshold depending on Delta_T
   if ( P_.Delta_T > 0. )
   {
     V_.V_peak = P_.V_peak_;
@@ -451,85 +388,92 @@ nest::aeif_cond_alpha::update( Time const& origin, const long from, const long t
 {
   assert( State_::V_M == 0 );
 
+  const auto dynamics = [ this ]( const double y[], double f[] ) { dynamics_( y, f ); };
+
   for ( long lag = from; lag < to; ++lag )
   {
     double t = 0.0;
 
     // numerical integration with adaptive step size control:
     // ------------------------------------------------------
-    // gsl_odeiv_evolve_apply performs only a single numerical
-    // integration step, starting from t and bounded by step;
-    // the while-loop ensures integration over the whole simulation
-    // step (0, step] if more than one integration step is needed due
-    // to a small integration step size;
+    // evolve() performs only a single numerical integration step,
+    // starting from t and bounded by step; the while-loop ensures
+    // integration over the whole simulation step (0, step] if more than
+    // one integration step is needed due to a small integration step size;
     // note that (t+IntegrationStep > step) leads to integration over
     // (t, step] and afterwards setting t to step, but it does not
     // enforce setting IntegrationStep to step-t; this is of advantage
     // for a consistent and efficient integration across subsequent
     // simulation intervals
-
     while ( t < B_.step_ )
     {
-      const int status = gsl_odeiv_evolve_apply( B_.e_,
-        B_.c_,
-        B_.s_,
-        &B_.sys_,              // system of ODE
-        &t,                    // from t
-        B_.step_,              // to t <= step
-        &B_.IntegrationStep_,  // integration step size
-        S_.y_ );               // neuronal state
-      if ( status != GSL_SUCCESS )
-      {
-        throw GSLSolverFailure( get_name(), status );
-      }
-
-      // check for unreasonable values; we allow V_M to explode
-      if ( S_.y_[ State_::V_M ] < -1e3 or S_.y_[ State_::W ] < -1e6 or S_.y_[ State_::W ] > 1e6 )
-      {
-        throw NumericalInstability( get_name() );
-      }
+      B_.integrator_.evolve( dynamics, t, B_.step_, B_.IntegrationStep_, S_.y_ );
 
       // spikes are handled inside the while-loop
       // due to spike-driven adaptation
-      if ( S_.r_ > 0 )
+      if ( handle_integration_step_( S_.y_ ) )
       {
-        S_.y_[ State_::V_M ] = P_.V_reset_;
-      }
-      else if ( S_.y_[ State_::V_M ] >= V_.V_peak )
-      {
-        S_.y_[ State_::V_M ] = P_.V_reset_;
-        S_.y_[ State_::W ] += P_.b;  // spike-driven adaptation
-
-        /* Initialize refractory step counter.
-         * - We need to add 1 to compensate for count-down immediately after
-         *   while loop.
-         * - If neuron has no refractory time, set to 0 to avoid refractory
-         *   artifact inside while loop.
-         */
-        S_.r_ = V_.refractory_counts_ > 0 ? V_.refractory_counts_ + 1 : 0;
-
         set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
         SpikeEvent se;
         kernel().event_delivery_manager.send( *this, se, lag );
       }
     }
 
-    // decrement refractory count
-    if ( S_.r_ > 0 )
-    {
-      --S_.r_;
-    }
+    finish_step_( origin, lag );
+  }
+}
 
-    // apply spikes
-    S_.y_[ State_::DG_EXC ] += B_.spike_exc_.get_value( lag ) * V_.g0_ex_;
-    S_.y_[ State_::DG_INH ] += B_.spike_inh_.get_value( lag ) * V_.g0_in_;
+inline bool
+nest::aeif_cond_alpha::handle_integration_step_( double y[] )
+{
+  // check for unreasonable values; we allow V_M to explode
+  if ( y[ State_::V_M ] < -1e3 or y[ State_::W ] < -1e6 or y[ State_::W ] > 1e6 )
+  {
+    throw NumericalInstability( get_name() );
+  }
 
-    // set new input current
-    B_.I_stim_ = B_.currents_.get_value( lag );
+  if ( S_.r_ > 0 )
+  {
+    y[ State_::V_M ] = P_.V_reset_;
+    return false;
+  }
 
-    // log state data
-    B_.logger_.record_data( origin.get_steps() + lag );
+  if ( y[ State_::V_M ] >= V_.V_peak )
+  {
+    y[ State_::V_M ] = P_.V_reset_;
+    y[ State_::W ] += P_.b;  // spike-driven adaptation
+
+    /* Initialize refractory step counter.
+     * - We need to add 1 to compensate for count-down immediately after
+     *   while loop.
+     * - If neuron has no refractory time, set to 0 to avoid refractory
+     *   artifact inside while loop.
+     */
+    S_.r_ = V_.refractory_counts_ > 0 ? V_.refractory_counts_ + 1 : 0;
+    return true;
   }
+
+  return false;
+}
+
+inline void
+nest::aeif_cond_alpha::finish_step_( Time const& origin, const long lag )
+{
+  // decrement refractory count
+  if ( S_.r_ > 0 )
+  {
+    --S_.r_;
+  }
+
+  // apply spikes
+  S_.y_[ State_::DG_EXC ] += B_.spike_exc_.get_value( lag ) * V_.g0_ex_;
+  S_.y_[ State_::DG_INH ] += B_.spike_inh_.get_value( lag ) * V_.g0_in_;
+
+  // set new input current
+  B_.I_stim_ = B_.currents_.get_value( lag );
+
+  // log state data
+  B_.logger_.record_data( origin.get_steps() + lag );
 }
 
 void
@@ -566,4 +510,3 @@ nest::aeif_cond_alpha::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
-#endif  // HAVE_GSL
@@ -23,15 +23,8 @@
 #ifndef AEIF_COND_ALPHA_H
 #define AEIF_COND_ALPHA_H
 
-// Generated includes:
-#include "config.h"
-
-#ifdef HAVE_GSL
-
-// External includes:
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_odeiv.h>
+// Includes from libnestutil:
+#include "rkf45_integrator.h"
 
 // Includes from nestkernel:
 #include "archiving_node.h"
@@ -44,29 +37,6 @@
 
 namespace nest
 {
-/**
- * Function computing right-hand side of ODE for GSL solver if Delta_T != 0.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int aeif_cond_alpha_dynamics( double, const double*, double*, void* );
-
-/**
- * Function computing right-hand side of ODE for GSL solver if Delta_T == 0.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int aeif_cond_alpha_dynamics_DT0( double, const double*, double*, void* );
 
 /* BeginUserDocs: neuron, integrate-and-fire, adaptation, conductance-based, soft threshold
 
@@ -165,7 +135,7 @@ The following parameters can be set in the status Dictionary.
 **Integration parameters**
 -------------------------------------------------------------------------------
 gsl_error_tol real    This parameter controls the admissible error of the
-                      GSL integrator. Reduce it if NEST complains about
+                      integrator. Reduce it if NEST complains about
                       numerical instabilities.
 ============= ======= =========================================================
 
@@ -202,9 +172,11 @@ class aeif_cond_alpha : public ArchivingNode
 {
 
 public:
+  //! Nodes are updated in batches by GenericModel< aeif_cond_alpha >
+  static constexpr bool supports_batched_update = true;
+
   aeif_cond_alpha();
   aeif_cond_alpha( const aeif_cond_alpha& );
-  ~aeif_cond_alpha() override;
 
   /**
    * Import sets of overloaded virtual functions.
@@ -232,12 +204,32 @@ private:
   void pre_run_hook() override;
   void update( Time const&, const long, const long ) override;
 
+  //! Compute right-hand side of the ODE system for state y
+  void dynamics_( const double y[], double f[] ) const;
+
+  /**
+   * Check state y after an integration step and handle a spike.
+   *
+   * @returns true if the neuron fired
+   */
+  bool handle_integration_step_( double y[] );
+
+  //! Apply refractoriness and inputs and record data at the end of a step
+  void finish_step_( Time const& origin, const long lag );
+
   // END Boilerplate function declarations ----------------------------
 
   // Friends --------------------------------------------------------
 
-  // make dynamics function quasi-member
-  friend int aeif_cond_alpha_dynamics( double, const double*, double*, void* );
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spike_exc_, B_.spike_inh_, B_.currents_ );
+  }
+
+  //! Needs access to update() for batched updates and to ring_buffers() for the memory report
+  friend class GenericModel< aeif_cond_alpha >;
 
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< aeif_cond_alpha >;
@@ -267,7 +259,7 @@ private:
     double tau_syn_in;  //!< Excitatory synaptic rise time
     double I_e;         //!< Intrinsic current in pA
 
-    double gsl_error_tol;  //!< Error bound for GSL integrator
+    double gsl_error_tol;  //!< Error bound for integrator
 
     Parameters_();  //!< Sets default parameter values
 
@@ -286,7 +278,7 @@ public:
   {
     /**
      * Enumeration identifying elements in state array State_::y_.
-     * The state vector must be passed to GSL as a C array. This enum
+     * The state vector is passed to the integrator as a C array. This enum
      * identifies the elements of the vector. It must be public to be
      * accessible from the iteration function.
      */
@@ -302,7 +294,7 @@ public:
     };
 
     double y_[ STATE_VEC_SIZE ];  //!< neuron state, must be C-array for
-                                  //!< GSL solver
+                                  //!< integrator
     unsigned int r_;              //!< number of refractory steps remaining
 
     State_( const Parameters_& );  //!< Default initialization
@@ -332,17 +324,14 @@ public:
     RingBuffer spike_inh_;
     RingBuffer currents_;
 
-    /** GSL ODE stuff */
-    gsl_odeiv_step* s_;     //!< stepping function
-    gsl_odeiv_control* c_;  //!< adaptive stepsize control function
-    gsl_odeiv_evolve* e_;   //!< evolution function
-    gsl_odeiv_system sys_;  //!< struct describing the GSL system
+    //! Adaptive Runge-Kutta-Fehlberg integrator
+    RKF45Integrator< State_::STATE_VEC_SIZE > integrator_;
 
     // Since IntegrationStep_ is initialized with step_, and the resolution
     // cannot change after nodes have been created, it is safe to place both
     // here.
     double step_;             //!< step size in ms
-    double IntegrationStep_;  //!< current integration time step, updated by GSL
+    double IntegrationStep_;  //!< current integration time step, updated by integrator
 
     /**
      * Input current injected by CurrentEvent.
@@ -467,5 +456,4 @@ aeif_cond_alpha::set_status( const Dictionary& d )
 
 }  // namespace
 
-#endif  // HAVE_GSL
 #endif  // AEIF_COND_ALPHA_H
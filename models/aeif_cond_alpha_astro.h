@@ -237,6 +237,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spike_exc_, B_.spike_inh_, B_.currents_, B_.sic_currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< aeif_cond_alpha_astro >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
   void update( Time const&, const long, const long ) override;
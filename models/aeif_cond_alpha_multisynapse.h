@@ -200,6 +200,9 @@ class aeif_cond_alpha_multisynapse : public ArchivingNode
 {
 
 public:
+  //! handles_test_event() checks the receptor against the parameters of the node and marks it as connected
+  static constexpr bool has_cacheable_connection_checks = false;
+
   aeif_cond_alpha_multisynapse();
   aeif_cond_alpha_multisynapse( const aeif_cond_alpha_multisynapse& );
   ~aeif_cond_alpha_multisynapse() override;
@@ -228,6 +231,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< aeif_cond_alpha_multisynapse >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
   void update( Time const&, const long, const long ) override;
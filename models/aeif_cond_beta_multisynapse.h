@@ -203,6 +203,9 @@ class aeif_cond_beta_multisynapse : public ArchivingNode
 {
 
 public:
+  //! handles_test_event() checks the receptor against the parameters of the node and marks it as connected
+  static constexpr bool has_cacheable_connection_checks = false;
+
   aeif_cond_beta_multisynapse();
   aeif_cond_beta_multisynapse( const aeif_cond_beta_multisynapse& );
   ~aeif_cond_beta_multisynapse() override;
@@ -231,6 +234,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< aeif_cond_beta_multisynapse >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
   void update( Time const&, const long, const long ) override;
@@ -235,6 +235,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< aeif_psc_delta_clopath >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
   void update( const Time&, const long, const long ) override;
@@ -167,13 +167,27 @@ public:
 
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< bernoulli_synapse > get_double_parameter_setter( const std::string& name );
+
   void
   set_weight( double w )
   {
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
+  //! Setters for parameters, throw BadProperty for invalid values
+  void set_p_transmit_( const double p_transmit );
+
   double weight_;
   double p_transmit_;
 };
@@ -197,12 +211,34 @@ bernoulli_synapse< targetidentifierT >::set_status( const Dictionary& d, Connect
 {
   ConnectionBase::set_status( d, cm );
   d.update_value( names::weight, weight_ );
-  d.update_value( names::p_transmit, p_transmit_ );
 
-  if ( p_transmit_ < 0 or p_transmit_ > 1 )
+  double value;
+  if ( d.update_value( names::p_transmit, value ) )
+  {
+    set_p_transmit_( value );
+  }
+}
+
+template < typename targetidentifierT >
+DoubleParameterSetter< bernoulli_synapse< targetidentifierT > >
+bernoulli_synapse< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::p_transmit )
+  {
+    return []( bernoulli_synapse& c, const double p_transmit ) { c.set_p_transmit_( p_transmit ); };
+  }
+  return nullptr;
+}
+
+template < typename targetidentifierT >
+void
+bernoulli_synapse< targetidentifierT >::set_p_transmit_( const double p_transmit )
+{
+  if ( p_transmit < 0 or p_transmit > 1 )
   {
     throw BadProperty( "Spike transmission probability must be in [0, 1]." );
   }
+  p_transmit_ = p_transmit;
 }
 
 }  // namespace
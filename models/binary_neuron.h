@@ -109,6 +109,16 @@ public:
 
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< binary_neuron >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
 
@@ -118,6 +118,7 @@ public:
     | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::REQUIRES_CLOPATH_ARCHIVING
     | ConnectionModelProperties::SUPPORTS_HPC | ConnectionModelProperties::SUPPORTS_LBL
     | ConnectionModelProperties::SUPPORTS_WFR;
+  static constexpr bool checks_weight_in_set_status = true;
 
   /**
    * Default Constructor.
@@ -189,6 +190,12 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
   double
   depress_( double w, double dw )
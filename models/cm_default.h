@@ -244,6 +244,9 @@ class cm_default : public ArchivingNode
 {
 
 public:
+  //! Valid receptors depend on the compartments and receptors added to each node
+  static constexpr bool has_cacheable_connection_checks = false;
+
   cm_default();
   cm_default( const cm_default& );
 
@@ -275,6 +278,16 @@ private:
   CompTree c_tree_;
   std::vector< RingBuffer > syn_buffers_;
 
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( syn_buffers_, c_tree_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< cm_default >;
+
   // To record variables with DataAccessFunctor
   double
   get_state_element( size_t elem )
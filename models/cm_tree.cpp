@@ -363,6 +363,27 @@ nest::CompTree::get_recordables()
   return recordables;
 }
 
+/**
+ * Returns the number of bytes held by the current buffers of all compartments
+ */
+size_t
+nest::CompTree::memory() const
+{
+  size_t bytes = 0;
+  std::vector< const Compartment* > pending( 1, &root_ );
+  while ( not pending.empty() )
+  {
+    const Compartment* compartment = pending.back();
+    pending.pop_back();
+    bytes += ring_buffer_memory( compartment->currents );
+    for ( const auto& child : compartment->children )
+    {
+      pending.push_back( &child );
+    }
+  }
+  return bytes;
+}
+
 /**
  * Initialize state variables
  */
@@ -187,6 +187,9 @@ public:
   //! make all state variables accessible for recording
   std::map< std::string, double* > get_recordables();
 
+  //! get number of bytes held by the current buffers of all compartments, see ring_buffer_memory()
+  size_t memory() const;
+
   //! get a compartment pointer from the tree
   Compartment* get_compartment( const long compartment_index ) const;
   Compartment* get_compartment( const long compartment_index, Compartment* compartment, const long raise_flag ) const;
@@ -91,6 +91,7 @@ public:
   static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
     | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::SUPPORTS_HPC
     | ConnectionModelProperties::SUPPORTS_LBL | ConnectionModelProperties::SUPPORTS_WFR;
+  static constexpr bool has_plain_delay = false;
 
   /**
    * Default Constructor.
@@ -127,6 +128,13 @@ public:
     weight_ = w;
   }
 
+  //! Return the synaptic weight.
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
   /**
    * Get all properties of this connection and put them into a dictionary.
    */
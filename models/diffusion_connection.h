@@ -94,6 +94,8 @@ public:
   typedef Connection< targetidentifierT > ConnectionBase;
 
   static constexpr ConnectionModelProperties properties = ConnectionModelProperties::SUPPORTS_WFR;
+  static constexpr bool checks_weight_in_set_status = true;
+  static constexpr bool has_plain_delay = false;
 
   /**
    * Default Constructor.
@@ -158,6 +160,12 @@ public:
       "diffusion_factor to specifiy the weights." );
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
   void
   set_delay( double )
   {
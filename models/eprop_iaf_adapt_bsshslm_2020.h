@@ -314,6 +314,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< eprop_iaf_adapt_bsshslm_2020 >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
 
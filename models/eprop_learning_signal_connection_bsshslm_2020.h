@@ -189,6 +189,13 @@ public:
     weight_ = w;
   }
 
+  //! Return the synaptic weight.
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
   //! Synaptic weight.
   double weight_;
@@ -239,6 +239,7 @@ public:
 
   //! Whether this connection type supports flush events.
   static constexpr bool supports_flush_event = true;
+  static constexpr bool checks_weight_in_set_status = true;
 
   //! Default constructor.
   eprop_synapse();
@@ -305,6 +306,13 @@ public:
     weight_ = w;
   }
 
+  //! Return the synaptic weight.
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
   //! Delete optimizer
   void delete_optimizer();
 
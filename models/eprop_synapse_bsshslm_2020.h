@@ -256,6 +256,7 @@ public:
   static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
     | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::REQUIRES_EPROP_ARCHIVING
     | ConnectionModelProperties::SUPPORTS_HPC;
+  static constexpr bool checks_weight_in_set_status = true;
 
   //! Default constructor.
   eprop_synapse_bsshslm_2020();
@@ -322,6 +323,13 @@ public:
     weight_ = w;
   }
 
+  //! Return the synaptic weight.
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
   //! Delete optimizer
   void delete_optimizer();
 
@@ -86,6 +86,7 @@ public:
 
   static constexpr ConnectionModelProperties properties =
     ConnectionModelProperties::REQUIRES_SYMMETRIC | ConnectionModelProperties::SUPPORTS_WFR;
+  static constexpr bool has_plain_delay = false;
 
   /**
    * Default Constructor.
@@ -143,6 +144,12 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
   void
   set_delay( double )
   {
@@ -187,6 +187,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.ex_spikes_, B_.in_spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< gif_pop_psc_exp >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
 
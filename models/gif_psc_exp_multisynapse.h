@@ -208,6 +208,9 @@ class gif_psc_exp_multisynapse : public ArchivingNode
 {
 
 public:
+  //! handles_test_event() checks the receptor against the parameters of the node and marks it as connected
+  static constexpr bool has_cacheable_connection_checks = false;
+
   gif_psc_exp_multisynapse();
   gif_psc_exp_multisynapse( const gif_psc_exp_multisynapse& );
 
@@ -233,6 +236,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< gif_psc_exp_multisynapse >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
 
@@ -206,6 +206,9 @@ void register_glif_cond( const std::string& name );
 class glif_cond : public ArchivingNode
 {
 public:
+  //! handles_test_event() checks the receptor against the parameters of the node and marks it as connected
+  static constexpr bool has_cacheable_connection_checks = false;
+
   glif_cond();
 
   glif_cond( const glif_cond& );
@@ -229,6 +232,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< glif_cond >;
+
   //! Reset internal buffers of neuron.
   void init_buffers_() override;
 
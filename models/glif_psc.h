@@ -204,6 +204,9 @@ void register_glif_psc( const std::string& name );
 class glif_psc : public ArchivingNode
 {
 public:
+  //! handles_test_event() checks the receptor against the parameters of the node and marks it as connected
+  static constexpr bool has_cacheable_connection_checks = false;
+
   glif_psc();
 
   glif_psc( const glif_psc& );
@@ -225,6 +228,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< glif_psc >;
+
   //! Reset internal buffers of neuron.
   void init_buffers_() override;
 
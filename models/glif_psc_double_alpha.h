@@ -219,6 +219,9 @@ void register_glif_psc_double_alpha( const std::string& name );
 class glif_psc_double_alpha : public ArchivingNode
 {
 public:
+  //! handles_test_event() checks the receptor against the parameters of the node and marks it as connected
+  static constexpr bool has_cacheable_connection_checks = false;
+
   glif_psc_double_alpha();
 
   glif_psc_double_alpha( const glif_psc_double_alpha& );
@@ -240,6 +243,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< glif_psc_double_alpha >;
+
   //! Reset internal buffers of neuron.
   void init_buffers_() override;
 
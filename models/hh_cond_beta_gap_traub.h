@@ -215,6 +215,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spike_exc_, B_.spike_inh_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< hh_cond_beta_gap_traub >;
+
   void init_buffers_() override;
   double get_normalisation_factor( double, double );
   void pre_run_hook() override;
@@ -208,6 +208,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spike_inputs_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< ht_neuron >;
+
   /**
    * Synapse types to connect to
    * @note Excluded upper and lower bounds are defined as INF_, SUP_.
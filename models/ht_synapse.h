@@ -185,6 +185,13 @@ public:
     weight_ = w;
   }
 
+  //! Return the synaptic weight.
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
   double weight_;  //!< Synaptic weight
 
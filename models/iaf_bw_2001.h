@@ -230,6 +230,16 @@ public:
   }
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< iaf_bw_2001 >;
+
   void init_state_() override;
   void pre_run_hook() override;
   void init_buffers_() override;
@@ -186,6 +186,9 @@ void register_iaf_bw_2001_exact( const std::string& name );
 class iaf_bw_2001_exact : public ArchivingNode
 {
 public:
+  //! Each NMDA connection is assigned its own port by handles_test_event()
+  static constexpr bool has_cacheable_connection_checks = false;
+
   iaf_bw_2001_exact();
   iaf_bw_2001_exact( const iaf_bw_2001_exact& );
   ~iaf_bw_2001_exact() override;
@@ -220,6 +223,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< iaf_bw_2001_exact >;
+
   void init_state_() override;
   void pre_run_hook() override;
   void init_buffers_() override;
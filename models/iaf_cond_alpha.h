@@ -23,15 +23,8 @@
 #ifndef IAF_COND_ALPHA_H
 #define IAF_COND_ALPHA_H
 
-// Generated includes:
-#include "config.h"
-
-#ifdef HAVE_GSL
-
-// C includes:
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_odeiv.h>
+// Includes from libnestutil:
+#include "rkf45_integrator.h"
 
 // Includes from nestkernel:
 #include "archiving_node.h"
@@ -44,17 +37,6 @@
 
 namespace nest
 {
-/**
- * Function computing right-hand side of ODE for GSL solver.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int iaf_cond_alpha_dynamics( double, const double*, double*, void* );
 
 /* BeginUserDocs: neuron, integrate-and-fire, conductance-based, hard threshold
 
@@ -131,7 +113,6 @@ class iaf_cond_alpha : public ArchivingNode
 public:
   iaf_cond_alpha();
   iaf_cond_alpha( const iaf_cond_alpha& );
-  ~iaf_cond_alpha() override;
 
   /*
    * Import all overloaded virtual functions that we
@@ -156,17 +137,27 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spike_exc_, B_.spike_inh_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< iaf_cond_alpha >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
   void update( Time const&, const long, const long ) override;
 
+  //! Compute right-hand side of the ODE system for state y
+  void dynamics_( const double y[], double f[] ) const;
+
   // END Boilerplate function declarations ----------------------------
 
   // Friends --------------------------------------------------------
 
-  // make dynamics function quasi-member
-  friend int iaf_cond_alpha_dynamics( double, const double*, double*, void* );
-
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_cond_alpha >;
   friend class UniversalDataLogger< iaf_cond_alpha >;
@@ -202,7 +193,7 @@ private:
    *
    * State variables consist of the state vector for the subthreshold
    * dynamics and the refractory count. The state vector must be a
-   * C-style array to be compatible with GSL ODE solvers.
+   * C-style array to be passed to the integrator.
    *
    * @note Copy constructor required because of the C-style array.
    */
@@ -220,7 +211,7 @@ public:
       STATE_VEC_SIZE
     };
 
-    //! state vector, must be C-array for GSL solver
+    //! state vector, must be C-array for integrator
     double y[ STATE_VEC_SIZE ];
 
     //!< number of refractory steps remaining
@@ -262,17 +253,14 @@ private:
     RingBuffer spike_inh_;
     RingBuffer currents_;
 
-    /* GSL ODE stuff */
-    gsl_odeiv_step* s_;     //!< stepping function
-    gsl_odeiv_control* c_;  //!< adaptive stepsize control function
-    gsl_odeiv_evolve* e_;   //!< evolution function
-    gsl_odeiv_system sys_;  //!< struct describing system
+    //! Adaptive Runge-Kutta-Fehlberg integrator
+    RKF45Integrator< State_::STATE_VEC_SIZE > integrator_;
 
     // Since IntegrationStep_ is initialized with step_, and the resolution
     // cannot change after nodes have been created, it is safe to place both
     // here.
     double step_;             //!< step size in ms
-    double IntegrationStep_;  //!< current integration time step, updated by GSL
+    double IntegrationStep_;  //!< current integration time step, updated by integrator
 
     /**
      * Input current injected by CurrentEvent.
@@ -411,4 +399,3 @@ iaf_cond_alpha::set_status( const Dictionary& d )
 
 #endif  // IAF_COND_ALPHA_H
 
-#endif  // HAVE_GSL
@@ -22,8 +22,6 @@
 
 #include "iaf_cond_exp.h"
 
-#ifdef HAVE_GSL
-
 // C++ includes:
 #include <cstdio>
 #include <iostream>
@@ -67,39 +65,33 @@ RecordablesMap< iaf_cond_exp >::create()
 }
 }
 
-extern "C" inline int
-nest::iaf_cond_exp_dynamics( double, const double y[], double f[], void* pnode )
+inline void
+nest::iaf_cond_exp::dynamics_( const double y[], double f[] ) const
 {
   // a shorthand
   typedef nest::iaf_cond_exp::State_ S;
 
-  // get access to node so we can almost work as in a member function
-  assert( pnode );
-  const nest::iaf_cond_exp& node = *( reinterpret_cast< nest::iaf_cond_exp* >( pnode ) );
-
-  const bool is_refractory = node.S_.r_ > 0;
+  const bool is_refractory = S_.r_ > 0;
 
   // y[] here is---and must be---the state vector supplied by the integrator,
-  // not the state vector in the node, node.S_.y[].
+  // not the state vector in the node, S_.y[].
 
   // The following code is verbose for the sake of clarity. We assume that a
   // good compiler will optimize the verbosity away ...
 
   // Clamp membrane potential to V_reset while refractory, otherwise bound
   // it to V_th.
-  const double V = is_refractory ? node.P_.V_reset_ : std::min( y[ S::V_M ], node.P_.V_th_ );
+  const double V = is_refractory ? P_.V_reset_ : std::min( y[ S::V_M ], P_.V_th_ );
 
-  const double I_syn_exc = y[ S::G_EXC ] * ( V - node.P_.E_ex );
-  const double I_syn_inh = y[ S::G_INH ] * ( V - node.P_.E_in );
-  const double I_L = node.P_.g_L * ( V - node.P_.E_L );
+  const double I_syn_exc = y[ S::G_EXC ] * ( V - P_.E_ex );
+  const double I_syn_inh = y[ S::G_INH ] * ( V - P_.E_in );
+  const double I_L = P_.g_L * ( V - P_.E_L );
 
   // V dot
-  f[ 0 ] = is_refractory ? 0.0 : ( -I_L + node.B_.I_stim_ + node.P_.I_e - I_syn_exc - I_syn_inh ) / node.P_.C_m;
-
-  f[ 1 ] = -y[ S::G_EXC ] / node.P_.tau_synE;
-  f[ 2 ] = -y[ S::G_INH ] / node.P_.tau_synI;
+  f[ 0 ] = is_refractory ? 0.0 : ( -I_L + B_.I_stim_ + P_.I_e - I_syn_exc - I_syn_inh ) / P_.C_m;
 
-  return GSL_SUCCESS;
+  f[ 1 ] = -y[ S::G_EXC ] / P_.tau_synE;
+  f[ 2 ] = -y[ S::G_INH ] / P_.tau_synI;
 }
 
 /* ----------------------------------------------------------------
@@ -223,9 +215,6 @@ nest::iaf_cond_exp::State_::set( const Dictionary& d, const Parameters_&, Node*
 
 nest::iaf_cond_exp::Buffers_::Buffers_( iaf_cond_exp& n )
   : logger_( n )
-  , s_( nullptr )
-  , c_( nullptr )
-  , e_( nullptr )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
@@ -233,16 +222,13 @@ nest::iaf_cond_exp::Buffers_::Buffers_( iaf_cond_exp& n )
 
 nest::iaf_cond_exp::Buffers_::Buffers_( const Buffers_&, iaf_cond_exp& n )
   : logger_( n )
-  , s_( nullptr )
-  , c_( nullptr )
-  , e_( nullptr )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
 }
 
 /* ----------------------------------------------------------------
- * Default and copy constructor for node, and destructor
+ * Default and copy constructor for node
  * ---------------------------------------------------------------- */
 
 nest::iaf_cond_exp::iaf_cond_exp()
@@ -262,23 +248,6 @@ nest::iaf_cond_exp::iaf_cond_exp( const iaf_cond_exp& n )
 {
 }
 
-nest::iaf_cond_exp::~iaf_cond_exp()
-{
-  // GSL structs may not have been allocated, so we need to protect destruction
-  if ( B_.s_ )
-  {
-    gsl_odeiv_step_free( B_.s_ );
-  }
-  if ( B_.c_ )
-  {
-    gsl_odeiv_control_free( B_.c_ );
-  }
-  if ( B_.e_ )
-  {
-    gsl_odeiv_evolve_free( B_.e_ );
-  }
-}
-
 /* ----------------------------------------------------------------
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -296,37 +265,7 @@ nest::iaf_cond_exp::init_buffers_()
   B_.step_ = Time::get_resolution().get_ms();
   B_.IntegrationStep_ = B_.step_;
 
-  if ( not B_.s_ )
-  {
-    B_.s_ = gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_step_reset( B_.s_ );
-  }
-
-  if ( not B_.c_ )
-  {
-    B_.c_ = gsl_odeiv_control_y_new( 1e-3, 0.0 );
-  }
-  else
-  {
-    gsl_odeiv_control_init( B_.c_, 1e-3, 0.0, 1.0, 0.0 );
-  }
-
-  if ( not B_.e_ )
-  {
-    B_.e_ = gsl_odeiv_evolve_alloc( State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_evolve_reset( B_.e_ );
-  }
-
-  B_.sys_.function = iaf_cond_exp_dynamics;
-  B_.sys_.jacobian = nullptr;
-  B_.sys_.dimension = State_::STATE_VEC_SIZE;
-  B_.sys_.params = reinterpret_cast< void* >( this );
+  B_.integrator_.set_error_control( 1e-3, 0.0, 1.0, 0.0 );
 
   B_.I_stim_ = 0.0;
 }
@@ -349,6 +288,8 @@ nest::iaf_cond_exp::pre_run_hook()
 void
 nest::iaf_cond_exp::update( Time const& origin, const long from, const long to )
 {
+  const auto dynamics = [ this ]( const double y[], double f[] ) { dynamics_( y, f ); };
+
   for ( long lag = from; lag < to; ++lag )
   {
 
@@ -356,11 +297,10 @@ nest::iaf_cond_exp::update( Time const& origin, const long from, const long to )
 
     // numerical integration with adaptive step size control:
     // ------------------------------------------------------
-    // gsl_odeiv_evolve_apply performs only a single numerical
-    // integration step, starting from t and bounded by step;
-    // the while-loop ensures integration over the whole simulation
-    // step (0, step] if more than one integration step is needed due
-    // to a small integration step size;
+    // evolve() performs only a single numerical integration step,
+    // starting from t and bounded by step; the while-loop ensures
+    // integration over the whole simulation step (0, step] if more than
+    // one integration step is needed due to a small integration step size;
     // note that (t+IntegrationStep > step) leads to integration over
     // (t, step] and afterwards setting t to step, but it does not
     // enforce setting IntegrationStep to step-t; this is of advantage
@@ -368,18 +308,7 @@ nest::iaf_cond_exp::update( Time const& origin, const long from, const long to )
     // simulation intervals
     while ( t < B_.step_ )
     {
-      const int status = gsl_odeiv_evolve_apply( B_.e_,
-        B_.c_,
-        B_.s_,
-        &B_.sys_,              // system of ODE
-        &t,                    // from t
-        B_.step_,              // to t <= step
-        &B_.IntegrationStep_,  // integration step size
-        S_.y_ );               // neuronal state
-      if ( status != GSL_SUCCESS )
-      {
-        throw GSLSolverFailure( get_name(), status );
-      }
+      B_.integrator_.evolve( dynamics, t, B_.step_, B_.IntegrationStep_, S_.y_ );
     }
 
     S_.y_[ State_::G_EXC ] += B_.spike_exc_.get_value( lag );
@@ -446,4 +375,3 @@ nest::iaf_cond_exp::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
-#endif  // HAVE_GSL
@@ -23,15 +23,8 @@
 #ifndef IAF_COND_EXP_H
 #define IAF_COND_EXP_H
 
-// Generated includes:
-#include "config.h"
-
-#ifdef HAVE_GSL
-
-// External includes:
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_odeiv.h>
+// Includes from libnestutil:
+#include "rkf45_integrator.h"
 
 // Includes from nestkernel:
 #include "archiving_node.h"
@@ -44,17 +37,6 @@
 
 namespace nest
 {
-/**
- * Function computing right-hand side of ODE for GSL solver.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int iaf_cond_exp_dynamics( double, const double*, double*, void* );
 
 // clang-format off
 /* BeginUserDocs: neuron, integrate-and-fire, conductance-based, hard threshold
@@ -200,7 +182,6 @@ class iaf_cond_exp : public ArchivingNode
 public:
   iaf_cond_exp();
   iaf_cond_exp( const iaf_cond_exp& );
-  ~iaf_cond_exp() override;
 
   /**
    * Import sets of overloaded virtual functions.
@@ -224,17 +205,27 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spike_exc_, B_.spike_inh_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< iaf_cond_exp >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
   void update( Time const&, const long, const long ) override;
 
+  //! Compute right-hand side of the ODE system for state y
+  void dynamics_( const double y[], double f[] ) const;
+
   // END Boilerplate function declarations ----------------------------
 
   // Friends --------------------------------------------------------
 
-  // make dynamics function quasi-member
-  friend int iaf_cond_exp_dynamics( double, const double*, double*, void* );
-
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_cond_exp >;
   friend class UniversalDataLogger< iaf_cond_exp >;
@@ -281,7 +272,7 @@ public:
       STATE_VEC_SIZE
     };
 
-    //! neuron state, must be C-array for GSL solver
+    //! neuron state, must be C-array for integrator
     double y_[ STATE_VEC_SIZE ];
     int r_;  //!< number of refractory steps remaining
 
@@ -313,17 +304,14 @@ private:
     RingBuffer spike_inh_;
     RingBuffer currents_;
 
-    /** GSL ODE stuff */
-    gsl_odeiv_step* s_;     //!< stepping function
-    gsl_odeiv_control* c_;  //!< adaptive stepsize control function
-    gsl_odeiv_evolve* e_;   //!< evolution function
-    gsl_odeiv_system sys_;  //!< struct describing system
+    //! Adaptive Runge-Kutta-Fehlberg integrator
+    RKF45Integrator< State_::STATE_VEC_SIZE > integrator_;
 
     // Since IntegrationStep_ is initialized with step_, and the resolution
     // cannot change after nodes have been created, it is safe to place both
     // here.
     double step_;             //!< step size in ms
-    double IntegrationStep_;  //!< current integration time step, updated by GSL
+    double IntegrationStep_;  //!< current integration time step, updated by integrator
 
     /**
      * Input current injected by CurrentEvent.
@@ -437,5 +425,4 @@ iaf_cond_exp::set_status( const Dictionary& d )
 
 }  // namespace
 
-#endif  // HAVE_GSL
 #endif  // IAF_COND_EXP_H
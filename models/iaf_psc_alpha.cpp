@@ -23,6 +23,7 @@
 #include "iaf_psc_alpha.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -369,6 +370,203 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
   }
 }
 
+/* ----------------------------------------------------------------
+ * Update of batches of nodes held as structure of arrays
+ * ---------------------------------------------------------------- */
+
+iaf_psc_alpha::BatchState::BatchState( Node* const* first, Node* const* last )
+{
+  for ( ; first != last; ++first )
+  {
+    if ( not( *first )->is_frozen() )
+    {
+      nodes_.push_back( static_cast< iaf_psc_alpha* >( *first ) );
+    }
+  }
+
+  const size_t n = nodes_.size();
+  for ( auto* array : { &y0_,
+          &dI_ex_,
+          &I_ex_,
+          &dI_in_,
+          &I_in_,
+          &y3_,
+          &r_,
+          &I_e_,
+          &Theta_,
+          &V_reset_,
+          &LowerBound_,
+          &EPSCInitialValue_,
+          &IPSCInitialValue_,
+          &RefractoryCounts_,
+          &P11_ex_,
+          &P21_ex_,
+          &P22_ex_,
+          &P31_ex_,
+          &P32_ex_,
+          &P11_in_,
+          &P21_in_,
+          &P22_in_,
+          &P31_in_,
+          &P32_in_,
+          &P30_,
+          &expm1_tau_m_,
+          &weighted_spikes_ex_,
+          &weighted_spikes_in_,
+          &currents_,
+          &crossed_ } )
+  {
+    array->resize( n );
+  }
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_alpha& node = *nodes_[ i ];
+
+    y0_[ i ] = node.S_.y0_;
+    dI_ex_[ i ] = node.S_.dI_ex_;
+    I_ex_[ i ] = node.S_.I_ex_;
+    dI_in_[ i ] = node.S_.dI_in_;
+    I_in_[ i ] = node.S_.I_in_;
+    y3_[ i ] = node.S_.y3_;
+    r_[ i ] = node.S_.r_;
+
+    I_e_[ i ] = node.P_.I_e_;
+    Theta_[ i ] = node.P_.Theta_;
+    V_reset_[ i ] = node.P_.V_reset_;
+    LowerBound_[ i ] = node.P_.LowerBound_;
+
+    EPSCInitialValue_[ i ] = node.V_.EPSCInitialValue_;
+    IPSCInitialValue_[ i ] = node.V_.IPSCInitialValue_;
+    RefractoryCounts_[ i ] = node.V_.RefractoryCounts_;
+    P11_ex_[ i ] = node.V_.P11_ex_;
+    P21_ex_[ i ] = node.V_.P21_ex_;
+    P22_ex_[ i ] = node.V_.P22_ex_;
+    P31_ex_[ i ] = node.V_.P31_ex_;
+    P32_ex_[ i ] = node.V_.P32_ex_;
+    P11_in_[ i ] = node.V_.P11_in_;
+    P21_in_[ i ] = node.V_.P21_in_;
+    P22_in_[ i ] = node.V_.P22_in_;
+    P31_in_[ i ] = node.V_.P31_in_;
+    P32_in_[ i ] = node.V_.P32_in_;
+    P30_[ i ] = node.V_.P30_;
+    expm1_tau_m_[ i ] = node.V_.expm1_tau_m_;
+
+    if ( node.B_.logger_.has_logging_devices() )
+    {
+      logged_.push_back( i );
+    }
+  }
+}
+
+void
+iaf_psc_alpha::BatchState::update( Time const& origin, const long from, const long to )
+{
+  const size_t n = nodes_.size();
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // get input of this step and reset the input-buffer slot of each node
+    const size_t input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      MultiChannelInputBuffer< Buffers_::NUM_INPUT_CHANNELS >& input_buffer = nodes_[ i ]->B_.input_buffer_;
+      const auto& input = input_buffer.get_values_all_channels( input_buffer_slot );
+      weighted_spikes_ex_[ i ] = input[ Buffers_::SYN_EX ];
+      weighted_spikes_in_[ i ] = input[ Buffers_::SYN_IN ];
+      currents_[ i ] = input[ Buffers_::I0 ];
+      input_buffer.reset_values_all_channels( input_buffer_slot );
+    }
+
+    // Same computation as in iaf_psc_alpha::update(), with branches replaced by selections. The membrane
+    // potential is computed for refractory nodes too, but discarded. Threshold crossings are only flagged
+    // here and handled below, so that the loop body contains no conditional loads or stores.
+#pragma omp simd
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const double y3 = y3_[ i ];
+      const double r = r_[ i ];
+      const double dI_ex = dI_ex_[ i ];
+      const double I_ex = I_ex_[ i ];
+      const double dI_in = dI_in_[ i ];
+      const double I_in = I_in_[ i ];
+
+      double y3_new = P30_[ i ] * ( y0_[ i ] + I_e_[ i ] ) + P31_ex_[ i ] * dI_ex + P32_ex_[ i ] * I_ex
+        + P31_in_[ i ] * dI_in + P32_in_[ i ] * I_in + expm1_tau_m_[ i ] * y3 + y3;
+      y3_new = y3_new < LowerBound_[ i ] ? LowerBound_[ i ] : y3_new;
+      y3_[ i ] = r == 0.0 ? y3_new : y3;
+
+      // the refractory count is a non-negative integer, so this decrements it only if it is positive
+      r_[ i ] = std::max( r - 1.0, 0.0 );
+
+      // alpha shape PSCs, spikes arriving at T+1 have an immediate effect on the state of the neuron
+      I_ex_[ i ] = P21_ex_[ i ] * dI_ex + P22_ex_[ i ] * I_ex;
+      dI_ex_[ i ] = dI_ex * P11_ex_[ i ] + EPSCInitialValue_[ i ] * weighted_spikes_ex_[ i ];
+      I_in_[ i ] = P21_in_[ i ] * dI_in + P22_in_[ i ] * I_in;
+      dI_in_[ i ] = dI_in * P11_in_[ i ] + IPSCInitialValue_[ i ] * weighted_spikes_in_[ i ];
+
+      crossed_[ i ] = y3_[ i ] >= Theta_[ i ] ? 1.0 : 0.0;
+
+      // set new input current
+      y0_[ i ] = currents_[ i ];
+    }
+
+    // threshold crossing
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( crossed_[ i ] != 0.0 )
+      {
+        r_[ i ] = RefractoryCounts_[ i ];
+        y3_[ i ] = V_reset_[ i ];
+        emitted_spikes_.emplace_back( i, lag );
+      }
+    }
+
+    // log state data
+    for ( const size_t i : logged_ )
+    {
+      store_( i );
+      nodes_[ i ]->B_.logger_.record_data( origin.get_steps() + lag );
+    }
+  }
+
+  // send spikes ordered by node, spikes of each node remain ordered by lag
+  std::stable_sort( emitted_spikes_.begin(),
+    emitted_spikes_.end(),
+    []( const std::pair< size_t, long >& lhs, const std::pair< size_t, long >& rhs )
+    { return lhs.first < rhs.first; } );
+  for ( const auto& [ i, lag ] : emitted_spikes_ )
+  {
+    iaf_psc_alpha& node = *nodes_[ i ];
+    node.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+    SpikeEvent se;
+    kernel().event_delivery_manager.send( node, se, lag );
+  }
+  emitted_spikes_.clear();
+}
+
+void
+iaf_psc_alpha::BatchState::store()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    store_( i );
+  }
+}
+
+void
+iaf_psc_alpha::BatchState::store_( const size_t i ) const
+{
+  State_& S = nodes_[ i ]->S_;
+  S.y0_ = y0_[ i ];
+  S.dI_ex_ = dI_ex_[ i ];
+  S.I_ex_ = I_ex_[ i ];
+  S.dI_in_ = dI_in_[ i ];
+  S.I_in_ = I_in_[ i ];
+  S.y3_ = y3_[ i ];
+  S.r_ = static_cast< int >( r_[ i ] );
+}
+
 void
 iaf_psc_alpha::handle( SpikeEvent& e )
 {
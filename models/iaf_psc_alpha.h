@@ -23,11 +23,16 @@
 #ifndef IAF_PSC_ALPHA_H
 #define IAF_PSC_ALPHA_H
 
+// C++ includes:
+#include <utility>
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "node_batch_state.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -203,6 +208,14 @@ class iaf_psc_alpha : public ArchivingNode
 {
 
 public:
+  //! Nodes are updated in batches by GenericModel< iaf_psc_alpha >
+  static constexpr bool supports_batched_update = true;
+
+  //! During a run, the state of a batch of nodes is held by an iaf_psc_alpha::BatchState
+  static constexpr bool has_batch_state = true;
+
+  class BatchState;
+
   iaf_psc_alpha();
   iaf_psc_alpha( const iaf_psc_alpha& );
 
@@ -237,6 +250,16 @@ private:
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
 
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.input_buffer_ );
+  }
+
+  //! Needs access to update() for batched updates and to ring_buffers() for the memory report
+  friend class GenericModel< iaf_psc_alpha >;
+
   // ----------------------------------------------------------------
 
   struct Parameters_
@@ -403,6 +426,85 @@ private:
   static RecordablesMap< iaf_psc_alpha > recordablesMap_;
 };
 
+/**
+ * State of the non-frozen nodes of a NodeUpdateBatch of iaf_psc_alpha neurons during a run.
+ *
+ * State, parameters and propagators of all nodes are held in contiguous arrays. In each time step, one
+ * loop without branches advances the membrane potential and synaptic currents of all nodes, which the
+ * compiler can vectorize. It performs the same operations in the same order as iaf_psc_alpha::update(),
+ * so results are identical. Input is read from the ring buffers of the nodes before this loop, and the
+ * reset of nodes that crossed threshold is done after it. Spikes are sent at the end of update(), node by
+ * node, so that they enter the spike register in the same order as with per-node updates. Nodes recorded
+ * by a multimeter get their state written back before recording.
+ */
+class iaf_psc_alpha::BatchState : public NodeBatchState
+{
+public:
+  BatchState( Node* const* first, Node* const* last );
+
+  //! All nodes can be held in a BatchState
+  static bool
+  supports( Node* const*, Node* const* )
+  {
+    return true;
+  }
+
+  void update( Time const& origin, const long from, const long to ) override;
+  void store() override;
+
+private:
+  //! Write the state of node i back into the node
+  void store_( const size_t i ) const;
+
+  std::vector< iaf_psc_alpha* > nodes_;  //!< non-frozen nodes of the batch
+  std::vector< size_t > logged_;         //!< indices of nodes with a multimeter
+
+  //! @name State, see iaf_psc_alpha::State_; the refractory count is kept as double like all other arrays
+  //! @{
+  std::vector< double > y0_;
+  std::vector< double > dI_ex_;
+  std::vector< double > I_ex_;
+  std::vector< double > dI_in_;
+  std::vector< double > I_in_;
+  std::vector< double > y3_;
+  std::vector< double > r_;
+  //! @}
+
+  //! @name Parameters and propagators, see iaf_psc_alpha::Parameters_ and iaf_psc_alpha::Variables_
+  //! @{
+  std::vector< double > I_e_;
+  std::vector< double > Theta_;
+  std::vector< double > V_reset_;
+  std::vector< double > LowerBound_;
+  std::vector< double > EPSCInitialValue_;
+  std::vector< double > IPSCInitialValue_;
+  std::vector< double > RefractoryCounts_;
+  std::vector< double > P11_ex_;
+  std::vector< double > P21_ex_;
+  std::vector< double > P22_ex_;
+  std::vector< double > P31_ex_;
+  std::vector< double > P32_ex_;
+  std::vector< double > P11_in_;
+  std::vector< double > P21_in_;
+  std::vector< double > P22_in_;
+  std::vector< double > P31_in_;
+  std::vector< double > P32_in_;
+  std::vector< double > P30_;
+  std::vector< double > expm1_tau_m_;
+  //! @}
+
+  //! @name Input and threshold crossings of the current time step
+  //! @{
+  std::vector< double > weighted_spikes_ex_;
+  std::vector< double > weighted_spikes_in_;
+  std::vector< double > currents_;
+  std::vector< double > crossed_;  //!< 1.0 if the node crossed threshold, else 0.0
+  //! @}
+
+  //! Node index and lag of the spikes emitted in update()
+  std::vector< std::pair< size_t, long > > emitted_spikes_;
+};
+
 inline size_t
 nest::iaf_psc_alpha::send_test_event( Node& target, size_t receptor_type, synindex, bool )
 {
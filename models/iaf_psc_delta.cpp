@@ -25,6 +25,8 @@
 #include "iaf_psc_delta.h"
 
 // C++ includes:
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 // Includes from libnestutil:
@@ -328,6 +330,170 @@ nest::iaf_psc_delta::update( Time const& origin, const long from, const long to
   }
 }
 
+/* ----------------------------------------------------------------
+ * Update of batches of nodes held as structure of arrays
+ * ---------------------------------------------------------------- */
+
+nest::iaf_psc_delta::BatchState::BatchState( Node* const* first, Node* const* last )
+{
+  for ( ; first != last; ++first )
+  {
+    if ( not( *first )->is_frozen() )
+    {
+      nodes_.push_back( static_cast< iaf_psc_delta* >( *first ) );
+    }
+  }
+
+  const size_t n = nodes_.size();
+  for ( auto* array : { &y0_,
+          &y3_,
+          &r_,
+          &refr_spikes_buffer_,
+          &tau_m_,
+          &I_e_,
+          &V_th_,
+          &V_min_,
+          &V_reset_,
+          &with_refr_input_,
+          &RefractoryCounts_,
+          &P30_,
+          &P33_,
+          &spikes_,
+          &currents_,
+          &crossed_ } )
+  {
+    array->resize( n );
+  }
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_delta& node = *nodes_[ i ];
+
+    y0_[ i ] = node.S_.y0_;
+    y3_[ i ] = node.S_.y3_;
+    r_[ i ] = node.S_.r_;
+    refr_spikes_buffer_[ i ] = node.S_.refr_spikes_buffer_;
+
+    tau_m_[ i ] = node.P_.tau_m_;
+    I_e_[ i ] = node.P_.I_e_;
+    V_th_[ i ] = node.P_.V_th_;
+    V_min_[ i ] = node.P_.V_min_;
+    V_reset_[ i ] = node.P_.V_reset_;
+    with_refr_input_[ i ] = node.P_.with_refr_input_ ? 1.0 : 0.0;
+
+    RefractoryCounts_[ i ] = node.V_.RefractoryCounts_;
+    P30_[ i ] = node.V_.P30_;
+    P33_[ i ] = node.V_.P33_;
+
+    if ( node.B_.logger_.has_logging_devices() )
+    {
+      logged_.push_back( i );
+    }
+  }
+}
+
+void
+nest::iaf_psc_delta::BatchState::update( Time const& origin, const long from, const long to )
+{
+  const double h = Time::get_resolution().get_ms();
+  const size_t n = nodes_.size();
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // get input of this step, which also clears the ring-buffer entries
+    for ( size_t i = 0; i < n; ++i )
+    {
+      iaf_psc_delta& node = *nodes_[ i ];
+      spikes_[ i ] = node.B_.spikes_.get_value( lag );
+      currents_[ i ] = node.B_.currents_.get_value( lag );
+
+      // accumulate spikes arriving during the refractory period, discounting for decay until its end
+      if ( r_[ i ] != 0.0 and with_refr_input_[ i ] != 0.0 )
+      {
+        refr_spikes_buffer_[ i ] += spikes_[ i ] * std::exp( -r_[ i ] * h / tau_m_[ i ] );
+      }
+    }
+
+    // Same computation as in iaf_psc_delta::update(), with branches replaced by selections, see
+    // iaf_psc_alpha::BatchState::update().
+#pragma omp simd
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const double y3 = y3_[ i ];
+      const double r = r_[ i ];
+      const double refr_spikes_buffer = refr_spikes_buffer_[ i ];
+
+      // add and reset spikes accumulated during the refractory period
+      const bool add_refr_spikes = r == 0.0 and with_refr_input_[ i ] != 0.0 and refr_spikes_buffer != 0.0;
+
+      double y3_new = P30_[ i ] * ( y0_[ i ] + I_e_[ i ] ) + P33_[ i ] * y3 + spikes_[ i ];
+      y3_new = add_refr_spikes ? y3_new + refr_spikes_buffer : y3_new;
+      y3_new = y3_new < V_min_[ i ] ? V_min_[ i ] : y3_new;
+      y3_[ i ] = r == 0.0 ? y3_new : y3;
+      refr_spikes_buffer_[ i ] = add_refr_spikes ? 0.0 : refr_spikes_buffer;
+
+      // the refractory count is a non-negative integer, so this decrements it only if it is positive
+      r_[ i ] = std::max( r - 1.0, 0.0 );
+
+      crossed_[ i ] = y3_[ i ] >= V_th_[ i ] ? 1.0 : 0.0;
+
+      // set new input current
+      y0_[ i ] = currents_[ i ];
+    }
+
+    // threshold crossing, which nodes with ignore_and_spike replace by spikes at fixed intervals
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( nodes_[ i ]->spike_event_is_due( crossed_[ i ] != 0.0 ) )
+      {
+        r_[ i ] = RefractoryCounts_[ i ];
+        y3_[ i ] = V_reset_[ i ];
+        emitted_spikes_.emplace_back( i, lag );
+      }
+    }
+
+    // log state data
+    for ( const size_t i : logged_ )
+    {
+      store_( i );
+      nodes_[ i ]->B_.logger_.record_data( origin.get_steps() + lag );
+    }
+  }
+
+  // send spikes ordered by node, spikes of each node remain ordered by lag
+  std::stable_sort( emitted_spikes_.begin(),
+    emitted_spikes_.end(),
+    []( const std::pair< size_t, long >& lhs, const std::pair< size_t, long >& rhs )
+    { return lhs.first < rhs.first; } );
+  for ( const auto& [ i, lag ] : emitted_spikes_ )
+  {
+    iaf_psc_delta& node = *nodes_[ i ];
+    node.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+    SpikeEvent se;
+    kernel().event_delivery_manager.send( node, se, lag );
+  }
+  emitted_spikes_.clear();
+}
+
+void
+nest::iaf_psc_delta::BatchState::store()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    store_( i );
+  }
+}
+
+void
+nest::iaf_psc_delta::BatchState::store_( const size_t i ) const
+{
+  State_& S = nodes_[ i ]->S_;
+  S.y0_ = y0_[ i ];
+  S.y3_ = y3_[ i ];
+  S.r_ = static_cast< int >( r_[ i ] );
+  S.refr_spikes_buffer_ = refr_spikes_buffer_[ i ];
+}
+
 void
 nest::iaf_psc_delta::handle( SpikeEvent& e )
 {
@@ -23,11 +23,16 @@
 #ifndef IAF_PSC_DELTA_H
 #define IAF_PSC_DELTA_H
 
+// C++ includes:
+#include <utility>
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "node_batch_state.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
 
@@ -199,6 +204,14 @@ class iaf_psc_delta : public ArchivingNode
 {
 
 public:
+  //! Nodes are updated in batches by GenericModel< iaf_psc_delta >
+  static constexpr bool supports_batched_update = true;
+
+  //! During a run, the state of a batch of nodes is held by an iaf_psc_delta::BatchState
+  static constexpr bool has_batch_state = true;
+
+  class BatchState;
+
   iaf_psc_delta();
   iaf_psc_delta( const iaf_psc_delta& );
 
@@ -233,6 +246,16 @@ private:
   friend class RecordablesMap< iaf_psc_delta >;
   friend class UniversalDataLogger< iaf_psc_delta >;
 
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to update() for batched updates and to ring_buffers() for the memory report
+  friend class GenericModel< iaf_psc_delta >;
+
   // ----------------------------------------------------------------
 
   /**
@@ -368,6 +391,68 @@ private:
   static RecordablesMap< iaf_psc_delta > recordablesMap_;
 };
 
+/**
+ * State of the non-frozen nodes of a NodeUpdateBatch of iaf_psc_delta neurons during a run.
+ *
+ * State, parameters and propagators of all nodes are held in contiguous arrays, see iaf_psc_alpha::BatchState.
+ * Spike input arriving during the refractory period is accumulated while input is read from the ring buffers,
+ * since it needs an exponential per node. Threshold crossings are passed through
+ * IgnoreAndSpikeMechanism::spike_event_is_due() of each node after the loop over all nodes.
+ */
+class iaf_psc_delta::BatchState : public NodeBatchState
+{
+public:
+  BatchState( Node* const* first, Node* const* last );
+
+  //! All nodes can be held in a BatchState
+  static bool
+  supports( Node* const*, Node* const* )
+  {
+    return true;
+  }
+
+  void update( Time const& origin, const long from, const long to ) override;
+  void store() override;
+
+private:
+  //! Write the state of node i back into the node
+  void store_( const size_t i ) const;
+
+  std::vector< iaf_psc_delta* > nodes_;  //!< non-frozen nodes of the batch
+  std::vector< size_t > logged_;         //!< indices of nodes with a multimeter
+
+  //! @name State, see iaf_psc_delta::State_; the refractory count is kept as double like all other arrays
+  //! @{
+  std::vector< double > y0_;
+  std::vector< double > y3_;
+  std::vector< double > r_;
+  std::vector< double > refr_spikes_buffer_;
+  //! @}
+
+  //! @name Parameters and propagators, see iaf_psc_delta::Parameters_ and iaf_psc_delta::Variables_
+  //! @{
+  std::vector< double > tau_m_;
+  std::vector< double > I_e_;
+  std::vector< double > V_th_;
+  std::vector< double > V_min_;
+  std::vector< double > V_reset_;
+  std::vector< double > with_refr_input_;  //!< 1.0 if spikes arriving during refractoriness are kept, else 0.0
+  std::vector< double > RefractoryCounts_;
+  std::vector< double > P30_;
+  std::vector< double > P33_;
+  //! @}
+
+  //! @name Input and threshold crossings of the current time step
+  //! @{
+  std::vector< double > spikes_;
+  std::vector< double > currents_;
+  std::vector< double > crossed_;  //!< 1.0 if the membrane potential is at or above threshold, else 0.0
+  //! @}
+
+  //! Node index and lag of the spikes emitted in update()
+  std::vector< std::pair< size_t, long > > emitted_spikes_;
+};
+
 
 inline size_t
 nest::iaf_psc_delta::send_test_event( Node& target, size_t receptor_type, synindex, bool )
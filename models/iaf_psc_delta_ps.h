@@ -196,6 +196,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.events_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< iaf_psc_delta_ps >;
+
   /** @name Interface functions
    * @note These functions are private, so that they can be accessed
    * only through a Node*.
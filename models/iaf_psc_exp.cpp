@@ -22,6 +22,8 @@
 
 #include "iaf_psc_exp.h"
 
+// C++ includes:
+#include <algorithm>
 
 // Includes from libnestutil:
 #include "dict_util.h"
@@ -347,6 +349,192 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
   }
 }
 
+/* ----------------------------------------------------------------
+ * Update of batches of nodes held as structure of arrays
+ * ---------------------------------------------------------------- */
+
+bool
+nest::iaf_psc_exp::BatchState::supports( Node* const* first, Node* const* last )
+{
+  return std::none_of( first,
+    last,
+    []( const Node* node )
+    { return not node->is_frozen() and not( static_cast< const iaf_psc_exp* >( node )->P_.delta_ < 1e-10 ); } );
+}
+
+nest::iaf_psc_exp::BatchState::BatchState( Node* const* first, Node* const* last )
+{
+  for ( ; first != last; ++first )
+  {
+    if ( not( *first )->is_frozen() )
+    {
+      nodes_.push_back( static_cast< iaf_psc_exp* >( *first ) );
+    }
+  }
+
+  const size_t n = nodes_.size();
+  for ( auto* array : { &i_0_,
+          &i_1_,
+          &i_syn_ex_,
+          &i_syn_in_,
+          &V_m_,
+          &r_ref_,
+          &I_e_,
+          &Theta_,
+          &V_reset_,
+          &RefractoryCounts_,
+          &P20_,
+          &P11ex_,
+          &P11in_,
+          &P21ex_,
+          &P21in_,
+          &P22_,
+          &weighted_spikes_ex_,
+          &weighted_spikes_in_,
+          &currents_0_,
+          &currents_1_,
+          &crossed_ } )
+  {
+    array->resize( n );
+  }
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_exp& node = *nodes_[ i ];
+
+    i_0_[ i ] = node.S_.i_0_;
+    i_1_[ i ] = node.S_.i_1_;
+    i_syn_ex_[ i ] = node.S_.i_syn_ex_;
+    i_syn_in_[ i ] = node.S_.i_syn_in_;
+    V_m_[ i ] = node.S_.V_m_;
+    r_ref_[ i ] = node.S_.r_ref_;
+
+    I_e_[ i ] = node.P_.I_e_;
+    Theta_[ i ] = node.P_.Theta_;
+    V_reset_[ i ] = node.P_.V_reset_;
+
+    RefractoryCounts_[ i ] = node.V_.RefractoryCounts_;
+    P20_[ i ] = node.V_.P20_;
+    P11ex_[ i ] = node.V_.P11ex_;
+    P11in_[ i ] = node.V_.P11in_;
+    P21ex_[ i ] = node.V_.P21ex_;
+    P21in_[ i ] = node.V_.P21in_;
+    P22_[ i ] = node.V_.P22_;
+
+    if ( node.B_.logger_.has_logging_devices() )
+    {
+      logged_.push_back( i );
+    }
+  }
+}
+
+void
+nest::iaf_psc_exp::BatchState::update( Time const& origin, const long from, const long to )
+{
+  const size_t n = nodes_.size();
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // get input of this step and reset the input-buffer slot of each node
+    const size_t input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      MultiChannelInputBuffer< Buffers_::NUM_INPUT_CHANNELS >& input_buffer = nodes_[ i ]->B_.input_buffer_;
+      const auto& input = input_buffer.get_values_all_channels( input_buffer_slot );
+      weighted_spikes_ex_[ i ] = input[ Buffers_::SYN_EX ];
+      weighted_spikes_in_[ i ] = input[ Buffers_::SYN_IN ];
+      currents_0_[ i ] = input[ Buffers_::I0 ];
+      currents_1_[ i ] = input[ Buffers_::I1 ];
+      input_buffer.reset_values_all_channels( input_buffer_slot );
+    }
+
+    // Same computation as in iaf_psc_exp::update() for deterministic threshold, with branches replaced by
+    // selections, see iaf_psc_alpha::BatchState::update().
+#pragma omp simd
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const double V_m = V_m_[ i ];
+      const double r_ref = r_ref_[ i ];
+      double i_syn_ex = i_syn_ex_[ i ];
+      double i_syn_in = i_syn_in_[ i ];
+
+      const double V_m_new =
+        V_m * P22_[ i ] + i_syn_ex * P21ex_[ i ] + i_syn_in * P21in_[ i ] + ( I_e_[ i ] + i_0_[ i ] ) * P20_[ i ];
+      V_m_[ i ] = r_ref == 0.0 ? V_m_new : V_m;
+
+      // the refractory count is a non-negative integer, so this decrements it only if it is positive
+      r_ref_[ i ] = std::max( r_ref - 1.0, 0.0 );
+
+      // exponential decaying PSCs and evolution of presynaptic input current, spikes arriving at T+1 have an
+      // immediate effect on the state of the neuron
+      i_syn_ex *= P11ex_[ i ];
+      i_syn_in *= P11in_[ i ];
+      i_syn_ex += ( 1. - P11ex_[ i ] ) * i_1_[ i ];
+      i_syn_ex_[ i ] = i_syn_ex + weighted_spikes_ex_[ i ];
+      i_syn_in_[ i ] = i_syn_in + weighted_spikes_in_[ i ];
+
+      crossed_[ i ] = V_m_[ i ] >= Theta_[ i ] ? 1.0 : 0.0;
+
+      // set new input current
+      i_0_[ i ] = currents_0_[ i ];
+      i_1_[ i ] = currents_1_[ i ];
+    }
+
+    // threshold crossing
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( crossed_[ i ] != 0.0 )
+      {
+        r_ref_[ i ] = RefractoryCounts_[ i ];
+        V_m_[ i ] = V_reset_[ i ];
+        emitted_spikes_.emplace_back( i, lag );
+      }
+    }
+
+    // log state data
+    for ( const size_t i : logged_ )
+    {
+      store_( i );
+      nodes_[ i ]->B_.logger_.record_data( origin.get_steps() + lag );
+    }
+  }
+
+  // send spikes ordered by node, spikes of each node remain ordered by lag
+  std::stable_sort( emitted_spikes_.begin(),
+    emitted_spikes_.end(),
+    []( const std::pair< size_t, long >& lhs, const std::pair< size_t, long >& rhs )
+    { return lhs.first < rhs.first; } );
+  for ( const auto& [ i, lag ] : emitted_spikes_ )
+  {
+    iaf_psc_exp& node = *nodes_[ i ];
+    node.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+    SpikeEvent se;
+    kernel().event_delivery_manager.send( node, se, lag );
+  }
+  emitted_spikes_.clear();
+}
+
+void
+nest::iaf_psc_exp::BatchState::store()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    store_( i );
+  }
+}
+
+void
+nest::iaf_psc_exp::BatchState::store_( const size_t i ) const
+{
+  State_& S = nodes_[ i ]->S_;
+  S.i_0_ = i_0_[ i ];
+  S.i_1_ = i_1_[ i ];
+  S.i_syn_ex_ = i_syn_ex_[ i ];
+  S.i_syn_in_ = i_syn_in_[ i ];
+  S.V_m_ = V_m_[ i ];
+  S.r_ref_ = static_cast< int >( r_ref_[ i ] );
+}
+
 void
 nest::iaf_psc_exp::handle( SpikeEvent& e )
 {
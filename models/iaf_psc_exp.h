@@ -23,11 +23,16 @@
 #ifndef IAF_PSC_EXP_H
 #define IAF_PSC_EXP_H
 
+// C++ includes:
+#include <utility>
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "node_batch_state.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -243,6 +248,14 @@ class iaf_psc_exp : public ArchivingNode
 {
 
 public:
+  //! Nodes are updated in batches by GenericModel< iaf_psc_exp >
+  static constexpr bool supports_batched_update = true;
+
+  //! During a run, the state of a batch of nodes with deterministic threshold is held by an iaf_psc_exp::BatchState
+  static constexpr bool has_batch_state = true;
+
+  class BatchState;
+
   iaf_psc_exp();
   iaf_psc_exp( const iaf_psc_exp& );
 
@@ -280,6 +293,16 @@ private:
   friend class RecordablesMap< iaf_psc_exp >;
   friend class UniversalDataLogger< iaf_psc_exp >;
 
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.input_buffer_ );
+  }
+
+  //! Needs access to update() for batched updates and to ring_buffers() for the memory report
+  friend class GenericModel< iaf_psc_exp >;
+
   // ----------------------------------------------------------------
 
   /**
@@ -455,6 +478,68 @@ private:
   static RecordablesMap< iaf_psc_exp > recordablesMap_;
 };
 
+/**
+ * State of the non-frozen nodes of a NodeUpdateBatch of iaf_psc_exp neurons during a run.
+ *
+ * State, parameters and propagators of all nodes are held in contiguous arrays, see iaf_psc_alpha::BatchState.
+ * Batches containing nodes with stochastic threshold are updated node by node instead, since the nodes of a
+ * thread share one random number generator and batched updates would draw from it in a different order.
+ */
+class iaf_psc_exp::BatchState : public NodeBatchState
+{
+public:
+  BatchState( Node* const* first, Node* const* last );
+
+  //! Whether no non-frozen node in the range has a stochastic threshold
+  static bool supports( Node* const* first, Node* const* last );
+
+  void update( Time const& origin, const long from, const long to ) override;
+  void store() override;
+
+private:
+  //! Write the state of node i back into the node
+  void store_( const size_t i ) const;
+
+  std::vector< iaf_psc_exp* > nodes_;  //!< non-frozen nodes of the batch
+  std::vector< size_t > logged_;       //!< indices of nodes with a multimeter
+
+  //! @name State, see iaf_psc_exp::State_; the refractory count is kept as double like all other arrays
+  //! @{
+  std::vector< double > i_0_;
+  std::vector< double > i_1_;
+  std::vector< double > i_syn_ex_;
+  std::vector< double > i_syn_in_;
+  std::vector< double > V_m_;
+  std::vector< double > r_ref_;
+  //! @}
+
+  //! @name Parameters and propagators, see iaf_psc_exp::Parameters_ and iaf_psc_exp::Variables_
+  //! @{
+  std::vector< double > I_e_;
+  std::vector< double > Theta_;
+  std::vector< double > V_reset_;
+  std::vector< double > RefractoryCounts_;
+  std::vector< double > P20_;
+  std::vector< double > P11ex_;
+  std::vector< double > P11in_;
+  std::vector< double > P21ex_;
+  std::vector< double > P21in_;
+  std::vector< double > P22_;
+  //! @}
+
+  //! @name Input and threshold crossings of the current time step
+  //! @{
+  std::vector< double > weighted_spikes_ex_;
+  std::vector< double > weighted_spikes_in_;
+  std::vector< double > currents_0_;
+  std::vector< double > currents_1_;
+  std::vector< double > crossed_;  //!< 1.0 if the node crossed threshold, else 0.0
+  //! @}
+
+  //! Node index and lag of the spikes emitted in update()
+  std::vector< std::pair< size_t, long > > emitted_spikes_;
+};
+
 
 inline size_t
 nest::iaf_psc_exp::send_test_event( Node& target, size_t receptor_type, synindex, bool )
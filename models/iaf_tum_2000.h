@@ -188,6 +188,16 @@ public:
   }
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.input_buffer_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< iaf_tum_2000 >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
 
@@ -130,6 +130,16 @@ public:
   void set_status( const Dictionary& );
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.input_buffer_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< ignore_and_fire >;
+
   void init_buffers_();
   void pre_run_hook();
 
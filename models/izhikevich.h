@@ -168,6 +168,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.spikes_, B_.currents_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< izhikevich >;
+
   friend class RecordablesMap< izhikevich >;
   friend class UniversalDataLogger< izhikevich >;
 
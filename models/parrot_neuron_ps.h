@@ -28,6 +28,7 @@
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "ring_buffer.h"
 #include "slice_ring_buffer.h"
 
 namespace nest
@@ -112,6 +113,16 @@ public:
   }
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.events_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< parrot_neuron_ps >;
+
   void init_buffers_() override;
 
   void
@@ -141,6 +141,11 @@ public:
    */
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< quantal_stp_synapse > get_double_parameter_setter( const std::string& name );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -174,7 +179,19 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
+  //! Setters for parameters, throw BadProperty for invalid values
+  void set_U_( const double U );
+  void set_u_( const double u );
+  void set_tau_rec_( const double tau_rec );
+  void set_tau_fac_( const double tau_fac );
+
   double weight_;       //!< synaptic weight
   double U_;            //!< unit increment of a facilitating synapse (U)
   double u_;            //!< dynamic value of probability of release
@@ -70,32 +70,92 @@ quantal_stp_synapse< targetidentifierT >::set_status( const Dictionary& d, Conne
 
   d.update_value( names::weight, weight_ );
 
-  d.update_value( names::dU, U_ );
-  d.update_value( names::u, u_ );
-  d.update_value( names::tau_rec, tau_rec_ );
-  d.update_value( names::tau_fac, tau_fac_ );
+  double value;
+  if ( d.update_value( names::dU, value ) )
+  {
+    set_U_( value );
+  }
+  if ( d.update_value( names::u, value ) )
+  {
+    set_u_( value );
+  }
+  if ( d.update_value( names::tau_rec, value ) )
+  {
+    set_tau_rec_( value );
+  }
+  if ( d.update_value( names::tau_fac, value ) )
+  {
+    set_tau_fac_( value );
+  }
   d.update_integer_value( names::n, n_ );
   d.update_integer_value( names::a, a_ );
+}
+
+template < typename targetidentifierT >
+DoubleParameterSetter< quantal_stp_synapse< targetidentifierT > >
+quantal_stp_synapse< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::dU )
+  {
+    return []( quantal_stp_synapse& c, const double U ) { c.set_U_( U ); };
+  }
+  if ( name == names::u )
+  {
+    return []( quantal_stp_synapse& c, const double u ) { c.set_u_( u ); };
+  }
+  if ( name == names::tau_rec )
+  {
+    return []( quantal_stp_synapse& c, const double tau_rec ) { c.set_tau_rec_( tau_rec ); };
+  }
+  if ( name == names::tau_fac )
+  {
+    return []( quantal_stp_synapse& c, const double tau_fac ) { c.set_tau_fac_( tau_fac ); };
+  }
+  return nullptr;
+}
 
-  if ( U_ > 1.0 or U_ < 0.0 )
+template < typename targetidentifierT >
+void
+quantal_stp_synapse< targetidentifierT >::set_U_( const double U )
+{
+  if ( U > 1.0 or U < 0.0 )
   {
     throw BadProperty( "'U' must be in [0,1]." );
   }
+  U_ = U;
+}
 
-  if ( u_ > 1.0 or u_ < 0.0 )
+template < typename targetidentifierT >
+void
+quantal_stp_synapse< targetidentifierT >::set_u_( const double u )
+{
+  if ( u > 1.0 or u < 0.0 )
   {
     throw BadProperty( "'u' must be in [0,1]." );
   }
+  u_ = u;
+}
 
-  if ( tau_rec_ <= 0.0 )
+template < typename targetidentifierT >
+void
+quantal_stp_synapse< targetidentifierT >::set_tau_rec_( const double tau_rec )
+{
+  if ( tau_rec <= 0.0 )
   {
     throw BadProperty( "'tau_rec' must be > 0." );
   }
+  tau_rec_ = tau_rec;
+}
 
-  if ( tau_fac_ < 0.0 )
+template < typename targetidentifierT >
+void
+quantal_stp_synapse< targetidentifierT >::set_tau_fac_( const double tau_fac )
+{
+  if ( tau_fac < 0.0 )
   {
     throw BadProperty( "'tau_fac' must be >= 0." );
   }
+  tau_fac_ = tau_fac;
 }
 
 }  // of namespace nest
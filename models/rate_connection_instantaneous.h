@@ -86,6 +86,7 @@ public:
   typedef Connection< targetidentifierT > ConnectionBase;
 
   static constexpr ConnectionModelProperties properties = ConnectionModelProperties::SUPPORTS_WFR;
+  static constexpr bool has_plain_delay = false;
 
   /**
    * Default Constructor.
@@ -145,6 +146,12 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
   void
   set_delay( double )
   {
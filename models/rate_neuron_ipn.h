@@ -144,6 +144,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.delayed_rates_ex_, B_.delayed_rates_in_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< rate_neuron_ipn >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
 
@@ -144,6 +144,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.delayed_rates_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< rate_transformer_node >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
 
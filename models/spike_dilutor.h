@@ -123,6 +123,16 @@ public:
   void set_status( const Dictionary& ) override;
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.n_spikes_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< spike_dilutor >;
+
   void init_state_() override;
   void init_buffers_() override;
   void pre_run_hook() override;
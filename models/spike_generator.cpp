@@ -50,6 +50,8 @@ nest::spike_generator::Parameters_::Parameters_()
   , precise_times_( false )
   , allow_offgrid_times_( false )
   , shift_now_spikes_( false )
+  , spike_train_file_()
+  , spike_train_sender_( -1 )
 {
 }
 
@@ -79,10 +81,26 @@ nest::spike_generator::Parameters_::get( Dictionary& d ) const
   d[ names::precise_times ] = precise_times_;
   d[ names::allow_offgrid_times ] = allow_offgrid_times_;
   d[ names::shift_now_spikes ] = shift_now_spikes_;
+  d[ names::spike_train_file ] = spike_train_file_ ? spike_train_file_->get_filename() : std::string();
+  d[ names::spike_train_sender ] = spike_train_sender_;
 }
 
 void
 nest::spike_generator::Parameters_::assert_valid_spike_time_and_insert_( double t, const Time& origin, const Time& now )
+{
+  double offset = 0.0;
+  spike_stamps_.push_back( get_valid_spike_stamp_( t, origin, now, offset ) );
+  if ( precise_times_ )
+  {
+    spike_offsets_.push_back( offset );
+  }
+}
+
+nest::Time
+nest::spike_generator::Parameters_::get_valid_spike_stamp_( double t,
+  const Time& origin,
+  const Time& now,
+  double& offset ) const
 {
   if ( t == 0.0 and not shift_now_spikes_ )
   {
@@ -124,15 +142,13 @@ nest::spike_generator::Parameters_::assert_valid_spike_time_and_insert_( double
   }
   // when we get here, we know that the spike time is valid and
   // t_spike is the correct time stamp given the chosen options
-  spike_stamps_.push_back( t_spike );
-
   if ( precise_times_ )
   {
     // t_spike is created with ms_stamp() that aligns the time to the next
     // resolution step, so the offset has to be greater or equal to t by
     // construction. Since subtraction of close-by floating point values is
     // not stable, we have to compare with a delta.
-    double offset = t_spike.get_ms() - t;
+    offset = t_spike.get_ms() - t;
 
     // The second part of the test handles subnormal values of offset.
     if ( ( std::fabs( offset ) < std::numeric_limits< double >::epsilon() * std::fabs( t_spike.get_ms() + t ) * 2.0 )
@@ -142,8 +158,9 @@ nest::spike_generator::Parameters_::assert_valid_spike_time_and_insert_( double
       offset = 0.0;
     }
     assert( offset >= 0.0 );
-    spike_offsets_.push_back( offset );
   }
+
+  return t_spike;
 }
 
 void
@@ -164,6 +181,19 @@ nest::spike_generator::Parameters_::set( const Dictionary& d,
       "allow_offgrid_times or shift_now_spikes is set to true." );
   }
 
+  bool updated_spike_train_file = false;
+  std::string filename;
+  if ( d.update_value( names::spike_train_file, filename ) )
+  {
+    spike_train_file_ = filename.empty() ? nullptr : SpikeTrainFile::open( filename );
+    updated_spike_train_file = true;
+  }
+  const bool updated_spike_train_sender = update_value_param( d, names::spike_train_sender, spike_train_sender_, node );
+  if ( spike_train_sender_ < -1 or spike_train_sender_ == 0 )
+  {
+    throw BadProperty( "spike_train_sender must be a node ID or -1 for the node ID of the generator." );
+  }
+
   const bool updated_spike_times = d.known( names::spike_times );
   if ( flags_changed and not( updated_spike_times or spike_stamps_.empty() ) )
   {
@@ -254,8 +284,16 @@ nest::spike_generator::Parameters_::set( const Dictionary& d,
     }
   }
 
+  if ( spike_train_file_ and not( spike_stamps_.empty() and spike_weights_.empty() and spike_multiplicities_.empty() ) )
+  {
+    throw BadProperty(
+      "spike_times, spike_weights and spike_multiplicities cannot be used "
+      "together with spike_train_file." );
+  }
+
   // Set position to start if something changed
-  if ( updated_spike_times or updated_spike_weights or updated_spike_multiplicities or d.known( names::origin ) )
+  if ( updated_spike_times or updated_spike_weights or updated_spike_multiplicities or updated_spike_train_file
+    or updated_spike_train_sender or d.known( names::origin ) )
   {
     s.position_ = 0;
   }
@@ -272,6 +310,21 @@ nest::spike_generator::State_::State_()
 }
 
 
+nest::spike_generator::Buffers_::Buffers_()
+  : file_spikes_( nullptr )
+  , num_file_spikes_( 0 )
+  , file_spikes_bound_( false )
+{
+}
+
+nest::spike_generator::Buffers_::Buffers_( const Buffers_& )
+  : file_spikes_( nullptr )
+  , num_file_spikes_( 0 )
+  , file_spikes_bound_( false )
+{
+}
+
+
 /* ----------------------------------------------------------------
  * Default and copy constructor for node
  * ---------------------------------------------------------------- */
@@ -280,6 +333,7 @@ nest::spike_generator::spike_generator()
   : StimulationDevice()
   , P_()
   , S_()
+  , B_()
 {
 }
 
@@ -287,6 +341,7 @@ nest::spike_generator::spike_generator( const spike_generator& n )
   : StimulationDevice( n )
   , P_( n.P_ )
   , S_( n.S_ )
+  , B_( n.B_ )
 {
 }
 
@@ -305,12 +360,35 @@ void
 nest::spike_generator::init_buffers_()
 {
   StimulationDevice::init_buffers();
+  B_.file_spikes_bound_ = false;
 }
 
 void
 nest::spike_generator::pre_run_hook()
 {
   StimulationDevice::pre_run_hook();
+
+  if ( not P_.spike_train_file_ )
+  {
+    B_.file_spikes_ = nullptr;
+    B_.num_file_spikes_ = 0;
+  }
+  else if ( not B_.file_spikes_bound_ )
+  {
+    // Find the spike train of the sender and check all its spike times once,
+    // so that update() can convert them without further checks.
+    const uint64_t sender = P_.spike_train_sender_ < 0 ? get_node_id() : P_.spike_train_sender_;
+    const SpikeTrainFile::Spike* end;
+    P_.spike_train_file_->get_spikes( sender, B_.file_spikes_, end );
+    B_.num_file_spikes_ = end - B_.file_spikes_;
+
+    double offset;
+    for ( const SpikeTrainFile::Spike* spike = B_.file_spikes_; spike != end; ++spike )
+    {
+      P_.get_valid_spike_stamp_( spike->time, StimulationDevice::get_origin(), Time::neg_inf(), offset );
+    }
+    B_.file_spikes_bound_ = true;
+  }
 }
 
 
@@ -320,12 +398,13 @@ nest::spike_generator::pre_run_hook()
 void
 nest::spike_generator::update( Time const& sliceT0, const long from, const long to )
 {
-  if ( P_.spike_stamps_.empty() )
+  const size_t num_spikes = get_num_spikes_();
+  if ( num_spikes == 0 )
   {
     return;
   }
 
-  assert( not P_.precise_times_ or P_.spike_stamps_.size() == P_.spike_offsets_.size() );
+  assert( not P_.precise_times_ or P_.spike_train_file_ or P_.spike_stamps_.size() == P_.spike_offsets_.size() );
   assert( P_.spike_weights_.empty() or P_.spike_stamps_.size() == P_.spike_weights_.size() );
   assert( P_.spike_multiplicities_.empty() or P_.spike_stamps_.size() == P_.spike_multiplicities_.size() );
 
@@ -334,9 +413,10 @@ nest::spike_generator::update( Time const& sliceT0, const long from, const long
   const Time& origin = StimulationDevice::get_origin();
 
   // We fire all spikes with time stamps up to including sliceT0 + to
-  while ( S_.position_ < P_.spike_stamps_.size() )
+  while ( S_.position_ < num_spikes )
   {
-    const Time tnext_stamp = origin + P_.spike_stamps_[ S_.position_ ];
+    double offset;
+    const Time tnext_stamp = origin + get_spike_stamp_( S_.position_, offset );
 
     // this might happen due to wrong usage of the generator
     if ( tnext_stamp <= tstart )
@@ -351,42 +431,50 @@ nest::spike_generator::update( Time const& sliceT0, const long from, const long
 
     if ( StimulationDevice::is_active( tnext_stamp ) )
     {
-      SpikeEvent* se;
-
       // if we have to deliver weighted spikes, we need to get the
       // event back to set its weight according to the entry in
       // spike_weights_, so we use a DSSpike event and event_hook()
-      if ( not P_.spike_weights_.empty() )
-      {
-        se = new DSSpikeEvent;
-      }
-      else
-      {
-        se = new SpikeEvent;
-      }
+      DSSpikeEvent weighted_se;
+      SpikeEvent plain_se;
+      SpikeEvent& se = P_.spike_weights_.empty() ? plain_se : weighted_se;
 
       if ( P_.precise_times_ )
       {
-        se->set_offset( P_.spike_offsets_[ S_.position_ ] );
+        se.set_offset( offset );
       }
 
       if ( not P_.spike_multiplicities_.empty() )
       {
-        se->set_multiplicity( P_.spike_multiplicities_[ S_.position_ ] );
+        se.set_multiplicity( P_.spike_multiplicities_[ S_.position_ ] );
       }
 
       // we need to subtract one from stamp which is added again in send()
       long lag = Time( tnext_stamp - sliceT0 ).get_steps() - 1;
 
       // all spikes are sent locally, so offset information is always preserved
-      kernel().event_delivery_manager.send( *this, *se, lag );
-      delete se;
+      kernel().event_delivery_manager.send( *this, se, lag );
     }
 
     ++S_.position_;
   }
 }
 
+nest::Time
+nest::spike_generator::get_spike_stamp_( const size_t position, double& offset ) const
+{
+  if ( P_.spike_train_file_ )
+  {
+    // spike times in the file have been checked when binding the spike train
+    return P_.get_valid_spike_stamp_( B_.file_spikes_[ position ].time, Time(), Time::neg_inf(), offset );
+  }
+
+  if ( P_.precise_times_ )
+  {
+    offset = P_.spike_offsets_[ position ];
+  }
+  return P_.spike_stamps_[ position ];
+}
+
 void
 nest::spike_generator::event_hook( DSSpikeEvent& e )
 {
@@ -25,6 +25,7 @@
 
 
 // C++ includes:
+#include <memory>
 #include <vector>
 
 // Includes from nestkernel:
@@ -33,6 +34,7 @@
 #include "event.h"
 #include "nest_time.h"
 #include "nest_types.h"
+#include "spike_train_file.h"
 #include "stimulation_device.h"
 
 namespace nest
@@ -208,6 +210,38 @@ allow_offgrid_times
 shift_now_spikes
     See above.
 
+spike_train_file
+    Name of a binary file to read the spike times from instead of
+    `spike_times`, see below. Set to an empty string to stop reading
+    from the file.
+
+spike_train_sender
+    Sender in the spike train file whose spikes the generator emits.
+    Default: -1, which stands for the node ID of the generator.
+
+Read spike times from a file
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+For large recorded datasets, keeping all spike times in the memory of
+every generator on every thread is prohibitive. Spike times can instead
+be read from a binary spike train file written with
+``nest.write_spike_train_file()``. The file is mapped into memory and
+shared by all generators and spike train injectors reading from it;
+each generator only keeps its position in the spike train of its sender.
+
+::
+
+    nest.write_spike_train_file("spikes.bin", senders, times)
+    sg = nest.Create("spike_generator", 100)
+    sg.set(spike_train_file="spikes.bin",
+           spike_train_sender=list(range(1, 101)))
+
+The spike times of the sender are interpreted according to the options
+above, relative to the origin of the generator. `spike_weights` and
+`spike_multiplicities` are not supported for spike trains read from a
+file, and ``shift_now_spikes`` has no effect. The file must not change
+while it is in use.
+
 Set spike times from a stimulation backend
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
@@ -283,6 +317,19 @@ private:
 
   // ------------------------------------------------------------
 
+  struct Buffers_
+  {
+    Buffers_();
+    Buffers_( const Buffers_& );
+
+    //! Spike train of the sender in the spike train file, bound in pre_run_hook()
+    const SpikeTrainFile::Spike* file_spikes_;
+    size_t num_file_spikes_;
+    bool file_spikes_bound_;
+  };
+
+  // ------------------------------------------------------------
+
   struct Parameters_
   {
     //! Spike time stamp as Time, rel to origin_
@@ -304,6 +351,12 @@ private:
     //! Shift spike times at present to next step
     bool shift_now_spikes_;
 
+    //! File to read spike times from instead of spike_stamps_, if set
+    std::shared_ptr< const SpikeTrainFile > spike_train_file_;
+
+    //! Sender in spike_train_file_, -1 for the node ID of the generator
+    long spike_train_sender_;
+
     Parameters_();  //!< Sets default parameter values
     Parameters_( const Parameters_& ) = default;
     Parameters_& operator=( const Parameters_& ) = default;
@@ -326,12 +379,29 @@ private:
      * @param current simulation time
      */
     void assert_valid_spike_time_and_insert_( double, const Time&, const Time& );
+
+    /**
+     * Return time stamp of spike time, throw BadProperty for invalid spike times.
+     *
+     * @param spike time, ms
+     * @param origin
+     * @param current simulation time
+     * @param offset of precise spike time, set if precise_times_
+     */
+    Time get_valid_spike_stamp_( double, const Time&, const Time&, double& ) const;
   };
 
   // ------------------------------------------------------------
 
+  //! Return number of spikes in the spike train, from the file or spike_times
+  size_t get_num_spikes_() const;
+
+  //! Return time stamp and set offset of spike at given position
+  Time get_spike_stamp_( size_t, double& ) const;
+
   Parameters_ P_;
   State_ S_;
+  Buffers_ B_;
 };
 
 inline size_t
@@ -388,6 +458,15 @@ nest::spike_generator::set_status( const Dictionary& d )
 
   // if we get here, temporary contains consistent set of properties
   P_ = ptmp;
+
+  // the spike train needs to be bound again in case file, sender or options changed
+  B_.file_spikes_bound_ = false;
+}
+
+inline size_t
+spike_generator::get_num_spikes_() const
+{
+  return P_.spike_train_file_ ? B_.num_file_spikes_ : P_.spike_stamps_.size();
 }
 
 inline StimulationDevice::Type
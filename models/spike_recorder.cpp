@@ -42,11 +42,13 @@ nest::register_spike_recorder( const std::string& name )
 
 nest::spike_recorder::spike_recorder()
   : RecordingDevice()
+  , events_()
 {
 }
 
 nest::spike_recorder::spike_recorder( const spike_recorder& n )
   : RecordingDevice( n )
+  , events_()
 {
 }
 
@@ -54,12 +56,25 @@ void
 nest::spike_recorder::pre_run_hook()
 {
   RecordingDevice::pre_run_hook( RecordingBackend::NO_DOUBLE_VALUE_NAMES, RecordingBackend::NO_LONG_VALUE_NAMES );
+
+  // Events from devices are delivered immediately and can arrive after update() in the last slice of a run
+  kernel().io_manager.register_buffering_device( *this );
 }
 
 void
 nest::spike_recorder::update( Time const&, const long, const long )
 {
-  // Nothing to do. Writing to the backend happens in handle().
+  flush_buffered_events();
+}
+
+void
+nest::spike_recorder::flush_buffered_events()
+{
+  if ( not events_.empty() )
+  {
+    write_batch( events_ );
+    events_.clear();
+  }
 }
 
 nest::RecordingDevice::Type
@@ -106,7 +121,7 @@ nest::spike_recorder::handle( SpikeEvent& e )
 
     for ( size_t i = 0; i < e.get_multiplicity(); ++i )
     {
-      write( e, RecordingBackend::NO_DOUBLE_VALUES, RecordingBackend::NO_LONG_VALUES );
+      events_.push_back( e );
     }
   }
 }
@@ -130,9 +130,14 @@ public:
   void get_status( Dictionary& ) const override;
   void set_status( const Dictionary& ) override;
 
+  void flush_buffered_events() override;
+
 private:
   void pre_run_hook() override;
   void update( Time const&, const long, const long ) override;
+
+  //! Events received since the last update, written to the backend as one batch
+  std::vector< SpikeEvent > events_;
 };
 
 inline size_t
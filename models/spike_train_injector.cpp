@@ -52,6 +52,8 @@ spike_train_injector::Parameters_::Parameters_()
   , precise_times_( false )
   , allow_offgrid_times_( false )
   , shift_now_spikes_( false )
+  , spike_train_file_()
+  , spike_train_sender_( -1 )
 {
 }
 
@@ -80,10 +82,26 @@ spike_train_injector::Parameters_::get( Dictionary& d ) const
   d[ names::precise_times ] = precise_times_;
   d[ names::allow_offgrid_times ] = allow_offgrid_times_;
   d[ names::shift_now_spikes ] = shift_now_spikes_;
+  d[ names::spike_train_file ] = spike_train_file_ ? spike_train_file_->get_filename() : std::string();
+  d[ names::spike_train_sender ] = spike_train_sender_;
 }
 
 void
 spike_train_injector::Parameters_::assert_valid_spike_time_and_insert_( double t, const Time& origin, const Time& now )
+{
+  double offset = 0.0;
+  spike_stamps_.push_back( get_valid_spike_stamp_( t, origin, now, offset ) );
+  if ( precise_times_ )
+  {
+    spike_offsets_.push_back( offset );
+  }
+}
+
+Time
+spike_train_injector::Parameters_::get_valid_spike_stamp_( double t,
+  const Time& origin,
+  const Time& now,
+  double& offset ) const
 {
   if ( t == 0.0 and not shift_now_spikes_ )
   {
@@ -126,14 +144,13 @@ spike_train_injector::Parameters_::assert_valid_spike_time_and_insert_( double t
   // t_spike is now the correct time stamp given the chosen options
 
   // when we get here, we know that the spike time is valid
-  spike_stamps_.push_back( t_spike );
   if ( precise_times_ )
   {
     // t_spike is created with ms_stamp() that aligns the time to the next
     // resolution step, so the offset has to be greater or equal to t by
     // construction. Since subtraction of close-by floating point values is
     // not stable, we have to compare with a delta.
-    double offset = t_spike.get_ms() - t;
+    offset = t_spike.get_ms() - t;
 
     // The second part of the test handles subnormal values of offset.
     if ( ( std::fabs( offset ) < std::numeric_limits< double >::epsilon() * std::fabs( t_spike.get_ms() + t ) * 2.0 )
@@ -143,8 +160,9 @@ spike_train_injector::Parameters_::assert_valid_spike_time_and_insert_( double t
       offset = 0.0;
     }
     assert( offset >= 0.0 );
-    spike_offsets_.push_back( offset );
   }
+
+  return t_spike;
 }
 
 void
@@ -166,6 +184,19 @@ spike_train_injector::Parameters_::set( const Dictionary& d,
       "allow_offgrid_times or shift_now_spikes is set to true." );
   }
 
+  bool updated_spike_train_file = false;
+  std::string filename;
+  if ( d.update_value( names::spike_train_file, filename ) )
+  {
+    spike_train_file_ = filename.empty() ? nullptr : SpikeTrainFile::open( filename );
+    updated_spike_train_file = true;
+  }
+  const bool updated_spike_train_sender = update_value_param( d, names::spike_train_sender, spike_train_sender_, node );
+  if ( spike_train_sender_ < -1 or spike_train_sender_ == 0 )
+  {
+    throw BadProperty( "spike_train_sender must be a node ID or -1 for the node ID of the neuron." );
+  }
+
   const bool updated_spike_times = d.known( names::spike_times );
   if ( flags_changed and not( updated_spike_times or spike_stamps_.empty() ) )
   {
@@ -232,8 +263,14 @@ spike_train_injector::Parameters_::set( const Dictionary& d,
     }
   }
 
+  if ( spike_train_file_ and not( spike_stamps_.empty() and spike_multiplicities_.empty() ) )
+  {
+    throw BadProperty( "spike_times and spike_multiplicities cannot be used together with spike_train_file." );
+  }
+
   // Set position to start if something changed
-  if ( updated_spike_times or updated_spike_multiplicities or d.known( names::origin ) )
+  if ( updated_spike_times or updated_spike_multiplicities or updated_spike_train_file or updated_spike_train_sender
+    or d.known( names::origin ) )
   {
     s.position_ = 0;
   }
@@ -250,6 +287,21 @@ spike_train_injector::State_::State_()
 }
 
 
+spike_train_injector::Buffers_::Buffers_()
+  : file_spikes_( nullptr )
+  , num_file_spikes_( 0 )
+  , file_spikes_bound_( false )
+{
+}
+
+spike_train_injector::Buffers_::Buffers_( const Buffers_& )
+  : file_spikes_( nullptr )
+  , num_file_spikes_( 0 )
+  , file_spikes_bound_( false )
+{
+}
+
+
 /* ----------------------------------------------------------------
  * Default and copy constructor for node
  * ---------------------------------------------------------------- */
@@ -259,6 +311,7 @@ spike_train_injector::spike_train_injector()
   , Device()
   , S_()
   , P_()
+  , B_()
 {
 }
 
@@ -267,6 +320,7 @@ spike_train_injector::spike_train_injector( const spike_train_injector& n )
   , Device( n )
   , S_( n.S_ )
   , P_( n.P_ )
+  , B_( n.B_ )
 {
 }
 
@@ -284,6 +338,7 @@ spike_train_injector::init_state_()
 void
 spike_train_injector::init_buffers_()
 {
+  B_.file_spikes_bound_ = false;
 }
 
 void
@@ -307,6 +362,28 @@ spike_train_injector::pre_run_hook()
   }
 
   Device::pre_run_hook();
+
+  if ( not P_.spike_train_file_ )
+  {
+    B_.file_spikes_ = nullptr;
+    B_.num_file_spikes_ = 0;
+  }
+  else if ( not B_.file_spikes_bound_ )
+  {
+    // Find the spike train of the sender and check all its spike times once,
+    // so that update() can convert them without further checks.
+    const uint64_t sender = P_.spike_train_sender_ < 0 ? get_node_id() : P_.spike_train_sender_;
+    const SpikeTrainFile::Spike* end;
+    P_.spike_train_file_->get_spikes( sender, B_.file_spikes_, end );
+    B_.num_file_spikes_ = end - B_.file_spikes_;
+
+    double offset;
+    for ( const SpikeTrainFile::Spike* spike = B_.file_spikes_; spike != end; ++spike )
+    {
+      P_.get_valid_spike_stamp_( spike->time, Device::get_origin(), Time::neg_inf(), offset );
+    }
+    B_.file_spikes_bound_ = true;
+  }
 }
 
 
@@ -324,12 +401,13 @@ spike_train_injector::is_active( const Time& T ) const
 void
 spike_train_injector::update( Time const& sliceT0, const long from, const long to )
 {
-  if ( P_.spike_stamps_.empty() )
+  const size_t num_spikes = get_num_spikes_();
+  if ( num_spikes == 0 )
   {
     return;
   }
 
-  assert( not P_.precise_times_ or P_.spike_stamps_.size() == P_.spike_offsets_.size() );
+  assert( not P_.precise_times_ or P_.spike_train_file_ or P_.spike_stamps_.size() == P_.spike_offsets_.size() );
   assert( P_.spike_multiplicities_.empty() or P_.spike_stamps_.size() == P_.spike_multiplicities_.size() );
 
   const Time tstart = sliceT0 + Time::step( from );
@@ -337,9 +415,10 @@ spike_train_injector::update( Time const& sliceT0, const long from, const long t
   const Time& origin = Device::get_origin();
 
   // We fire all spikes with time stamps up to including sliceT0 + to
-  while ( S_.position_ < P_.spike_stamps_.size() )
+  while ( S_.position_ < num_spikes )
   {
-    const Time tnext_stamp = origin + P_.spike_stamps_[ S_.position_ ];
+    double offset;
+    const Time tnext_stamp = origin + get_spike_stamp_( S_.position_, offset );
 
     // this might happen due to wrong usage of the generator
     if ( tnext_stamp <= tstart )
@@ -360,7 +439,7 @@ spike_train_injector::update( Time const& sliceT0, const long from, const long t
 
       if ( P_.precise_times_ )
       {
-        se.set_offset( P_.spike_offsets_[ S_.position_ ] );
+        se.set_offset( offset );
       }
 
       if ( not P_.spike_multiplicities_.empty() )
@@ -378,4 +457,20 @@ spike_train_injector::update( Time const& sliceT0, const long from, const long t
   }
 }
 
+Time
+spike_train_injector::get_spike_stamp_( const size_t position, double& offset ) const
+{
+  if ( P_.spike_train_file_ )
+  {
+    // spike times in the file have been checked when binding the spike train
+    return P_.get_valid_spike_stamp_( B_.file_spikes_[ position ].time, Time(), Time::neg_inf(), offset );
+  }
+
+  if ( P_.precise_times_ )
+  {
+    offset = P_.spike_offsets_[ position ];
+  }
+  return P_.spike_stamps_[ position ];
+}
+
 }  // namespace nest
@@ -24,6 +24,7 @@
 #define SPIKE_TRAIN_INJECTOR_H
 
 // C++ includes:
+#include <memory>
 #include <vector>
 
 // Includes from nestkernel:
@@ -33,6 +34,7 @@
 #include "nest_time.h"
 #include "nest_types.h"
 #include "node.h"
+#include "spike_train_file.h"
 
 namespace nest
 {
@@ -210,6 +212,17 @@ allow_offgrid_times
 shift_now_spikes
     See above.
 
+spike_train_file
+    Name of a binary file to read the spike times from instead of
+    `spike_times`, as described for the
+    :doc:`spike generator </models/spike_generator>`. Set to an empty
+    string to stop reading from the file. `spike_multiplicities` are not
+    supported for spike trains read from a file.
+
+spike_train_sender
+    Sender in the spike train file whose spikes the neuron emits.
+    Default: -1, which stands for the node ID of the neuron.
+
 Receives
 ++++++++
 
@@ -278,6 +291,20 @@ private:
     size_t position_;  //!< index of next spike to deliver
   };
 
+  /**
+   * Buffers of the model.
+   */
+  struct Buffers_
+  {
+    Buffers_();
+    Buffers_( const Buffers_& );
+
+    //! Spike train of the sender in the spike train file, bound in pre_run_hook()
+    const SpikeTrainFile::Spike* file_spikes_;
+    size_t num_file_spikes_;
+    bool file_spikes_bound_;
+  };
+
   /**
    * Independent parameters of the model.
    */
@@ -301,6 +328,12 @@ private:
     //! Shift spike times at present to next step
     bool shift_now_spikes_;
 
+    //! File to read spike times from instead of spike_stamps_, if set
+    std::shared_ptr< const SpikeTrainFile > spike_train_file_;
+
+    //! Sender in spike_train_file_, -1 for the node ID of the neuron
+    long spike_train_sender_;
+
     Parameters_();  //!< Sets default parameter values
     Parameters_( const Parameters_& ) = default;
     Parameters_& operator=( const Parameters_& ) = default;
@@ -323,10 +356,27 @@ private:
      * @param current simulation time
      */
     void assert_valid_spike_time_and_insert_( double, const Time&, const Time& );
+
+    /**
+     * Return time stamp of spike time, throw BadProperty for invalid spike times.
+     *
+     * @param spike time, ms
+     * @param origin
+     * @param current simulation time
+     * @param offset of precise spike time, set if precise_times_
+     */
+    Time get_valid_spike_stamp_( double, const Time&, const Time&, double& ) const;
   };
 
+  //! Return number of spikes in the spike train, from the file or spike_times
+  size_t get_num_spikes_() const;
+
+  //! Return time stamp and set offset of spike at given position
+  Time get_spike_stamp_( size_t, double& ) const;
+
   State_ S_;
   Parameters_ P_;
+  Buffers_ B_;
 };
 
 
@@ -375,6 +425,15 @@ spike_train_injector::set_status( const Dictionary& d )
 
   // if we get here, temporary contains consistent set of properties
   P_ = ptmp;
+
+  // the spike train needs to be bound again in case file, sender or options changed
+  B_.file_spikes_bound_ = false;
+}
+
+inline size_t
+spike_train_injector::get_num_spikes_() const
+{
+  return P_.spike_train_file_ ? B_.num_file_spikes_ : P_.spike_stamps_.size();
 }
 
 }  // namespace
@@ -74,7 +74,7 @@ public:
 
   static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
     | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::SUPPORTS_HPC
-    | ConnectionModelProperties::SUPPORTS_LBL;
+    | ConnectionModelProperties::SUPPORTS_LBL | ConnectionModelProperties::SUPPORTS_MULTIPLICITY;
 
   /**
    * Default Constructor.
@@ -177,6 +177,12 @@ public:
   {
     weight_ = w;
   }
+
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
 };
 
 template < typename targetidentifierT >
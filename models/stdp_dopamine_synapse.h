@@ -231,6 +231,11 @@ public:
    */
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< stdp_dopamine_synapse > get_double_parameter_setter( const std::string& name );
+
   /**
    * Checks to see if illegal parameters are given in syn_spec.
    *
@@ -251,6 +256,19 @@ public:
     double t_trig,
     const STDPDopaCommonProperties& cp );
 
+  /**
+   * Update all connections of a Connector for the given dopamine spikes.
+   *
+   * Decay factors for the intervals between dopamine spikes are shared by
+   * all connections and are computed only once.
+   */
+  template < typename ConnectionT >
+  static void trigger_update_weights( size_t t,
+    BlockVector< ConnectionT >& connections,
+    const std::vector< spikecounter >& dopa_spikes,
+    double t_trig,
+    const STDPDopaCommonProperties& cp );
+
   class ConnTestDummyNode : public ConnTestDummyNodeBase
   {
   public:
@@ -299,14 +317,53 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
+  //! Throw BadProperty if Kplus is invalid
+  void check_Kplus_() const;
+
+  /**
+   * Factors for the intervals between consecutive dopamine spikes.
+   *
+   * Entry k refers to the interval between dopamine spikes k and k+1. The
+   * factors depend only on the dopamine spikes and the common properties,
+   * so they are the same for all connections of a synapse model.
+   */
+  struct DopaIntervals_
+  {
+    DopaIntervals_( const std::vector< spikecounter >& dopa_spikes, const STDPDopaCommonProperties& cp );
+
+    std::vector< double > n_decay_;      //!< decay of dopamine trace n across the interval
+    std::vector< double > expm1_taus_;   //!< expm1 term of the weight change driven by n
+    std::vector< double > expm1_tau_c_;  //!< expm1 term of the weight change driven by baseline b
+  };
+
+  void trigger_update_weight_( size_t t,
+    const std::vector< spikecounter >& dopa_spikes,
+    const DopaIntervals_* intervals,
+    double t_trig,
+    const STDPDopaCommonProperties& cp );
+
   // update dopamine trace from last to current dopamine spike and increment
-  // index
-  void update_dopamine_( const std::vector< spikecounter >& dopa_spikes, const STDPDopaCommonProperties& cp );
+  // index; intervals may be null, then the decay is computed here
+  void update_dopamine_( const std::vector< spikecounter >& dopa_spikes,
+    const DopaIntervals_* intervals,
+    const STDPDopaCommonProperties& cp );
 
   void update_weight_( double c0, double n0, double minus_dt, const STDPDopaCommonProperties& cp );
+  void update_weight_( double c0,
+    double n0,
+    double expm1_taus,
+    double expm1_tau_c,
+    const STDPDopaCommonProperties& cp );
 
   void process_dopa_spikes_( const std::vector< spikecounter >& dopa_spikes,
+    const DopaIntervals_* intervals,
     double t0,
     double t1,
     const STDPDopaCommonProperties& cp );
@@ -378,10 +435,7 @@ stdp_dopamine_synapse< targetidentifierT >::set_status( const Dictionary& d, Con
   d.update_value( names::n, n_ );
 
   d.update_value( names::Kplus, Kplus_ );
-  if ( Kplus_ < 0 )
-  {
-    throw BadProperty( "Kplus must be non-negative." );
-  }
+  check_Kplus_();
 }
 
 template < typename targetidentifierT >
@@ -408,14 +462,44 @@ stdp_dopamine_synapse< targetidentifierT >::check_synapse_params( const Dictiona
   }
 }
 
+template < typename targetidentifierT >
+stdp_dopamine_synapse< targetidentifierT >::DopaIntervals_::DopaIntervals_(
+  const std::vector< spikecounter >& dopa_spikes,
+  const STDPDopaCommonProperties& cp )
+{
+  const double taus_ = ( cp.tau_c_ + cp.tau_n_ ) / ( cp.tau_c_ * cp.tau_n_ );
+  const size_t num_intervals = dopa_spikes.empty() ? 0 : dopa_spikes.size() - 1;
+
+  n_decay_.resize( num_intervals );
+  expm1_taus_.resize( num_intervals );
+  expm1_tau_c_.resize( num_intervals );
+  for ( size_t k = 0; k < num_intervals; ++k )
+  {
+    const double minus_dt = dopa_spikes[ k ].spike_time_ - dopa_spikes[ k + 1 ].spike_time_;
+    n_decay_[ k ] = std::exp( minus_dt / cp.tau_n_ );
+    expm1_taus_[ k ] = numerics::expm1( taus_ * minus_dt );
+    expm1_tau_c_[ k ] = numerics::expm1( minus_dt / cp.tau_c_ );
+  }
+}
+
 template < typename targetidentifierT >
 inline void
 stdp_dopamine_synapse< targetidentifierT >::update_dopamine_( const std::vector< spikecounter >& dopa_spikes,
+  const DopaIntervals_* intervals,
   const STDPDopaCommonProperties& cp )
 {
-  double minus_dt = dopa_spikes[ dopa_spikes_idx_ ].spike_time_ - dopa_spikes[ dopa_spikes_idx_ + 1 ].spike_time_;
+  double n_decay;
+  if ( intervals )
+  {
+    n_decay = intervals->n_decay_[ dopa_spikes_idx_ ];
+  }
+  else
+  {
+    double minus_dt = dopa_spikes[ dopa_spikes_idx_ ].spike_time_ - dopa_spikes[ dopa_spikes_idx_ + 1 ].spike_time_;
+    n_decay = std::exp( minus_dt / cp.tau_n_ );
+  }
   ++dopa_spikes_idx_;
-  n_ = n_ * std::exp( minus_dt / cp.tau_n_ ) + dopa_spikes[ dopa_spikes_idx_ ].multiplicity_ / cp.tau_n_;
+  n_ = n_ * n_decay + dopa_spikes[ dopa_spikes_idx_ ].multiplicity_ / cp.tau_n_;
 }
 
 template < typename targetidentifierT >
@@ -426,10 +510,19 @@ stdp_dopamine_synapse< targetidentifierT >::update_weight_( double c0,
   const STDPDopaCommonProperties& cp )
 {
   const double taus_ = ( cp.tau_c_ + cp.tau_n_ ) / ( cp.tau_c_ * cp.tau_n_ );
-  weight_ = weight_
-    - c0
-      * ( n0 / taus_ * numerics::expm1( taus_ * minus_dt )
-        - cp.b_ * cp.tau_c_ * numerics::expm1( minus_dt / cp.tau_c_ ) );
+  update_weight_( c0, n0, numerics::expm1( taus_ * minus_dt ), numerics::expm1( minus_dt / cp.tau_c_ ), cp );
+}
+
+template < typename targetidentifierT >
+inline void
+stdp_dopamine_synapse< targetidentifierT >::update_weight_( double c0,
+  double n0,
+  double expm1_taus,
+  double expm1_tau_c,
+  const STDPDopaCommonProperties& cp )
+{
+  const double taus_ = ( cp.tau_c_ + cp.tau_n_ ) / ( cp.tau_c_ * cp.tau_n_ );
+  weight_ = weight_ - c0 * ( n0 / taus_ * expm1_taus - cp.b_ * cp.tau_c_ * expm1_tau_c );
 
   if ( weight_ < cp.Wmin_ )
   {
@@ -444,6 +537,7 @@ stdp_dopamine_synapse< targetidentifierT >::update_weight_( double c0,
 template < typename targetidentifierT >
 inline void
 stdp_dopamine_synapse< targetidentifierT >::process_dopa_spikes_( const std::vector< spikecounter >& dopa_spikes,
+  const DopaIntervals_* intervals,
   double t0,
   double t1,
   const STDPDopaCommonProperties& cp )
@@ -460,7 +554,7 @@ stdp_dopamine_synapse< targetidentifierT >::process_dopa_spikes_( const std::vec
     double n0 =
       n_ * std::exp( ( dopa_spikes[ dopa_spikes_idx_ ].spike_time_ - t0 ) / cp.tau_n_ );  // dopamine trace n at time t0
     update_weight_( c_, n0, t0 - dopa_spikes[ dopa_spikes_idx_ + 1 ].spike_time_, cp );
-    update_dopamine_( dopa_spikes, cp );
+    update_dopamine_( dopa_spikes, intervals, cp );
 
     // process remaining dopa spikes in (t0, t1]
     double cd;
@@ -473,9 +567,17 @@ stdp_dopamine_synapse< targetidentifierT >::process_dopa_spikes_( const std::vec
       // t0
       cd = c_
         * std::exp( ( t0 - dopa_spikes[ dopa_spikes_idx_ ].spike_time_ ) / cp.tau_c_ );  // eligibility c at time of td
-      update_weight_(
-        cd, n_, dopa_spikes[ dopa_spikes_idx_ ].spike_time_ - dopa_spikes[ dopa_spikes_idx_ + 1 ].spike_time_, cp );
-      update_dopamine_( dopa_spikes, cp );
+      if ( intervals )
+      {
+        update_weight_(
+          cd, n_, intervals->expm1_taus_[ dopa_spikes_idx_ ], intervals->expm1_tau_c_[ dopa_spikes_idx_ ], cp );
+      }
+      else
+      {
+        update_weight_(
+          cd, n_, dopa_spikes[ dopa_spikes_idx_ ].spike_time_ - dopa_spikes[ dopa_spikes_idx_ + 1 ].spike_time_, cp );
+      }
+      update_dopamine_( dopa_spikes, intervals, cp );
     }
 
     // propagate weight up to t1
@@ -533,8 +635,8 @@ stdp_dopamine_synapse< targetidentifierT >::send( Event& e, size_t t, const STDP
 
   // get spike history in relevant range (t_last_update, t_spike] from
   // postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
   target->get_history( t_last_update_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish );
 
   // facilitation due to postsynaptic spikes since last update
@@ -542,7 +644,7 @@ stdp_dopamine_synapse< targetidentifierT >::send( Event& e, size_t t, const STDP
   double minus_dt;
   while ( start != finish )
   {
-    process_dopa_spikes_( dopa_spikes, t0, start->t_ + dendritic_delay, cp );
+    process_dopa_spikes_( dopa_spikes, nullptr, t0, start->t_ + dendritic_delay, cp );
     t0 = start->t_ + dendritic_delay;
     minus_dt = t_last_update_ - t0;
     // facilitate only in case of post- after presyn. spike
@@ -555,7 +657,7 @@ stdp_dopamine_synapse< targetidentifierT >::send( Event& e, size_t t, const STDP
   }
 
   // depression due to new pre-synaptic spike
-  process_dopa_spikes_( dopa_spikes, t0, t_spike, cp );
+  process_dopa_spikes_( dopa_spikes, nullptr, t0, t_spike, cp );
   depress_( target->get_K_value( t_spike - dendritic_delay ), cp );
 
   e.set_receiver( *target );
@@ -577,6 +679,35 @@ stdp_dopamine_synapse< targetidentifierT >::trigger_update_weight( size_t t,
   const std::vector< spikecounter >& dopa_spikes,
   const double t_trig,
   const STDPDopaCommonProperties& cp )
+{
+  trigger_update_weight_( t, dopa_spikes, nullptr, t_trig, cp );
+}
+
+template < typename targetidentifierT >
+template < typename ConnectionT >
+void
+stdp_dopamine_synapse< targetidentifierT >::trigger_update_weights( size_t t,
+  BlockVector< ConnectionT >& connections,
+  const std::vector< spikecounter >& dopa_spikes,
+  const double t_trig,
+  const STDPDopaCommonProperties& cp )
+{
+  const DopaIntervals_ intervals( dopa_spikes, cp );
+  for ( auto& connection : connections )
+  {
+    // connections may be labeled, i.e., of a type derived from stdp_dopamine_synapse
+    static_cast< stdp_dopamine_synapse& >( connection ).trigger_update_weight_(
+      t, dopa_spikes, &intervals, t_trig, cp );
+  }
+}
+
+template < typename targetidentifierT >
+inline void
+stdp_dopamine_synapse< targetidentifierT >::trigger_update_weight_( size_t t,
+  const std::vector< spikecounter >& dopa_spikes,
+  const DopaIntervals_* intervals,
+  const double t_trig,
+  const STDPDopaCommonProperties& cp )
 {
   // propagate all state variables to time t_trig
   // this does not include the depression trace K_minus, which is updated in the
@@ -587,8 +718,8 @@ stdp_dopamine_synapse< targetidentifierT >::trigger_update_weight( size_t t,
 
   // get spike history in relevant range (t_last_update, t_trig] from postsyn.
   // neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
   get_target( t )->get_history( t_last_update_ - dendritic_delay, t_trig - dendritic_delay, &start, &finish );
 
   // facilitation due to postsyn. spikes since last update
@@ -596,7 +727,7 @@ stdp_dopamine_synapse< targetidentifierT >::trigger_update_weight( size_t t,
   double minus_dt;
   while ( start != finish )
   {
-    process_dopa_spikes_( dopa_spikes, t0, start->t_ + dendritic_delay, cp );
+    process_dopa_spikes_( dopa_spikes, intervals, t0, start->t_ + dendritic_delay, cp );
     t0 = start->t_ + dendritic_delay;
     minus_dt = t_last_update_ - t0;
     facilitate_( Kplus_ * std::exp( minus_dt / cp.tau_plus_ ), cp );
@@ -606,7 +737,7 @@ stdp_dopamine_synapse< targetidentifierT >::trigger_update_weight( size_t t,
   // propagate weight, eligibility trace c, dopamine trace n and facilitation
   // trace K_plus to time t_trig but do not increment/decrement as there are no
   // spikes to be handled at t_trig
-  process_dopa_spikes_( dopa_spikes, t0, t_trig, cp );
+  process_dopa_spikes_( dopa_spikes, intervals, t0, t_trig, cp );
   n_ = n_ * std::exp( ( dopa_spikes[ dopa_spikes_idx_ ].spike_time_ - t_trig ) / cp.tau_n_ );
   Kplus_ = Kplus_ * std::exp( ( t_last_update_ - t_trig ) / cp.tau_plus_ );
 
@@ -614,6 +745,39 @@ stdp_dopamine_synapse< targetidentifierT >::trigger_update_weight( size_t t,
   dopa_spikes_idx_ = 0;
 }
 
+template < typename targetidentifierT >
+DoubleParameterSetter< stdp_dopamine_synapse< targetidentifierT > >
+stdp_dopamine_synapse< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::c )
+  {
+    return []( stdp_dopamine_synapse& c, const double value ) { c.c_ = value; };
+  }
+  if ( name == names::n )
+  {
+    return []( stdp_dopamine_synapse& c, const double n ) { c.n_ = n; };
+  }
+  if ( name == names::Kplus )
+  {
+    return []( stdp_dopamine_synapse& c, const double Kplus )
+    {
+      c.Kplus_ = Kplus;
+      c.check_Kplus_();
+    };
+  }
+  return nullptr;
+}
+
+template < typename targetidentifierT >
+void
+stdp_dopamine_synapse< targetidentifierT >::check_Kplus_() const
+{
+  if ( Kplus_ < 0 )
+  {
+    throw BadProperty( "Kplus must be non-negative." );
+  }
+}
+
 }  // of namespace nest
 
 #endif  // of #ifndef STDP_DOPAMINE_SYNAPSE_H
@@ -264,6 +264,11 @@ public:
    */
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< stdp_facetshw_synapse_hom > get_double_parameter_setter( const std::string& name );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -313,6 +318,12 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
   bool eval_function_( double a_causal,
     double a_acausal,
@@ -487,8 +498,8 @@ stdp_facetshw_synapse_hom< targetidentifierT >::send( Event& e,
   double dendritic_delay = Time( Time::step( get_delay_steps() ) ).get_ms();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
   get_target( t )->get_history( t_lastspike_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish );
 
   // facilitation due to the first postsynaptic spike since the last
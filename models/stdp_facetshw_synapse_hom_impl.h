@@ -331,6 +331,29 @@ stdp_facetshw_synapse_hom< targetidentifierT >::set_status( const Dictionary& d,
   // setting discrete_weight_ does not make sense, is temporary variable
 }
 
+template < typename targetidentifierT >
+DoubleParameterSetter< stdp_facetshw_synapse_hom< targetidentifierT > >
+stdp_facetshw_synapse_hom< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::a_causal )
+  {
+    return []( stdp_facetshw_synapse_hom& c, const double a_causal ) { c.a_causal_ = a_causal; };
+  }
+  if ( name == names::a_acausal )
+  {
+    return []( stdp_facetshw_synapse_hom& c, const double a_acausal ) { c.a_acausal_ = a_acausal; };
+  }
+  if ( name == names::a_thresh_th )
+  {
+    return []( stdp_facetshw_synapse_hom& c, const double a_thresh_th ) { c.a_thresh_th_ = a_thresh_th; };
+  }
+  if ( name == names::a_thresh_tl )
+  {
+    return []( stdp_facetshw_synapse_hom& c, const double a_thresh_tl ) { c.a_thresh_tl_ = a_thresh_tl; };
+  }
+  return nullptr;
+}
+
 }  // of namespace nest
 
 #endif  // #ifndef STDP_SYNAPSE_FACETSHW_HOM_IMPL_H
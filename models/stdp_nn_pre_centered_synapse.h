@@ -132,6 +132,7 @@ public:
   static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
     | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::SUPPORTS_HPC
     | ConnectionModelProperties::SUPPORTS_LBL;
+  static constexpr bool checks_weight_in_set_status = true;
 
   /**
    * Default Constructor.
@@ -166,6 +167,11 @@ public:
    */
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< stdp_nn_pre_centered_synapse > get_double_parameter_setter( const std::string& name );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -202,7 +208,19 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
+  //! Throw BadProperty if weight and Wmax have different signs
+  void check_Wmax_sign_() const;
+
+  //! Throw BadProperty if Kplus is invalid
+  void check_Kplus_() const;
+
   double
   facilitate_( double w, double kplus )
   {
@@ -252,8 +270,8 @@ stdp_nn_pre_centered_synapse< targetidentifierT >::send( Event& e, size_t t, con
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
 
   // For a new synapse, t_lastspike_ contains the point in time of the last
   // spike. So we initially read the
@@ -357,12 +375,67 @@ stdp_nn_pre_centered_synapse< targetidentifierT >::set_status( const Dictionary&
   d.update_value( names::Wmax, Wmax_ );
   d.update_value( names::Kplus, Kplus_ );
 
-  // check if weight_ and Wmax_ have the same sign
+  check_Wmax_sign_();
+  check_Kplus_();
+}
+
+template < typename targetidentifierT >
+DoubleParameterSetter< stdp_nn_pre_centered_synapse< targetidentifierT > >
+stdp_nn_pre_centered_synapse< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::tau_plus )
+  {
+    return []( stdp_nn_pre_centered_synapse& c, const double tau_plus ) { c.tau_plus_ = tau_plus; };
+  }
+  if ( name == names::lambda )
+  {
+    return []( stdp_nn_pre_centered_synapse& c, const double lambda ) { c.lambda_ = lambda; };
+  }
+  if ( name == names::alpha )
+  {
+    return []( stdp_nn_pre_centered_synapse& c, const double alpha ) { c.alpha_ = alpha; };
+  }
+  if ( name == names::mu_plus )
+  {
+    return []( stdp_nn_pre_centered_synapse& c, const double mu_plus ) { c.mu_plus_ = mu_plus; };
+  }
+  if ( name == names::mu_minus )
+  {
+    return []( stdp_nn_pre_centered_synapse& c, const double mu_minus ) { c.mu_minus_ = mu_minus; };
+  }
+  if ( name == names::Wmax )
+  {
+    return []( stdp_nn_pre_centered_synapse& c, const double Wmax )
+    {
+      c.Wmax_ = Wmax;
+      c.check_Wmax_sign_();
+    };
+  }
+  if ( name == names::Kplus )
+  {
+    return []( stdp_nn_pre_centered_synapse& c, const double Kplus )
+    {
+      c.Kplus_ = Kplus;
+      c.check_Kplus_();
+    };
+  }
+  return nullptr;
+}
+
+template < typename targetidentifierT >
+void
+stdp_nn_pre_centered_synapse< targetidentifierT >::check_Wmax_sign_() const
+{
   if ( not( ( ( weight_ >= 0 ) - ( weight_ < 0 ) ) == ( ( Wmax_ >= 0 ) - ( Wmax_ < 0 ) ) ) )
   {
     throw BadProperty( "Weight and Wmax must have same sign." );
   }
+}
 
+template < typename targetidentifierT >
+void
+stdp_nn_pre_centered_synapse< targetidentifierT >::check_Kplus_() const
+{
   if ( Kplus_ < 0 )
   {
     throw BadProperty( "Kplus must be non-negative." );
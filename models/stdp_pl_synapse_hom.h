@@ -172,6 +172,11 @@ public:
    */
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< stdp_pl_synapse_hom > get_double_parameter_setter( const std::string& name );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -220,6 +225,12 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
   double
   facilitate_( double w, double kplus, const STDPPLHomCommonProperties& cp )
@@ -267,8 +278,8 @@ stdp_pl_synapse_hom< targetidentifierT >::send( Event& e, size_t t, const STDPPL
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
   target->get_history( t_lastspike_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish );
 
   // facilitation due to postsynaptic spikes since last pre-synaptic spike
@@ -333,6 +344,17 @@ stdp_pl_synapse_hom< targetidentifierT >::set_status( const Dictionary& d, Conne
   d.update_value( names::Kplus, Kplus_ );
 }
 
+template < typename targetidentifierT >
+DoubleParameterSetter< stdp_pl_synapse_hom< targetidentifierT > >
+stdp_pl_synapse_hom< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::Kplus )
+  {
+    return []( stdp_pl_synapse_hom& c, const double Kplus ) { c.Kplus_ = Kplus; };
+  }
+  return nullptr;
+}
+
 }  // of namespace nest
 
 #endif  // of #ifndef STDP_PL_SYNAPSE_HOM_H
@@ -188,6 +188,11 @@ public:
    */
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< stdp_synapse_hom > get_double_parameter_setter( const std::string& name );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -200,6 +205,12 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 
   class ConnTestDummyNode : public ConnTestDummyNodeBase
   {
@@ -292,8 +303,8 @@ stdp_synapse_hom< targetidentifierT >::send( Event& e, size_t t, const STDPHomCo
   double dendritic_delay = get_delay();
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
   target->get_history( t_lastspike_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish );
   // facilitation due to postsynaptic spikes since last pre-synaptic spike
   double minus_dt;
@@ -348,6 +359,17 @@ stdp_synapse_hom< targetidentifierT >::set_status( const Dictionary& d, Connecto
   d.update_value( names::Kplus, Kplus_ );
 }
 
+template < typename targetidentifierT >
+DoubleParameterSetter< stdp_synapse_hom< targetidentifierT > >
+stdp_synapse_hom< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::Kplus )
+  {
+    return []( stdp_synapse_hom& c, const double Kplus ) { c.Kplus_ = Kplus; };
+  }
+  return nullptr;
+}
+
 }  // of namespace nest
 
 #endif  // of #ifndef STDP_SYNAPSE_HOM_H
@@ -130,6 +130,7 @@ public:
   static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
     | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::SUPPORTS_HPC
     | ConnectionModelProperties::SUPPORTS_LBL;
+  static constexpr bool checks_weight_in_set_status = true;
 
   /**
    * Default Constructor.
@@ -170,6 +171,11 @@ public:
    */
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< stdp_triplet_synapse > get_double_parameter_setter( const std::string& name );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -219,7 +225,22 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
+  //! Throw BadProperty if weight and Wmax have different signs
+  void check_Wmax_sign_() const;
+
+  //! Throw BadProperty if Kplus is invalid
+  void check_Kplus_() const;
+
+  //! Throw BadProperty if Kplus_triplet is invalid
+  void check_Kplus_triplet_() const;
+
   inline double
   facilitate_( double w, double kplus, double ky )
   {
@@ -266,8 +287,8 @@ stdp_triplet_synapse< targetidentifierT >::send( Event& e, size_t t, const Commo
   Node* target = get_target( t );
 
   // get spike history in relevant range (t1, t2] from postsynaptic neuron
-  std::deque< histentry >::iterator start;
-  std::deque< histentry >::iterator finish;
+  HistoryBuffer< histentry >::iterator start;
+  HistoryBuffer< histentry >::iterator finish;
   target->get_history( t_lastspike_ - dendritic_delay, t_spike - dendritic_delay, &start, &finish );
 
   // facilitation due to postsynaptic spikes since last pre-synaptic spike
@@ -361,17 +382,90 @@ stdp_triplet_synapse< targetidentifierT >::set_status( const Dictionary& d, Conn
   d.update_value( names::Kplus_triplet, Kplus_triplet_ );
   d.update_value( names::Wmax, Wmax_ );
 
-  // check if weight_ and Wmax_ has the same sign
+  check_Wmax_sign_();
+  check_Kplus_();
+  check_Kplus_triplet_();
+}
+
+template < typename targetidentifierT >
+DoubleParameterSetter< stdp_triplet_synapse< targetidentifierT > >
+stdp_triplet_synapse< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::tau_plus )
+  {
+    return []( stdp_triplet_synapse& c, const double tau_plus ) { c.tau_plus_ = tau_plus; };
+  }
+  if ( name == names::tau_plus_triplet )
+  {
+    return []( stdp_triplet_synapse& c, const double tau_plus_triplet ) { c.tau_plus_triplet_ = tau_plus_triplet; };
+  }
+  if ( name == names::Aplus )
+  {
+    return []( stdp_triplet_synapse& c, const double Aplus ) { c.Aplus_ = Aplus; };
+  }
+  if ( name == names::Aminus )
+  {
+    return []( stdp_triplet_synapse& c, const double Aminus ) { c.Aminus_ = Aminus; };
+  }
+  if ( name == names::Aplus_triplet )
+  {
+    return []( stdp_triplet_synapse& c, const double Aplus_triplet ) { c.Aplus_triplet_ = Aplus_triplet; };
+  }
+  if ( name == names::Aminus_triplet )
+  {
+    return []( stdp_triplet_synapse& c, const double Aminus_triplet ) { c.Aminus_triplet_ = Aminus_triplet; };
+  }
+  if ( name == names::Wmax )
+  {
+    return []( stdp_triplet_synapse& c, const double Wmax )
+    {
+      c.Wmax_ = Wmax;
+      c.check_Wmax_sign_();
+    };
+  }
+  if ( name == names::Kplus )
+  {
+    return []( stdp_triplet_synapse& c, const double Kplus )
+    {
+      c.Kplus_ = Kplus;
+      c.check_Kplus_();
+    };
+  }
+  if ( name == names::Kplus_triplet )
+  {
+    return []( stdp_triplet_synapse& c, const double Kplus_triplet )
+    {
+      c.Kplus_triplet_ = Kplus_triplet;
+      c.check_Kplus_triplet_();
+    };
+  }
+  return nullptr;
+}
+
+template < typename targetidentifierT >
+void
+stdp_triplet_synapse< targetidentifierT >::check_Wmax_sign_() const
+{
   if ( not( ( ( weight_ >= 0 ) - ( weight_ < 0 ) ) == ( ( Wmax_ >= 0 ) - ( Wmax_ < 0 ) ) ) )
   {
     throw BadProperty( "Weight and Wmax must have same sign." );
   }
+}
 
+template < typename targetidentifierT >
+void
+stdp_triplet_synapse< targetidentifierT >::check_Kplus_() const
+{
   if ( not( Kplus_ >= 0 ) )
   {
     throw BadProperty( "State Kplus must be positive." );
   }
+}
 
+template < typename targetidentifierT >
+void
+stdp_triplet_synapse< targetidentifierT >::check_Kplus_triplet_() const
+{
   if ( Kplus_triplet_ < 0 )
   {
     throw BadProperty( "State Kplus_triplet must be positive." );
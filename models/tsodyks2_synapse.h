@@ -164,6 +164,11 @@ public:
    */
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< tsodyks2_synapse > get_double_parameter_setter( const std::string& name );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -198,8 +203,20 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 
 private:
+  //! Setters for parameters, throw BadProperty for invalid values
+  void set_U_( const double U );
+  void set_u_( const double u );
+  void set_tau_rec_( const double tau_rec );
+  void set_tau_fac_( const double tau_fac );
+
   double weight_;
   double U_;            //!< unit increment of a facilitating synapse
   double u_;            //!< dynamic value of probability of release
@@ -285,31 +302,96 @@ tsodyks2_synapse< targetidentifierT >::set_status( const Dictionary& d, Connecto
   ConnectionBase::set_status( d, cm );
   d.update_value( names::weight, weight_ );
 
-  d.update_value( names::dU, U_ );
-  if ( U_ > 1.0 or U_ < 0.0 )
+  double value;
+  if ( d.update_value( names::dU, value ) )
+  {
+    set_U_( value );
+  }
+  if ( d.update_value( names::u, value ) )
+  {
+    set_u_( value );
+  }
+  if ( d.update_value( names::tau_rec, value ) )
+  {
+    set_tau_rec_( value );
+  }
+  if ( d.update_value( names::tau_fac, value ) )
+  {
+    set_tau_fac_( value );
+  }
+
+  d.update_value( names::x, x_ );
+}
+
+template < typename targetidentifierT >
+DoubleParameterSetter< tsodyks2_synapse< targetidentifierT > >
+tsodyks2_synapse< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::dU )
+  {
+    return []( tsodyks2_synapse& c, const double U ) { c.set_U_( U ); };
+  }
+  if ( name == names::u )
+  {
+    return []( tsodyks2_synapse& c, const double u ) { c.set_u_( u ); };
+  }
+  if ( name == names::tau_rec )
+  {
+    return []( tsodyks2_synapse& c, const double tau_rec ) { c.set_tau_rec_( tau_rec ); };
+  }
+  if ( name == names::tau_fac )
+  {
+    return []( tsodyks2_synapse& c, const double tau_fac ) { c.set_tau_fac_( tau_fac ); };
+  }
+  if ( name == names::x )
+  {
+    return []( tsodyks2_synapse& c, const double x ) { c.x_ = x; };
+  }
+  return nullptr;
+}
+
+template < typename targetidentifierT >
+void
+tsodyks2_synapse< targetidentifierT >::set_U_( const double U )
+{
+  if ( U > 1.0 or U < 0.0 )
   {
     throw BadProperty( "'U' must be in [0,1]." );
   }
+  U_ = U;
+}
 
-  d.update_value( names::u, u_ );
-  if ( u_ > 1.0 or u_ < 0.0 )
+template < typename targetidentifierT >
+void
+tsodyks2_synapse< targetidentifierT >::set_u_( const double u )
+{
+  if ( u > 1.0 or u < 0.0 )
   {
     throw BadProperty( "'u' must be in [0,1]." );
   }
+  u_ = u;
+}
 
-  d.update_value( names::tau_rec, tau_rec_ );
-  if ( tau_rec_ <= 0.0 )
+template < typename targetidentifierT >
+void
+tsodyks2_synapse< targetidentifierT >::set_tau_rec_( const double tau_rec )
+{
+  if ( tau_rec <= 0.0 )
   {
     throw BadProperty( "'tau_rec' must be > 0." );
   }
+  tau_rec_ = tau_rec;
+}
 
-  d.update_value( names::tau_fac, tau_fac_ );
-  if ( tau_fac_ < 0.0 )
+template < typename targetidentifierT >
+void
+tsodyks2_synapse< targetidentifierT >::set_tau_fac_( const double tau_fac )
+{
+  if ( tau_fac < 0.0 )
   {
     throw BadProperty( "'tau_fac' must be >= 0." );
   }
-
-  d.update_value( names::x, x_ );
+  tau_fac_ = tau_fac;
 }
 
 }  // namespace
@@ -186,6 +186,11 @@ public:
    */
   void set_status( const Dictionary& d, ConnectorModel& cm );
 
+  /**
+   * Return the setter of the given double parameter, or nullptr if it has none.
+   */
+  static DoubleParameterSetter< tsodyks_synapse > get_double_parameter_setter( const std::string& name );
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -219,7 +224,20 @@ public:
     weight_ = w;
   }
 
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+
 private:
+  //! Setters for parameters, throw BadProperty for invalid values
+  void set_U_( const double U );
+  void set_tau_psc_( const double tau_psc );
+  void set_tau_rec_( const double tau_rec );
+  void set_tau_fac_( const double tau_fac );
+  void set_u_( const double u );
+
   double weight_;
   double tau_psc_;      //!< [ms] time constant of postsyn current
   double tau_fac_;      //!< [ms] time constant for facilitation
@@ -344,35 +362,109 @@ tsodyks_synapse< targetidentifierT >::set_status( const Dictionary& d, Connector
   ConnectionBase::set_status( d, cm );
   d.update_value( names::weight, weight_ );
 
-  d.update_value( names::U, U_ );
-  if ( U_ > 1.0 or U_ < 0.0 )
+  double value;
+  if ( d.update_value( names::U, value ) )
+  {
+    set_U_( value );
+  }
+  if ( d.update_value( names::tau_psc, value ) )
+  {
+    set_tau_psc_( value );
+  }
+  if ( d.update_value( names::tau_rec, value ) )
+  {
+    set_tau_rec_( value );
+  }
+  if ( d.update_value( names::tau_fac, value ) )
+  {
+    set_tau_fac_( value );
+  }
+  if ( d.update_value( names::u, value ) )
+  {
+    set_u_( value );
+  }
+}
+
+template < typename targetidentifierT >
+DoubleParameterSetter< tsodyks_synapse< targetidentifierT > >
+tsodyks_synapse< targetidentifierT >::get_double_parameter_setter( const std::string& name )
+{
+  if ( name == names::U )
+  {
+    return []( tsodyks_synapse& c, const double U ) { c.set_U_( U ); };
+  }
+  if ( name == names::tau_psc )
+  {
+    return []( tsodyks_synapse& c, const double tau_psc ) { c.set_tau_psc_( tau_psc ); };
+  }
+  if ( name == names::tau_rec )
+  {
+    return []( tsodyks_synapse& c, const double tau_rec ) { c.set_tau_rec_( tau_rec ); };
+  }
+  if ( name == names::tau_fac )
+  {
+    return []( tsodyks_synapse& c, const double tau_fac ) { c.set_tau_fac_( tau_fac ); };
+  }
+  if ( name == names::u )
+  {
+    return []( tsodyks_synapse& c, const double u ) { c.set_u_( u ); };
+  }
+  return nullptr;
+}
+
+template < typename targetidentifierT >
+void
+tsodyks_synapse< targetidentifierT >::set_U_( const double U )
+{
+  if ( U > 1.0 or U < 0.0 )
   {
     throw BadProperty( "'U' must be in [0,1]." );
   }
+  U_ = U;
+}
 
-  d.update_value( names::tau_psc, tau_psc_ );
-  if ( tau_psc_ <= 0.0 )
+template < typename targetidentifierT >
+void
+tsodyks_synapse< targetidentifierT >::set_tau_psc_( const double tau_psc )
+{
+  if ( tau_psc <= 0.0 )
   {
     throw BadProperty( "'tau_psc' must be > 0." );
   }
+  tau_psc_ = tau_psc;
+}
 
-  d.update_value( names::tau_rec, tau_rec_ );
-  if ( tau_rec_ <= 0.0 )
+template < typename targetidentifierT >
+void
+tsodyks_synapse< targetidentifierT >::set_tau_rec_( const double tau_rec )
+{
+  if ( tau_rec <= 0.0 )
   {
     throw BadProperty( "'tau_rec' must be > 0." );
   }
+  tau_rec_ = tau_rec;
+}
 
-  d.update_value( names::tau_fac, tau_fac_ );
-  if ( tau_fac_ < 0.0 )
+template < typename targetidentifierT >
+void
+tsodyks_synapse< targetidentifierT >::set_tau_fac_( const double tau_fac )
+{
+  if ( tau_fac < 0.0 )
   {
     throw BadProperty( "'tau_fac' must be >= 0." );
   }
+  tau_fac_ = tau_fac;
+}
 
-  d.update_value( names::u, u_ );
-  if ( u_ > 1.0 or u_ < 0.0 )
+template < typename targetidentifierT >
+void
+tsodyks_synapse< targetidentifierT >::set_u_( const double u )
+{
+  if ( u > 1.0 or u < 0.0 )
   {
     throw BadProperty( "'u' must be in [0,1]." );
   }
+  u_ = u;
 }
 
 }  // namespace
@@ -161,6 +161,16 @@ public:
   const std::vector< spikecounter >& deliver_spikes();
 
 private:
+  //! Ring buffers of the node, summed up for the memory report
+  auto
+  ring_buffers() const
+  {
+    return std::tie( B_.neuromodulatory_spikes_ );
+  }
+
+  //! Needs access to ring_buffers() for the memory report
+  friend class GenericModel< volume_transmitter >;
+
   void init_buffers_() override;
   void pre_run_hook() override;
 
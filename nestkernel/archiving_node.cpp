@@ -71,7 +71,7 @@ ArchivingNode::register_stdp_connection( double t_first_read, double delay )
   // connections afterwards without leaving spikes in the history.
   // For details see bug #218. MH 08-04-22
 
-  for ( std::deque< histentry >::iterator runner = history_.begin();
+  for ( HistoryBuffer< histentry >::iterator runner = history_.begin();
     runner != history_.end() and ( t_first_read - runner->t_ > -1.0 * kernel().connection_manager.get_stdp_eps() );
     ++runner )
   {
@@ -83,32 +83,54 @@ ArchivingNode::register_stdp_connection( double t_first_read, double delay )
   max_delay_ = std::max( delay, max_delay_ );
 }
 
+size_t
+nest::ArchivingNode::find_last_spike_before_( double t ) const
+{
+  // search backwards, as traces are requested for recent times
+  size_t i = history_.size();
+  while ( i > 0 )
+  {
+    --i;
+    if ( t - history_[ i ].t_ > kernel().connection_manager.get_stdp_eps() )
+    {
+      return i;
+    }
+  }
+  return history_.size();
+}
+
+void
+nest::ArchivingNode::invalidate_trace_caches_()
+{
+  K_value_cache_.t_ = numerics::nan;
+  K_values_cache_.t_ = numerics::nan;
+}
+
 double
 nest::ArchivingNode::get_K_value( double t )
 {
-  // case when the neuron has not yet spiked
-  if ( history_.empty() )
+  // all synapses reading the trace for the same presynaptic spike request the same time
+  if ( t == K_value_cache_.t_ )
   {
-    trace_ = 0.;
+    trace_ = K_value_cache_.Kminus_;
     return trace_;
   }
 
   // search for the latest post spike in the history buffer that came strictly
-  // before `t`
-  int i = history_.size() - 1;
-  while ( i >= 0 )
+  // before `t`; if there is none, the neuron has not yet spiked or the trace was
+  // requested at a time precisely at or before the first spike in the history
+  const size_t i = find_last_spike_before_( t );
+  if ( i == history_.size() )
   {
-    if ( t - history_[ i ].t_ > kernel().connection_manager.get_stdp_eps() )
-    {
-      trace_ = ( history_[ i ].Kminus_ * std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ ) );
-      return trace_;
-    }
-    --i;
+    trace_ = 0.;
+  }
+  else
+  {
+    trace_ = ( history_[ i ].Kminus_ * std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ ) );
   }
 
-  // this case occurs when the trace was requested at a time precisely at or
-  // before the first spike in the history
-  trace_ = 0.;
+  K_value_cache_.t_ = t;
+  K_value_cache_.Kminus_ = trace_;
   return trace_;
 }
 
@@ -118,43 +140,51 @@ nest::ArchivingNode::get_K_values( double t,
   double& nearest_neighbor_K_value,
   double& K_triplet_value )
 {
-  // case when the neuron has not yet spiked
-  if ( history_.empty() )
+  if ( t != K_values_cache_.t_ )
   {
-    K_triplet_value = Kminus_triplet_;
-    nearest_neighbor_K_value = Kminus_;
-    K_value = Kminus_;
-    return;
-  }
+    K_values_cache_.t_ = t;
 
-  // search for the latest post spike in the history buffer that came strictly
-  // before `t`
-  int i = history_.size() - 1;
-  while ( i >= 0 )
-  {
-    if ( t - history_[ i ].t_ > kernel().connection_manager.get_stdp_eps() )
+    if ( history_.empty() )
     {
-      K_triplet_value =
-        ( history_[ i ].Kminus_triplet_ * std::exp( ( history_[ i ].t_ - t ) * tau_minus_triplet_inv_ ) );
-      K_value = ( history_[ i ].Kminus_ * std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ ) );
-      nearest_neighbor_K_value = std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ );
-      return;
+      // case when the neuron has not yet spiked
+      K_values_cache_.Kminus_triplet_ = Kminus_triplet_;
+      K_values_cache_.nearest_neighbor_Kminus_ = Kminus_;
+      K_values_cache_.Kminus_ = Kminus_;
+    }
+    else
+    {
+      // search for the latest post spike in the history buffer that came strictly
+      // before `t`
+      const size_t i = find_last_spike_before_( t );
+      if ( i == history_.size() )
+      {
+        // this case occurs when the trace was requested at a time precisely at or
+        // before the first spike in the history
+        K_values_cache_.Kminus_triplet_ = 0.0;
+        K_values_cache_.nearest_neighbor_Kminus_ = 0.0;
+        K_values_cache_.Kminus_ = 0.0;
+      }
+      else
+      {
+        const double decay = std::exp( ( history_[ i ].t_ - t ) * tau_minus_inv_ );
+        K_values_cache_.Kminus_triplet_ =
+          ( history_[ i ].Kminus_triplet_ * std::exp( ( history_[ i ].t_ - t ) * tau_minus_triplet_inv_ ) );
+        K_values_cache_.Kminus_ = history_[ i ].Kminus_ * decay;
+        K_values_cache_.nearest_neighbor_Kminus_ = decay;
+      }
     }
-    --i;
   }
 
-  // this case occurs when the trace was requested at a time precisely at or
-  // before the first spike in the history
-  K_triplet_value = 0.0;
-  nearest_neighbor_K_value = 0.0;
-  K_value = 0.0;
+  K_triplet_value = K_values_cache_.Kminus_triplet_;
+  nearest_neighbor_K_value = K_values_cache_.nearest_neighbor_Kminus_;
+  K_value = K_values_cache_.Kminus_;
 }
 
 void
 nest::ArchivingNode::get_history( double t1,
   double t2,
-  std::deque< histentry >::iterator* start,
-  std::deque< histentry >::iterator* finish )
+  HistoryBuffer< histentry >::iterator* start,
+  HistoryBuffer< histentry >::iterator* finish )
 {
   *finish = history_.end();
   if ( history_.empty() )
@@ -162,26 +192,27 @@ nest::ArchivingNode::get_history( double t1,
     *start = *finish;
     return;
   }
-  std::deque< histentry >::reverse_iterator runner = history_.rbegin();
+  HistoryBuffer< histentry >::iterator runner = history_.end();
   const double t2_lim = t2 + kernel().connection_manager.get_stdp_eps();
   const double t1_lim = t1 + kernel().connection_manager.get_stdp_eps();
-  while ( runner != history_.rend() and runner->t_ >= t2_lim )
+  while ( runner != history_.begin() and ( runner - 1 )->t_ >= t2_lim )
   {
-    ++runner;
+    --runner;
   }
-  *finish = runner.base();
-  while ( runner != history_.rend() and runner->t_ >= t1_lim )
+  *finish = runner;
+  while ( runner != history_.begin() and ( runner - 1 )->t_ >= t1_lim )
   {
+    --runner;
     runner->access_counter_++;
-    ++runner;
   }
-  *start = runner.base();
+  *start = runner;
 }
 
 void
 nest::ArchivingNode::set_spiketime( Time const& t_sp, double offset )
 {
   StructuralPlasticityNode::set_spiketime( t_sp, offset );
+  invalidate_trace_caches_();
 
   const double t_sp_ms = t_sp.get_ms() - offset;
 
@@ -256,6 +287,7 @@ nest::ArchivingNode::set_status( const Dictionary& d )
   tau_minus_triplet_ = new_tau_minus_triplet;
   tau_minus_inv_ = 1. / tau_minus_;
   tau_minus_triplet_inv_ = 1. / tau_minus_triplet_;
+  invalidate_trace_caches_();
 
   // check, if to clear spike history and K_minus
   bool clear = false;
@@ -275,6 +307,7 @@ nest::ArchivingNode::clear_history()
   Kminus_ = 0.0;
   Kminus_triplet_ = 0.0;
   history_.clear();
+  invalidate_trace_caches_();
 }
 
 
@@ -25,7 +25,9 @@
 
 // C++ includes:
 #include <algorithm>
-#include <deque>
+
+// Includes from libnestutil:
+#include "numerics.h"
 
 // Includes from nestkernel:
 #include "histentry.h"
@@ -57,6 +59,9 @@ public:
    *
    * When the trace is requested at the exact same time that the neuron emits a spike,
    * the trace value as it was just before the spike is returned.
+   *
+   * The value is cached, so that all synapses reading the trace for the
+   * same presynaptic spike time share a single evaluation.
    */
   double get_K_value( double t ) override;
 
@@ -75,15 +80,15 @@ public:
   /**
    * Return the triplet Kminus value for the associated iterator.
    */
-  double get_K_triplet_value( const std::deque< histentry >::iterator& iter );
+  double get_K_triplet_value( const HistoryBuffer< histentry >::iterator& iter );
 
   /**
    * Return the spike times (in steps) of spikes which occurred in the range [t1,t2].
    */
   void get_history( double t1,
     double t2,
-    std::deque< histentry >::iterator* start,
-    std::deque< histentry >::iterator* finish ) override;
+    HistoryBuffer< histentry >::iterator* start,
+    HistoryBuffer< histentry >::iterator* finish ) override;
 
   /**
    * Register a new incoming STDP connection.
@@ -140,7 +145,33 @@ private:
   double last_spike_;
 
   // spiking history needed by stdp synapses
-  std::deque< histentry > history_;
+  HistoryBuffer< histentry > history_;
+
+  /**
+   * Trace values cached for the most recently requested time.
+   *
+   * Caches are invalidated by setting the time to NaN whenever the history or
+   * the time constants change.
+   */
+  struct TraceCache_
+  {
+    double t_ = numerics::nan;
+    double Kminus_ = 0.0;
+    double nearest_neighbor_Kminus_ = 0.0;
+    double Kminus_triplet_ = 0.0;
+  };
+
+  TraceCache_ K_value_cache_;   //!< cache for get_K_value()
+  TraceCache_ K_values_cache_;  //!< cache for get_K_values()
+
+  /**
+   * Return position of the latest spike in the history that came strictly before t.
+   *
+   * Returns history_.size() if there is no such spike.
+   */
+  size_t find_last_spike_before_( double t ) const;
+
+  void invalidate_trace_caches_();
 };
 
 inline double
@@ -1615,6 +1615,13 @@ nest::FixedOutDegreeBuilder::connect_()
   // get global rng that is tested for synchronization for all threads
   RngPtr grng = get_rank_synced_rng();
 
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+
+  // positions in tgt_ids_ of the targets to be connected on each thread,
+  // indexed by the thread that sorted them and the thread that connects them
+  std::vector< std::vector< std::vector< size_t > > > tgt_idx_by_thread(
+    num_threads, std::vector< std::vector< size_t > >( num_threads ) );
+
   NodeCollection::const_iterator source_it = sources_->begin();
   for ( ; source_it < sources_->end(); ++source_it )
   {
@@ -1654,22 +1661,73 @@ nest::FixedOutDegreeBuilder::connect_()
       // get thread id
       const size_t tid = kernel().vp_manager.get_thread_id();
 
+      // Each thread sorts a contiguous share of the drawn targets into
+      // buckets by the thread they are connected on, so that afterwards each
+      // thread only visits its own targets. Nodes without proxies, i.e.,
+      // devices, exist on all threads of all ranks and thus go into every
+      // bucket, even if their home VP is on another rank.
       try
       {
-        RngPtr rng = get_vp_specific_rng( tid );
+        std::vector< std::vector< size_t > >& buckets = tgt_idx_by_thread[ tid ];
+        for ( auto& bucket : buckets )
+        {
+          bucket.clear();
+        }
 
-        std::vector< size_t >::const_iterator tnode_id_it = tgt_ids_.begin();
-        for ( ; tnode_id_it != tgt_ids_.end(); ++tnode_id_it )
+        const size_t k_begin = tgt_ids_.size() * tid / num_threads;
+        const size_t k_end = tgt_ids_.size() * ( tid + 1 ) / num_threads;
+        for ( size_t k = k_begin; k < k_end; ++k )
         {
-          Node* const target = kernel().node_manager.get_node_or_proxy( *tnode_id_it, tid );
-          if ( target->is_proxy() )
+          if ( not kernel().node_manager.node_has_proxies( tgt_ids_[ k ] ) )
           {
-            // skip array parameters handled in other virtual processes
-            skip_conn_parameter_( tid );
+            for ( auto& bucket : buckets )
+            {
+              bucket.push_back( k );
+            }
             continue;
           }
 
-          single_connect_( snode_id, *target, tid, rng );
+          const size_t vp = kernel().vp_manager.node_id_to_vp( tgt_ids_[ k ] );
+          if ( kernel().vp_manager.is_local_vp( vp ) )
+          {
+            buckets[ kernel().vp_manager.vp_to_thread( vp ) ].push_back( k );
+          }
+        }
+      }
+      catch ( ... )
+      {
+        // Capture the current exception object and create an std::exception_ptr
+        exceptions_raised_.at( tid ) = std::current_exception();
+      }
+
+#pragma omp barrier
+
+      try
+      {
+        RngPtr rng = get_vp_specific_rng( tid );
+
+        // position in tgt_ids_ up to which array parameters have been consumed;
+        // the shares of the sorting threads are contiguous and in order
+        size_t next_k = 0;
+        for ( size_t sorting_tid = 0; sorting_tid < num_threads; ++sorting_tid )
+        {
+          for ( const size_t k : tgt_idx_by_thread[ sorting_tid ][ tid ] )
+          {
+            if ( k > next_k )
+            {
+              // skip array parameters handled in other virtual processes
+              skip_conn_parameter_( tid, k - next_k );
+            }
+
+            Node* const target = kernel().node_manager.get_node_or_proxy( tgt_ids_[ k ], tid );
+            single_connect_( snode_id, *target, tid, rng );
+            next_k = k + 1;
+          }
+        }
+
+        if ( tgt_ids_.size() > next_k )
+        {
+          skip_conn_parameter_( tid, tgt_ids_.size() - next_k );
         }
       }
       catch ( ... )
@@ -23,6 +23,9 @@
 #ifndef CONNECTION_H
 #define CONNECTION_H
 
+// Includes from libnestutil:
+#include "block_vector.h"
+
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
 #include "connection_label.h"
@@ -116,6 +119,14 @@ public:
   // Whether this connection type supports flush events.
   static constexpr bool supports_flush_event = false;
 
+  // Whether set_status() checks the weight against other parameters, so that set_weight() must not be used
+  // to change the weight of an existing connection.
+  static constexpr bool checks_weight_in_set_status = false;
+
+  // Whether the delay is fully given by get_delay() and set_delay(), i.e., get_status() and set_status()
+  // handle it as this base class does.
+  static constexpr bool has_plain_delay = true;
+
   Connection()
     : target_()
     , syn_id_delay_( 1.0 )
@@ -235,6 +246,28 @@ public:
     const double,
     const CommonSynapseProperties& );
 
+  /**
+   * Triggers an update of the synaptic weights of all given connections
+   *
+   * Called once per Connector by a volume transmitter. The default
+   * implementation calls trigger_update_weight() on each connection.
+   * Synapse models can hide this function to share work between the
+   * connections of a Connector.
+   */
+  template < typename ConnectionT >
+  static void
+  trigger_update_weights( const size_t tid,
+    BlockVector< ConnectionT >& connections,
+    const std::vector< spikecounter >& dopa_spikes,
+    const double t_trig,
+    const typename ConnectionT::CommonPropertiesType& cp )
+  {
+    for ( auto& connection : connections )
+    {
+      connection.trigger_update_weight( tid, dopa_spikes, t_trig, cp );
+    }
+  }
+
   Node*
   get_target( const size_t tid ) const
   {
@@ -321,6 +354,16 @@ Connection< targetidentifierT >::check_connection_( Node& dummy_target,
   Node& target,
   const size_t receptor_type )
 {
+  // 0. has the same combination of models, receptor and synapse passed the checks before
+  ConnectionCheckCache& cache = kernel().connection_manager.get_connection_check_cache();
+  size_t rport = invalid_port;
+  if ( cache.find( source.get_model_id(), target.get_model_id(), receptor_type, get_syn_id(), rport ) )
+  {
+    target_.set_rport( rport );
+    target_.set_target( &target );
+    return;
+  }
+
   // 1. does this connection support the event type sent by source
   // try to send event from source to dummy_target
   // this line might throw an exception
@@ -331,7 +374,8 @@ Connection< targetidentifierT >::check_connection_( Node& dummy_target,
   // this returns the port of the incoming connection
   // p must be stored in the base class connection
   // this line might throw an exception
-  target_.set_rport( source.send_test_event( target, receptor_type, get_syn_id(), false ) );
+  rport = source.send_test_event( target, receptor_type, get_syn_id(), false );
+  target_.set_rport( rport );
 
   // 3. do the events sent by source mean the same thing as they are
   // interpreted in target?
@@ -343,6 +387,15 @@ Connection< targetidentifierT >::check_connection_( Node& dummy_target,
   }
 
   target_.set_target( &target );
+
+  // devices are excluded, since their checks often depend on their parameters or register the connection;
+  // stimulation devices with proxies opt out via has_cacheable_connection_checks
+  if ( source.has_proxies() and target.has_proxies()
+    and kernel().model_manager.get_node_model( source.get_model_id() )->has_cacheable_connection_checks()
+    and kernel().model_manager.get_node_model( target.get_model_id() )->has_cacheable_connection_checks() )
+  {
+    cache.insert( source.get_model_id(), target.get_model_id(), receptor_type, get_syn_id(), rport );
+  }
 }
 
 template < typename targetidentifierT >
@@ -0,0 +1,122 @@
+/*
+ *  connection_check_cache.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef CONNECTION_CHECK_CACHE_H
+#define CONNECTION_CHECK_CACHE_H
+
+// C++ includes:
+#include <map>
+#include <tuple>
+
+// Includes from libnestutil:
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Cache for the outcome of connection checks on one thread.
+ *
+ * Connection::check_connection_() exchanges test events between source,
+ * target and a dummy node to determine whether a connection is possible
+ * and which port it uses on the target. For most models, the outcome only
+ * depends on source model, target model, receptor type and synapse model.
+ * The cache stores the port for each such combination once a check has
+ * succeeded, so that further connections with the same combination can
+ * skip the test events. Failed checks are not cached.
+ *
+ * @see Node::has_cacheable_connection_checks
+ */
+class ConnectionCheckCache
+{
+public:
+  ConnectionCheckCache()
+    : last_key_( -1, -1, invalid_port, invalid_synindex )
+    , last_rport_( invalid_port )
+  {
+  }
+
+  /**
+   * Look up the port for the given combination.
+   *
+   * @returns true and sets rport if the combination has been checked before
+   */
+  bool
+  find( const int source_model_id,
+    const int target_model_id,
+    const size_t receptor_type,
+    const synindex syn_id,
+    size_t& rport )
+  {
+    const Key_ key( source_model_id, target_model_id, receptor_type, syn_id );
+
+    // consecutive connections mostly share all properties
+    if ( key == last_key_ )
+    {
+      rport = last_rport_;
+      return true;
+    }
+
+    const auto it = rports_.find( key );
+    if ( it == rports_.end() )
+    {
+      return false;
+    }
+
+    last_key_ = key;
+    last_rport_ = it->second;
+    rport = last_rport_;
+    return true;
+  }
+
+  //! Store the port for a combination that passed all checks
+  void
+  insert( const int source_model_id,
+    const int target_model_id,
+    const size_t receptor_type,
+    const synindex syn_id,
+    const size_t rport )
+  {
+    rports_[ Key_( source_model_id, target_model_id, receptor_type, syn_id ) ] = rport;
+  }
+
+  void
+  clear()
+  {
+    rports_.clear();
+    last_key_ = Key_( -1, -1, invalid_port, invalid_synindex );
+    last_rport_ = invalid_port;
+  }
+
+private:
+  //! Source model ID, target model ID, receptor type and synapse ID
+  using Key_ = std::tuple< int, int, size_t, synindex >;
+
+  std::map< Key_, size_t > rports_;
+  Key_ last_key_;      //!< key of last successful lookup
+  size_t last_rport_;  //!< port of last successful lookup
+};
+
+}  // namespace nest
+
+#endif /* CONNECTION_CHECK_CACHE_H */
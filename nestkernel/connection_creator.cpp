@@ -35,6 +35,8 @@ ConnectionCreator::ConnectionCreator( const Dictionary& dict )
   , number_of_connections_()
   , mask_()
   , kernel_()
+  , kernel_cutoff_( -1.0 )
+  , skip_sampling_( false )
   , synapse_model_()
   , weight_()
   , delay_()
@@ -72,6 +74,15 @@ ConnectionCreator::ConnectionCreator( const Dictionary& dict )
   {
     kernel_ = create_parameter( dict.at( names::kernel ) );
   }
+  if ( dict.known( names::kernel_cutoff ) )
+  {
+    kernel_cutoff_ = dict.get< double >( names::kernel_cutoff );
+    if ( kernel_cutoff_ < 0 )
+    {
+      throw BadProperty( "kernel_cutoff >= 0 required." );
+    }
+  }
+  dict.update_value( names::skip_sampling, skip_sampling_ );
 
   if ( dict.known( names::synapse_parameters ) )
   {
@@ -159,6 +170,12 @@ ConnectionCreator::ConnectionCreator( const Dictionary& dict )
   {
     throw BadProperty( "Unknown connection type." );
   }
+
+  if ( ( kernel_cutoff_ >= 0 or skip_sampling_ )
+    and not( type_ == Pairwise_bernoulli_on_source or type_ == Pairwise_bernoulli_on_target ) )
+  {
+    throw BadProperty( "kernel_cutoff and skip_sampling can only be used with pairwise_bernoulli." );
+  }
 }
 
 void
@@ -84,6 +84,13 @@ public:
    *   for each source or target.
    * - "mask": Mask definition (dictionary or masktype).
    * - "kernel": Kernel definition (dictionary, parametertype, or double).
+   * - "kernel_cutoff": Double, for pairwise Bernoulli connections without
+   *   mask, only consider sources within the distance beyond which the
+   *   kernel does not exceed this value, if such a distance can be derived
+   *   from the kernel.
+   * - "skip_sampling": Boolean, for pairwise Bernoulli connections with a
+   *   constant kernel, draw the number of sources skipped between
+   *   connections instead of drawing once per source.
    * - "synapse_model": The synapse model to use.
    * - "weight": Synaptic weight (dictionary, parametertype, or double).
    * - "delay": Synaptic delays (dictionary, parametertype, or double).
@@ -118,7 +125,7 @@ private:
     PoolWrapper_();
     ~PoolWrapper_();
     void define( MaskedLayer< D >* );
-    void define( std::vector< std::pair< Position< D >, size_t > >* );
+    void define( std::shared_ptr< std::vector< std::pair< Position< D >, size_t > > > );
 
     typename Ntree< D, size_t >::masked_iterator masked_begin( const Position< D >& pos ) const;
     typename Ntree< D, size_t >::masked_iterator masked_end() const;
@@ -128,7 +135,7 @@ private:
 
   private:
     MaskedLayer< D >* masked_layer_;
-    std::vector< std::pair< Position< D >, size_t > >* positions_;
+    std::shared_ptr< std::vector< std::pair< Position< D >, size_t > > > positions_;
   };
 
   void extract_params_( const Dictionary&, std::vector< Dictionary >& );
@@ -141,6 +148,37 @@ private:
     size_t tgt_thread,
     const Layer< D >& source );
 
+  /**
+   * Connect the target to the sources in the given range, evaluating the
+   * kernel for all sources at once.
+   *
+   * Only used for kernels which do not draw random numbers, so that the
+   * connections made are identical to those made by connect_to_target_().
+   */
+  template < typename Iterator, int D >
+  void connect_to_target_batched_( Iterator from,
+    Iterator to,
+    Node* tgt_ptr,
+    const std::vector< double >& target_pos,
+    size_t tgt_thread,
+    const Layer< D >& source );
+
+  /**
+   * Connect the target to the sources in the given range, each with the
+   * constant probability given by the kernel.
+   *
+   * Instead of drawing a random number for each source, the number of
+   * sources skipped before the next connection is drawn from a geometric
+   * distribution.
+   */
+  template < typename Iterator, int D >
+  void connect_to_target_skip_( Iterator from,
+    Iterator to,
+    Node* tgt_ptr,
+    const Position< D >& tgt_pos,
+    size_t tgt_thread,
+    const Layer< D >& source );
+
   template < typename Iterator, int D >
   void connect_to_target_poisson_( Iterator from,
     Iterator to,
@@ -149,6 +187,16 @@ private:
     size_t tgt_thread,
     const Layer< D >& source );
 
+  /**
+   * Return the mask used to select sources for pairwise Bernoulli connections.
+   *
+   * This is the mask given by the user or, without mask and if kernel_cutoff
+   * is given, a ball with the cutoff distance derived from the kernel.
+   * Returns an empty pointer if all sources have to be considered.
+   */
+  template < int D >
+  MaskPTR get_pairwise_bernoulli_mask_( const Layer< D >& source, const Layer< D >& target ) const;
+
   template < int D >
   void pairwise_bernoulli_on_source_( Layer< D >& source,
     NodeCollectionPTR source_nc,
@@ -180,6 +228,8 @@ private:
   ParameterPTR number_of_connections_;
   MaskPTR mask_;
   ParameterPTR kernel_;
+  double kernel_cutoff_;  //!< kernel value below which sources are skipped, negative if not used
+  bool skip_sampling_;
   std::vector< size_t > synapse_model_;
   std::vector< std::vector< Dictionary > > param_dicts_;
   std::vector< ParameterPTR > weight_;
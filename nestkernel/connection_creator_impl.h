@@ -26,6 +26,9 @@
 #include "connection_creator.h"
 
 // C++ includes:
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <vector>
 
 // Includes from nestkernel:
@@ -81,13 +84,25 @@ ConnectionCreator::connect_to_target_( Iterator from,
   size_t tgt_thread,
   const Layer< D >& source )
 {
+  if ( skip_sampling_ and dynamic_cast< const ConstantParameter* >( kernel_.get() ) )
+  {
+    connect_to_target_skip_( from, to, tgt_ptr, tgt_pos, tgt_thread, source );
+    return;
+  }
+
+  const std::vector< double > target_pos = tgt_pos.get_vector();
+  if ( kernel_ and not kernel_->is_random() )
+  {
+    connect_to_target_batched_( from, to, tgt_ptr, target_pos, tgt_thread, source );
+    return;
+  }
+
   RngPtr rng = get_vp_specific_rng( tgt_thread );
 
   // We create a source pos vector here that can be updated with the
   // source position. This is done to avoid creating and destroying
   // unnecessarily many vectors.
   std::vector< double > source_pos( D );
-  const std::vector< double > target_pos = tgt_pos.get_vector();
 
   for ( Iterator iter = from; iter != to; ++iter )
   {
@@ -113,6 +128,129 @@ ConnectionCreator::connect_to_target_( Iterator from,
   }
 }
 
+template < typename Iterator, int D >
+void
+ConnectionCreator::connect_to_target_batched_( Iterator from,
+  Iterator to,
+  Node* tgt_ptr,
+  const std::vector< double >& target_pos,
+  size_t tgt_thread,
+  const Layer< D >& source )
+{
+  RngPtr rng = get_vp_specific_rng( tgt_thread );
+
+  // Collect the candidate sources first, so that the kernel can be
+  // evaluated for all of them in a single pass over the expression tree.
+  std::vector< double > source_positions;
+  std::vector< size_t > source_node_ids;
+  for ( Iterator iter = from; iter != to; ++iter )
+  {
+    if ( not allow_autapses_ and ( iter->second == tgt_ptr->get_node_id() ) )
+    {
+      continue;
+    }
+    for ( int i = 0; i < D; ++i )
+    {
+      source_positions.push_back( iter->first[ i ] );
+    }
+    source_node_ids.push_back( iter->second );
+  }
+
+  // The kernel does not draw random numbers, so the random numbers drawn
+  // below are the same as when evaluating the kernel per node pair.
+  std::vector< double > probabilities;
+  kernel_->values( rng, source_positions, target_pos, source, tgt_ptr, probabilities );
+
+  std::vector< double > source_pos( D );
+  for ( size_t k = 0; k < source_node_ids.size(); ++k )
+  {
+    if ( rng->drand() < probabilities[ k ] )
+    {
+      std::copy_n( source_positions.begin() + k * D, D, source_pos.begin() );
+      for ( size_t indx = 0; indx < synapse_model_.size(); ++indx )
+      {
+        kernel().connection_manager.connect( source_node_ids[ k ],
+          tgt_ptr,
+          tgt_thread,
+          synapse_model_[ indx ],
+          param_dicts_[ indx ][ tgt_thread ],
+          delay_[ indx ]->value( rng, source_pos, target_pos, source, tgt_ptr ),
+          weight_[ indx ]->value( rng, source_pos, target_pos, source, tgt_ptr ) );
+      }
+    }
+  }
+}
+
+template < typename Iterator, int D >
+void
+ConnectionCreator::connect_to_target_skip_( Iterator from,
+  Iterator to,
+  Node* tgt_ptr,
+  const Position< D >& tgt_pos,
+  size_t tgt_thread,
+  const Layer< D >& source )
+{
+  const double p = static_cast< const ConstantParameter* >( kernel_.get() )->get_value();
+  if ( p <= 0 )
+  {
+    return;
+  }
+
+  RngPtr rng = get_vp_specific_rng( tgt_thread );
+
+  // For p >= 1 all sources are connected; log1p( -p ) would be NaN for p > 1
+  const bool connect_all = p >= 1.0;
+  const double log_q = connect_all ? 0.0 : std::log1p( -p );
+
+  std::vector< double > source_pos( D );
+  const std::vector< double > target_pos = tgt_pos.get_vector();
+
+  Iterator iter = from;
+  while ( iter != to )
+  {
+    if ( not connect_all )
+    {
+      // Number of sources before the next connection, geometrically distributed
+      const double skip = std::floor( std::log( 1.0 - rng->drand() ) / log_q );
+      if constexpr ( std::random_access_iterator< Iterator > )
+      {
+        if ( skip >= static_cast< double >( std::distance( iter, to ) ) )
+        {
+          break;
+        }
+        iter += static_cast< long >( skip );
+      }
+      else
+      {
+        for ( double n = 0; n < skip and iter != to; ++n )
+        {
+          ++iter;
+        }
+        if ( iter == to )
+        {
+          break;
+        }
+      }
+    }
+
+    if ( allow_autapses_ or iter->second != tgt_ptr->get_node_id() )
+    {
+      iter->first.get_vector( source_pos );
+      for ( size_t indx = 0; indx < synapse_model_.size(); ++indx )
+      {
+        kernel().connection_manager.connect( iter->second,
+          tgt_ptr,
+          tgt_thread,
+          synapse_model_[ indx ],
+          param_dicts_[ indx ][ tgt_thread ],
+          delay_[ indx ]->value( rng, source_pos, target_pos, source, tgt_ptr ),
+          weight_[ indx ]->value( rng, source_pos, target_pos, source, tgt_ptr ) );
+      }
+    }
+    ++iter;
+  }
+}
+
 template < typename Iterator, int D >
 void
 ConnectionCreator::connect_to_target_poisson_( Iterator from,
@@ -161,7 +299,7 @@ ConnectionCreator::connect_to_target_poisson_( Iterator from,
 template < int D >
 ConnectionCreator::PoolWrapper_< D >::PoolWrapper_()
   : masked_layer_( 0 )
-  , positions_( 0 )
+  , positions_()
 {
 }
 
@@ -179,18 +317,18 @@ void
 ConnectionCreator::PoolWrapper_< D >::define( MaskedLayer< D >* ml )
 {
   assert( masked_layer_ == 0 );
-  assert( positions_ == 0 );
+  assert( not positions_ );
   assert( ml != 0 );
   masked_layer_ = ml;
 }
 
 template < int D >
 void
-ConnectionCreator::PoolWrapper_< D >::define( std::vector< std::pair< Position< D >, size_t > >* pos )
+ConnectionCreator::PoolWrapper_< D >::define( std::shared_ptr< std::vector< std::pair< Position< D >, size_t > > > pos )
 {
   assert( masked_layer_ == 0 );
-  assert( positions_ == 0 );
-  assert( pos != 0 );
+  assert( not positions_ );
+  assert( pos );
   positions_ = pos;
 }
 
@@ -223,6 +361,35 @@ ConnectionCreator::PoolWrapper_< D >::end() const
 }
 
 
+template < int D >
+MaskPTR
+ConnectionCreator::get_pairwise_bernoulli_mask_( const Layer< D >& source, const Layer< D >& target ) const
+{
+  // A constant kernel does not depend on the distance, so no source can be excluded
+  if ( mask_.get() or kernel_cutoff_ < 0 or not kernel_ or dynamic_cast< const ConstantParameter* >( kernel_.get() ) )
+  {
+    return mask_;
+  }
+
+  const double radius = kernel_->get_cutoff_distance( kernel_cutoff_ );
+  if ( not std::isfinite( radius ) )
+  {
+    return MaskPTR();
+  }
+
+  // A ball extending beyond a periodic layer would visit sources more than once
+  for ( int i = 0; i < D; ++i )
+  {
+    if ( ( source.get_periodic_mask()[ i ] and 2 * radius > source.get_extent()[ i ] )
+      or ( target.get_periodic_mask()[ i ] and 2 * radius > target.get_extent()[ i ] ) )
+    {
+      return MaskPTR();
+    }
+  }
+
+  return MaskPTR( new BallMask< D >( Position< D >(), radius ) );
+}
+
 template < int D >
 void
 ConnectionCreator::pairwise_bernoulli_on_source_( Layer< D >& source,
@@ -237,10 +404,11 @@ ConnectionCreator::pairwise_bernoulli_on_source_( Layer< D >& source,
   //     connection conditionally
 
   // retrieve global positions, either for masked or unmasked pool
+  const MaskPTR mask = get_pairwise_bernoulli_mask_( source, target );
   PoolWrapper_< D > pool;
-  if ( mask_.get() )  // MaskedLayer will be freed by PoolWrapper d'tor
+  if ( mask.get() )  // MaskedLayer will be freed by PoolWrapper d'tor
   {
-    pool.define( new MaskedLayer< D >( source, mask_, allow_oversized_, source_nc ) );
+    pool.define( new MaskedLayer< D >( source, mask, allow_oversized_, source_nc ) );
   }
   else
   {
@@ -265,7 +433,7 @@ ConnectionCreator::pairwise_bernoulli_on_source_( Layer< D >& source,
         {
           const Position< D > target_pos = target.get_position( ( *tgt_it ).nc_index );
 
-          if ( mask_.get() )
+          if ( mask.get() )
           {
             connect_to_target_( pool.masked_begin( target_pos ), pool.masked_end(), tgt, target_pos, tid, source );
           }
@@ -310,12 +478,13 @@ ConnectionCreator::pairwise_bernoulli_on_target_( Layer< D >& source,
   //  2. For each source node: Compute probability, draw random number, make
   //     connection conditionally
 
+  const MaskPTR mask = get_pairwise_bernoulli_mask_( source, target );
   PoolWrapper_< D > pool;
-  if ( mask_.get() )  // MaskedLayer will be freed by PoolWrapper d'tor
+  if ( mask.get() )  // MaskedLayer will be freed by PoolWrapper d'tor
   {
     // By supplying the target layer to the MaskedLayer constructor, the
     // mask is mirrored so it may be applied to the source layer instead
-    pool.define( new MaskedLayer< D >( source, mask_, allow_oversized_, target, source_nc ) );
+    pool.define( new MaskedLayer< D >( source, mask, allow_oversized_, target, source_nc ) );
   }
   else
   {
@@ -347,7 +516,7 @@ ConnectionCreator::pairwise_bernoulli_on_target_( Layer< D >& source,
 
         const Position< D > target_pos = target.get_position( ( *tgt_it ).nc_index );
 
-        if ( mask_.get() )
+        if ( mask.get() )
         {
           // We do the same as in the target driven case, except that we calculate displacements in the target layer.
           // We therefore send in target as last parameter.
@@ -624,7 +793,7 @@ ConnectionCreator::fixed_indegree_( Layer< D >& source,
     // no mask
 
     // Get (position,node ID) pairs for all nodes in source layer
-    std::vector< std::pair< Position< D >, size_t > >* positions = source.get_global_positions_vector( source_nc );
+    const auto positions = source.get_global_positions_vector( source_nc );
 
     for ( NodeCollection::const_iterator tgt_it = target_begin; tgt_it < target_end; ++tgt_it )
     {
@@ -26,14 +26,18 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <functional>
 #include <iomanip>
 #include <limits>
+#include <map>
 #include <set>
+#include <type_traits>
 #include <vector>
 
 // Includes from libnestutil:
 #include "compose.hpp"
 #include "logging.h"
+#include "vector_util.h"
 
 // Includes from nestkernel:
 #include "clopath_archiving_node.h"
@@ -49,19 +53,23 @@
 #include "eprop_archiving_node_recurrent.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "layer.h"
 #include "nest_names.h"
 #include "nest_types.h"
 #include "node.h"
 #include "stopwatch_impl.h"
 #include "target_table_devices_impl.h"
+#include "vp_manager_impl.h"
 
 #ifdef HAVE_HDF5
 #include "sonata_connector.h"
 #endif
 
+const size_t nest::ConnectionManager::CONNECT_ARRAYS_BLOCK_SIZE_ = 1 << 20;
 
 nest::ConnectionManager::ConnectionManager()
-  : connruledict_()
+  : num_connectors_sorted_in_team_( 0 )
+  , connruledict_()
   , connbuilder_factories_()
   , thirdconnruledict_()
   , thirdconnbuilder_factories_()
@@ -71,6 +79,7 @@ nest::ConnectionManager::ConnectionManager()
   , connections_have_changed_( false )
   , get_connections_has_been_called_( false )
   , use_compressed_spikes_( true )
+  , sort_connections_by_target_( false )
   , has_primary_connections_( false )
   , check_primary_connections_()
   , secondary_connections_exist_( false )
@@ -112,9 +121,12 @@ nest::ConnectionManager::initialize( const bool adjust_number_of_threads_or_rng_
     connections_have_changed_ = false;
     get_connections_has_been_called_ = false;
     use_compressed_spikes_ = true;
+    sort_connections_by_target_ = false;
     stdp_eps_ = 1.0e-6;
     min_delay_ = max_delay_ = 1;
     sw_construction_connect.reset();
+
+    AbstractLayer::reset_caches();
   }
 
   const size_t num_threads = kernel().vp_manager.get_num_threads();
@@ -145,6 +157,10 @@ nest::ConnectionManager::initialize( const bool adjust_number_of_threads_or_rng_
   std::vector< DelayChecker > tmp( kernel().vp_manager.get_num_threads() );
   delay_checkers_.swap( tmp );
 
+  // the outcome of checks may differ after models have been added or changed
+  std::vector< ConnectionCheckCache > tmp_caches( kernel().vp_manager.get_num_threads() );
+  connection_check_caches_.swap( tmp_caches );
+
   std::vector< std::vector< size_t > > tmp2( kernel().vp_manager.get_num_threads(), std::vector< size_t >() );
   num_connections_.swap( tmp2 );
 }
@@ -195,6 +211,9 @@ nest::ConnectionManager::set_status( const Dictionary& d )
   }
 
   d.update_value( names::use_compressed_spikes, use_compressed_spikes_ );
+  d.update_value( names::sort_connections_by_target, sort_connections_by_target_ );
+
+  AbstractLayer::set_cache_status( d );
 
   //  Need to update the saved values if we have changed the delay bounds.
   if ( d.known( names::min_delay ) or d.known( names::max_delay ) )
@@ -209,6 +228,12 @@ nest::ConnectionManager::get_delay_checker()
   return delay_checkers_[ kernel().vp_manager.get_thread_id() ];
 }
 
+nest::ConnectionCheckCache&
+nest::ConnectionManager::get_connection_check_cache()
+{
+  return connection_check_caches_[ kernel().vp_manager.get_thread_id() ];
+}
+
 void
 nest::ConnectionManager::get_status( Dictionary& dict )
 {
@@ -220,6 +245,8 @@ nest::ConnectionManager::get_status( Dictionary& dict )
   dict[ names::num_connections ] = static_cast< long >( n );
   dict[ names::keep_source_table ] = keep_source_table_;
   dict[ names::use_compressed_spikes ] = use_compressed_spikes_;
+  dict[ names::sort_connections_by_target ] = sort_connections_by_target_;
+  AbstractLayer::get_cache_status( dict );
 
   sw_construction_connect.get_status( dict, names::time_construction_connect, names::time_construction_connect_cpu );
 
@@ -231,6 +258,41 @@ nest::ConnectionManager::get_status( Dictionary& dict )
   dict[ names::connection_rules ] = connection_rules;
 }
 
+void
+nest::ConnectionManager::get_memory_report( Dictionary& dict ) const
+{
+  const size_t num_threads = connections_.size();
+  std::map< std::string, std::vector< long > > bytes_per_model;
+  for ( size_t tid = 0; tid < num_threads; ++tid )
+  {
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      const ConnectorBase* connector = connections_[ tid ][ syn_id ];
+      if ( not connector )
+      {
+        continue;
+      }
+
+      const std::string name = kernel().model_manager.get_connection_model( syn_id, /* thread */ 0 ).get_name();
+      auto it = bytes_per_model.emplace( name, std::vector< long >( num_threads, 0 ) ).first;
+      it->second[ tid ] = static_cast< long >( connector->get_memory_size() );
+    }
+  }
+
+  Dictionary connections;
+  for ( const auto& [ name, bytes ] : bytes_per_model )
+  {
+    connections[ name ] = bytes;
+  }
+  dict[ names::connections ] = connections;
+
+  dict[ names::source_table ] = static_cast< long >( source_table_.get_memory_size() );
+  dict[ names::target_table ] = static_cast< long >( target_table_.get_memory_size() );
+  dict[ names::target_table_devices ] = static_cast< long >( target_table_devices_.get_memory_size() );
+  dict[ names::compressed_spike_data ] = static_cast< long >(
+    vector_util::memory_size( compressed_spike_data_ ) + vector_util::memory_size( secondary_recv_buffer_pos_ ) );
+}
+
 Dictionary
 nest::ConnectionManager::get_synapse_status( const size_t source_node_id,
   const size_t target_node_id,
@@ -247,15 +309,26 @@ nest::ConnectionManager::get_synapse_status( const size_t source_node_id,
   dict[ names::synapse_id ] = static_cast< long >( syn_id );
   dict[ names::port ] = static_cast< long >( lcid );
 
+  get_synapse_status_( source_node_id, target_node_id, tid, syn_id, lcid, dict );
+
+  return dict;
+}
+
+void
+nest::ConnectionManager::get_synapse_status_( const size_t source_node_id,
+  const size_t target_node_id,
+  const size_t tid,
+  const synindex syn_id,
+  const size_t lcid,
+  Dictionary& dict ) const
+{
   const Node* source = kernel().node_manager.get_node_or_proxy( source_node_id, tid );
   const Node* target = kernel().node_manager.get_node_or_proxy( target_node_id, tid );
 
-  // synapses from neurons to neurons and from neurons to globally receiving devices
-  if ( ( source->has_proxies() and target->has_proxies() and connections_[ tid ][ syn_id ] )
-    or ( ( source->has_proxies() and not target->has_proxies() and not target->local_receiver()
-      and connections_[ tid ][ syn_id ] ) ) )
+  const ConnectorBase* connector = get_connector_( *source, *target, tid, syn_id );
+  if ( connector )
   {
-    connections_[ tid ][ syn_id ]->get_synapse_status( tid, lcid, dict );
+    connector->get_synapse_status( tid, lcid, dict );
   }
   else if ( source->has_proxies() and not target->has_proxies() and target->local_receiver() )
   {
@@ -270,8 +343,235 @@ nest::ConnectionManager::get_synapse_status( const size_t source_node_id,
   {
     assert( false );
   }
+}
 
-  return dict;
+nest::ConnectorBase*
+nest::ConnectionManager::get_connector_( const Node& source,
+  const Node& target,
+  const size_t tid,
+  const synindex syn_id ) const
+{
+  // synapses from neurons to neurons and from neurons to globally receiving devices
+  if ( source.has_proxies() and ( target.has_proxies() or not target.local_receiver() ) )
+  {
+    return connections_[ tid ][ syn_id ];
+  }
+  return nullptr;
+}
+
+std::vector< std::vector< size_t > >
+nest::ConnectionManager::get_indices_by_thread_( const std::deque< ConnectionID >& conns ) const
+{
+  std::vector< std::vector< size_t > > indices( kernel().vp_manager.get_num_threads() );
+  for ( size_t i = 0; i < conns.size(); ++i )
+  {
+    indices[ conns[ i ].get_target_thread() ].push_back( i );
+  }
+  return indices;
+}
+
+void
+nest::ConnectionManager::get_synapse_status_column( const std::deque< ConnectionID >& conns,
+  const std::string& key,
+  double* values ) const
+{
+  get_synapse_status_column_( conns, key, values );
+}
+
+void
+nest::ConnectionManager::get_synapse_status_column( const std::deque< ConnectionID >& conns,
+  const std::string& key,
+  long* values ) const
+{
+  get_synapse_status_column_( conns, key, values );
+}
+
+template < typename ValueT >
+void
+nest::ConnectionManager::get_synapse_status_column_( const std::deque< ConnectionID >& conns,
+  const std::string& key,
+  ValueT* values ) const
+{
+  // properties stored in the connection ID
+  const std::map< std::string, std::function< size_t( const ConnectionID& ) > > id_properties = {
+    { names::source, []( const ConnectionID& conn ) { return conn.get_source_node_id(); } },
+    { names::target, []( const ConnectionID& conn ) { return conn.get_target_node_id(); } },
+    { names::target_thread, []( const ConnectionID& conn ) { return conn.get_target_thread(); } },
+    { names::synapse_id, []( const ConnectionID& conn ) { return conn.get_synapse_model_id(); } },
+    { names::port, []( const ConnectionID& conn ) { return conn.get_port(); } }
+  };
+
+  const auto id_property = id_properties.find( key );
+  if ( id_property != id_properties.end() )
+  {
+    for ( size_t i = 0; i < conns.size(); ++i )
+    {
+      values[ i ] = static_cast< ValueT >( id_property->second( conns[ i ] ) );
+    }
+    return;
+  }
+
+  const std::vector< std::vector< size_t > > indices_by_thread = get_indices_by_thread_( conns );
+  // weight and delay are doubles, other value types go through the status dictionary and its type checks
+  const bool is_weight = std::is_same_v< ValueT, double > and key == names::weight;
+  const bool is_delay = std::is_same_v< ValueT, double > and key == names::delay;
+
+  std::vector< std::exception_ptr > exceptions_raised( kernel().vp_manager.get_num_threads() );
+
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      // the dictionary is reused for all connections and cleared before each one, so that a property
+      // of another synapse model cannot be read from it
+      Dictionary dict;
+      for ( const size_t i : indices_by_thread[ tid ] )
+      {
+        const ConnectionID& conn = conns[ i ];
+
+        // read weight and delay directly from the connection where possible
+        if ( is_weight or is_delay )
+        {
+          const Node* source = kernel().node_manager.get_node_or_proxy( conn.get_source_node_id(), tid );
+          const Node* target = kernel().node_manager.get_node_or_proxy( conn.get_target_node_id(), tid );
+          const ConnectorBase* connector = get_connector_( *source, *target, tid, conn.get_synapse_model_id() );
+          if ( connector and ( is_delay ? connector->has_plain_delays() : connector->has_individual_weights() ) )
+          {
+            const size_t lcid = conn.get_port();
+            const double value = is_delay ? connector->get_delay( lcid ) : connector->get_weight( lcid );
+            values[ i ] = static_cast< ValueT >( value );
+            continue;
+          }
+        }
+
+        dict.clear();
+        get_synapse_status_( conn.get_source_node_id(),
+          conn.get_target_node_id(),
+          tid,
+          conn.get_synapse_model_id(),
+          conn.get_port(),
+          dict );
+        if ( not dict.known( key ) )
+        {
+          throw KeyError( key, "synapse status", "get_connection_status_column" );
+        }
+        values[ i ] = dict.get< ValueT >( key );
+      }
+    }
+    catch ( ... )
+    {
+      exceptions_raised.at( tid ) = std::current_exception();
+    }
+  }  // of omp parallel
+
+  for ( auto eptr : exceptions_raised )
+  {
+    if ( eptr )
+    {
+      std::rethrow_exception( eptr );
+    }
+  }
+}
+
+void
+nest::ConnectionManager::set_synapse_status_column( const std::deque< ConnectionID >& conns,
+  const std::string& key,
+  const double* values )
+{
+  set_synapse_status_column_( conns, key, values );
+}
+
+void
+nest::ConnectionManager::set_synapse_status_column( const std::deque< ConnectionID >& conns,
+  const std::string& key,
+  const long* values )
+{
+  set_synapse_status_column_( conns, key, values );
+}
+
+template < typename ValueT >
+void
+nest::ConnectionManager::set_synapse_status_column_( const std::deque< ConnectionID >& conns,
+  const std::string& key,
+  const ValueT* values )
+{
+  if ( conns.empty() )
+  {
+    return;
+  }
+
+  const std::vector< std::vector< size_t > > indices_by_thread = get_indices_by_thread_( conns );
+  // as when reading, only double values are written directly to weight and delay
+  const bool is_weight = std::is_same_v< ValueT, double > and key == names::weight;
+  const bool is_delay = std::is_same_v< ValueT, double > and key == names::delay;
+
+  std::vector< std::exception_ptr > exceptions_raised( kernel().vp_manager.get_num_threads() );
+
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      Dictionary dict;
+      dict[ key ] = values[ 0 ];
+      dict.init_access_flags( /* thread_local_dict */ true );
+
+      for ( const size_t i : indices_by_thread[ tid ] )
+      {
+        const ConnectionID& conn = conns[ i ];
+
+        // write weight and delay directly to the connection where possible
+        if ( is_weight or is_delay )
+        {
+          const Node* source = kernel().node_manager.get_node_or_proxy( conn.get_source_node_id(), tid );
+          const Node* target = kernel().node_manager.get_node_or_proxy( conn.get_target_node_id(), tid );
+          ConnectorBase* connector = get_connector_( *source, *target, tid, conn.get_synapse_model_id() );
+          if ( connector and ( is_delay ? connector->has_plain_delays() : connector->has_settable_weights() ) )
+          {
+            const size_t lcid = conn.get_port();
+            if ( is_delay )
+            {
+              connector->set_delay( lcid, values[ i ] );
+            }
+            else
+            {
+              connector->set_weight( lcid, values[ i ] );
+            }
+            dict.mark_as_accessed( key );
+            continue;
+          }
+        }
+
+        dict[ key ] = values[ i ];
+        set_synapse_status( conn.get_source_node_id(),
+          conn.get_target_node_id(),
+          tid,
+          conn.get_synapse_model_id(),
+          conn.get_port(),
+          dict );
+      }
+
+      if ( not indices_by_thread[ tid ].empty() )
+      {
+        dict.all_entries_accessed( "connection.set()", "params", /* thread_local_dict */ true );
+      }
+    }
+    catch ( ... )
+    {
+      exceptions_raised.at( tid ) = std::current_exception();
+    }
+  }  // of omp parallel
+
+  for ( auto eptr : exceptions_raised )
+  {
+    if ( eptr )
+    {
+      std::rethrow_exception( eptr );
+    }
+  }
 }
 
 void
@@ -615,161 +915,261 @@ nest::ConnectionManager::connect_arrays( const long* sources,
 
   kernel().node_manager.update_thread_local_node_data();
 
-  // Mapping pointers to the first parameter value of each parameter to their respective names.
-  // The bool indicates whether the value is an integer or not, and is determined at a later point.
-  std::map< std::string, std::pair< const double*, bool > > param_pointers;
-  if ( p_keys.size() != 0 )
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const auto synapse_model_id = kernel().model_manager.get_synapse_model_id( syn_model );
+  const auto syn_model_defaults = kernel().model_manager.get_connector_defaults( synapse_model_id );
+
+  // Receptor types are passed to the connection directly. All other parameters are columns of p_values, written
+  // into a per-thread Dictionary that is passed to the connect call, unless the connection model can set them
+  // directly (see use_param_columns below). The bool indicates whether the value is an integer or not.
+  const double* receptor_types = nullptr;
+  std::vector< std::pair< std::string, std::pair< const double*, bool > > > param_pointers;
+
+  // Dictionary holding all synapse parameters, passed to the connect call. For each thread, we keep pointers to
+  // the dictionary entries, so that no key lookups are needed when setting values.
+  std::vector< Dictionary > param_dicts( num_threads );
+  std::vector< std::vector< any_type* > > param_slots( num_threads );
+
+  for ( size_t i = 0; i < p_keys.size(); ++i )
   {
-    size_t i = 0;
-    for ( const auto& key : p_keys )
+    const auto& param_key = p_keys[ i ];
+
+    // Check that the parameter exists for the synapse model.
+    // This also takes care of dictionary access checking—any parameter given in params
+    // that is not known will be flagged here.
+    const auto syn_model_default_it = syn_model_defaults.find( param_key );
+    if ( syn_model_default_it == syn_model_defaults.end() )
     {
-      const bool is_int = ( key == names::receptor_type or key == names::music_channel or key == names::synapse_label );
+      throw BadParameter( syn_model + " does not have parameter " + param_key );
+    }
 
-      // Shifting the pointer to the first value of the parameter.
-      param_pointers[ key ] = std::make_pair( p_values + i * n, is_int );
-      ++i;
+    // If the default value is an integer, the synapse parameter must also be an integer.
+    const bool is_int = param_key == names::receptor_type or param_key == names::music_channel
+      or param_key == names::synapse_label or std::holds_alternative< long >( syn_model_default_it->second.item );
+
+    // Shifting the pointer to the first value of the parameter.
+    const double* param_pointer = p_values + i * n;
+    if ( param_key == names::receptor_type )
+    {
+      receptor_types = param_pointer;
+    }
+    else
+    {
+      param_pointers.emplace_back( param_key, std::make_pair( param_pointer, is_int ) );
     }
   }
 
-  const auto synapse_model_id = kernel().model_manager.get_synapse_model_id( syn_model );
-  const auto syn_model_defaults = kernel().model_manager.get_connector_defaults( synapse_model_id );
-
-  // Dictionary holding additional synapse parameters, passed to the connect call.
-  std::vector< Dictionary > param_dicts;
-  param_dicts.reserve( kernel().vp_manager.get_num_threads() );
-  for ( size_t i = 0; i < kernel().vp_manager.get_num_threads(); ++i )
+  // If the connection model has setters for all parameters, connections between nodes with proxies are created
+  // without dictionary and their parameters are written afterwards as columns into the connectors. The values are
+  // checked beforehand, so that no connection is created if any value is invalid.
+  const ConnectorModel& conn_model = kernel().model_manager.get_connection_model( synapse_model_id, 0 );
+  const bool use_param_columns = not param_pointers.empty()
+    and std::all_of( param_pointers.begin(),
+      param_pointers.end(),
+      [ &conn_model ]( const auto& param )
+      { return not param.second.second and conn_model.has_double_parameter_setter( param.first ); } );
+  if ( use_param_columns )
   {
-    param_dicts.emplace_back();  // Adds empty dict for thread i, filled below
-    for ( auto& param_key : p_keys )
+    for ( const auto& [ param_key, param_pointer_pair ] : param_pointers )
     {
-      // Check that the parameter exists for the synapse model.
-      // This also takes care of dictionary access checking—any parameter given in params
-      // that is not known will be flagged here.
-      const auto syn_model_default_it = syn_model_defaults.find( param_key );
-      if ( syn_model_default_it == syn_model_defaults.end() )
-      {
-        throw BadParameter( syn_model + " does not have parameter " + param_key );
-      }
+      conn_model.check_double_parameter_column( param_key, param_pointer_pair.first, weights, n );
+    }
+  }
 
-      // If the default value is an integer, the synapse parameter must also be an integer.
-      if ( std::holds_alternative< long >( syn_model_default_it->second.item ) )
+  for ( size_t tid = 0; tid < num_threads; ++tid )
+  {
+    if ( receptor_types )
+    {
+      param_dicts[ tid ][ names::receptor_type ] = 0L;
+    }
+    for ( const auto& [ param_key, param_pointer_pair ] : param_pointers )
+    {
+      if ( param_pointer_pair.second )
       {
-        param_pointers[ param_key ].second = true;
-        param_dicts[ i ][ param_key ] = 0;
+        param_dicts[ tid ][ param_key ] = 0L;
       }
       else
       {
-        param_dicts[ i ][ param_key ] = 0.0;
+        param_dicts[ tid ][ param_key ] = 0.0;
       }
+      param_slots[ tid ].push_back( &param_dicts[ tid ].at( param_key ) );
     }
   }
 
-  // Increments pointers to weight and delay, if they are specified.
-  auto increment_wd = [ weights, delays ]( decltype( weights ) & w, decltype( delays ) & d )
+  // Convert parameter value to integer, throws if the value is not integral.
+  auto to_long = []( const std::string& key, const double value )
   {
-    if ( weights )
+    const auto value_as_long = static_cast< long >( value );
+    if ( value > 1L << 31 or std::abs( value - value_as_long ) > 0 )  // To avoid rounding errors
     {
-      ++w;
-    }
-    if ( delays )
-    {
-      ++d;
+      throw BadParameter( String::compose( "Expected integer value for %1, but got double.", key ) );
     }
+    return value_as_long;
   };
 
   // Set flag before entering parallel section in case we have fewer connections than ranks.
   set_connections_have_changed();
 
   // Vector for storing exceptions raised by threads.
-  std::vector< std::exception_ptr > exceptions_raised( kernel().vp_manager.get_num_threads() );
-
-#pragma omp parallel
+  std::vector< std::exception_ptr > exceptions_raised( num_threads );
+  auto rethrow_exceptions = [ &exceptions_raised ]()
   {
-    const auto tid = kernel().vp_manager.get_thread_id();
-    try
+    for ( auto eptr : exceptions_raised )
     {
-      auto s = sources;
-      auto t = targets;
-      auto w = weights;
-      auto d = delays;
-      double weight_buffer = numerics::nan;
-      double delay_buffer = numerics::nan;
-      int index_counter = 0;  // Index of the current connection, for connection parameters
+      if ( eptr )
+      {
+        std::rethrow_exception( eptr );
+      }
+    }
+  };
+
+  // Connections are created block by block to limit the memory needed for sorting them by thread. For each block,
+  // all threads first sort a slice of the block by target thread, then each thread creates the connections it
+  // owns, visiting the slices in order so that connections are created in the order given.
+  const size_t block_size = std::min( n, CONNECT_ARRAYS_BLOCK_SIZE_ );
+  std::vector< std::vector< std::vector< size_t > > > thread_local_idx(
+    num_threads, std::vector< std::vector< size_t > >( num_threads ) );  // [slice][target thread]
+
+  for ( size_t block_begin = 0; block_begin < n; block_begin += block_size )
+  {
+    const size_t block_end = std::min( n, block_begin + block_size );
 
-      for ( ; s != sources + n; ++s, ++t, ++index_counter )
+#pragma omp parallel
+    {
+      const auto tid = kernel().vp_manager.get_thread_id();
+      try
       {
-        if ( 0 >= *s or static_cast< size_t >( *s ) > kernel().node_manager.size() )
-        {
-          throw UnknownNode( *s );
-        }
-        if ( 0 >= *t or static_cast< size_t >( *t ) > kernel().node_manager.size() )
+        for ( auto& idx : thread_local_idx[ tid ] )
         {
-          throw UnknownNode( *t );
-        }
-        auto target_node = kernel().node_manager.get_node_or_proxy( *t, tid );
-        if ( target_node->is_proxy() )
-        {
-          increment_wd( w, d );
-          continue;
+          idx.clear();
         }
 
-        // If weights or delays are specified, the buffers are replaced with the values.
-        // If not, the buffers will be NaN and replaced by a default value by the connect function.
-        if ( weights )
+        const size_t slice_begin = block_begin + ( block_end - block_begin ) * tid / num_threads;
+        const size_t slice_end = block_begin + ( block_end - block_begin ) * ( tid + 1 ) / num_threads;
+        for ( size_t i = slice_begin; i < slice_end; ++i )
         {
-          weight_buffer = *w;
-        }
-        if ( delays )
-        {
-          delay_buffer = *d;
+          if ( 0 >= sources[ i ] or static_cast< size_t >( sources[ i ] ) > kernel().node_manager.size() )
+          {
+            throw UnknownNode( sources[ i ] );
+          }
+          if ( 0 >= targets[ i ] or static_cast< size_t >( targets[ i ] ) > kernel().node_manager.size() )
+          {
+            throw UnknownNode( targets[ i ] );
+          }
+
+          // Nodes without proxies, i.e., devices, exist on all threads of all ranks and thus are put into every
+          // bucket, even if their home VP is on another rank.
+          if ( not kernel().node_manager.node_has_proxies( targets[ i ] ) )
+          {
+            for ( auto& idx : thread_local_idx[ tid ] )
+            {
+              idx.push_back( i );
+            }
+            continue;
+          }
+
+          const size_t vp = kernel().vp_manager.node_id_to_vp( targets[ i ] );
+          if ( kernel().vp_manager.is_local_vp( vp ) )
+          {
+            thread_local_idx[ tid ][ kernel().vp_manager.vp_to_thread( vp ) ].push_back( i );
+          }
         }
+      }
+      catch ( ... )
+      {
+        // Capture the current exception object and create an std::exception_ptr
+        exceptions_raised.at( tid ) = std::current_exception();
+      }
+    }  // omp parallel
 
-        // Store the key-value pair of each parameter in the Dictionary.
-        for ( auto& param_pointer_pair : param_pointers )
-        {
-          // Increment the pointer to the parameter value.
-          const auto param_pointer = param_pointer_pair.second.first;
-          const auto is_int = param_pointer_pair.second.second;
-          auto* param = param_pointer + index_counter;
+    rethrow_exceptions();
+
+#pragma omp parallel
+    {
+      const auto tid = kernel().vp_manager.get_thread_id();
+
+      // positions in the input of the connections created in the connector, if parameters are written as columns
+      std::vector< size_t > column_rows;
+      const ConnectorBase* connector = connections_[ tid ][ synapse_model_id ];
+      const size_t first_lcid = connector ? connector->size() : 0;
 
-          if ( is_int )
+      try
+      {
+        const size_t default_receptor_type =
+          kernel().model_manager.get_connection_model( synapse_model_id, tid ).get_default_receptor_type();
+
+        for ( size_t slice = 0; slice < num_threads; ++slice )
+        {
+          for ( const size_t i : thread_local_idx[ slice ][ tid ] )
           {
-            const auto rtype_as_long = static_cast< long >( *param );
+            const size_t snode_id = sources[ i ];
+            Node* target = kernel().node_manager.get_node_or_proxy( targets[ i ], tid );
+
+            // If weights or delays are specified, the values are used.
+            // If not, they will be NaN and replaced by a default value by the connect function.
+            const double weight = weights ? weights[ i ] : numerics::nan;
+            const double delay = delays ? delays[ i ] : numerics::nan;
+            const size_t receptor_type =
+              receptor_types ? to_long( names::receptor_type, receptor_types[ i ] ) : default_receptor_type;
+
+            // Connections between nodes with proxies without further parameters are created directly
+            Node* source = kernel().node_manager.get_node_or_proxy( snode_id, tid );
+            const ConnectionType connection_type = connection_required( source, target, tid );
+            if ( connection_type == NO_CONNECTION )
+            {
+              continue;
+            }
+            if ( connection_type == CONNECT and ( param_pointers.empty() or use_param_columns ) )
+            {
+              connect_( *source, *target, snode_id, tid, synapse_model_id, receptor_type, delay, weight );
+              if ( use_param_columns )
+              {
+                column_rows.push_back( i );
+              }
+              continue;
+            }
 
-            if ( *param > 1L << 31 or std::abs( *param - rtype_as_long ) > 0 )  // To avoid rounding errors
+            // Store the value of each parameter in the Dictionary.
+            if ( receptor_types )
+            {
+              param_dicts[ tid ][ names::receptor_type ] = static_cast< long >( receptor_type );
+            }
+            for ( size_t k = 0; k < param_pointers.size(); ++k )
             {
-              const std::string msg =
-                String::compose( "Expected integer value for %1, but got double.", param_pointer_pair.first );
-              throw BadParameter( msg );
+              const auto& [ param_key, param_pointer_pair ] = param_pointers[ k ];
+              const double value = param_pointer_pair.first[ i ];
+              if ( param_pointer_pair.second )
+              {
+                *param_slots[ tid ][ k ] = to_long( param_key, value );
+              }
+              else
+              {
+                *param_slots[ tid ][ k ] = value;
+              }
             }
 
-            param_dicts[ tid ][ param_pointer_pair.first ] = rtype_as_long;
-          }
-          else
-          {
-            param_dicts[ tid ][ param_pointer_pair.first ] = *param;
+            connect( snode_id, target, tid, synapse_model_id, param_dicts[ tid ], delay, weight );
           }
         }
+      }
+      catch ( ... )
+      {
+        // Capture the current exception object and create an std::exception_ptr
+        exceptions_raised.at( tid ) = std::current_exception();
+      }
 
-        connect( *s, target_node, tid, synapse_model_id, param_dicts[ tid ], delay_buffer, weight_buffer );
-
-        increment_wd( w, d );
+      // Also after an exception, all connections created must get their parameters. The values have been checked.
+      if ( not column_rows.empty() )
+      {
+        for ( const auto& [ param_key, param_pointer_pair ] : param_pointers )
+        {
+          connections_[ tid ][ synapse_model_id ]->set_double_parameter_column(
+            param_key, first_lcid, column_rows, param_pointer_pair.first );
+        }
       }
-    }
-    catch ( ... )
-    {
-      // Capture the current exception object and create an std::exception_ptr
-      exceptions_raised.at( tid ) = std::current_exception();
-    }
-  }  // omp parallel
+    }  // omp parallel
 
-  // check if any exceptions have been raised
-  for ( auto eptr : exceptions_raised )
-  {
-    if ( eptr )
-    {
-      std::rethrow_exception( eptr );
-    }
+    rethrow_exceptions();
   }
 
   kernel().connection_manager.sw_construction_connect.stop();
@@ -876,6 +1276,35 @@ nest::ConnectionManager::connect_( Node& source,
 {
   ConnectorModel& conn_model = kernel().model_manager.get_connection_model( syn_id, tid );
 
+  check_archiving_support_( conn_model, target );
+
+  const bool is_primary = conn_model.has_property( ConnectionModelProperties::IS_PRIMARY );
+  conn_model.add_connection( source, target, connections_[ tid ], syn_id, params, delay, weight );
+  register_connection_( s_node_id, tid, syn_id, is_primary );
+}
+
+void
+nest::ConnectionManager::connect_( Node& source,
+  Node& target,
+  const size_t s_node_id,
+  const size_t tid,
+  const synindex syn_id,
+  const size_t receptor_type,
+  const double delay,
+  const double weight )
+{
+  ConnectorModel& conn_model = kernel().model_manager.get_connection_model( syn_id, tid );
+
+  check_archiving_support_( conn_model, target );
+
+  const bool is_primary = conn_model.has_property( ConnectionModelProperties::IS_PRIMARY );
+  conn_model.add_connection( source, target, connections_[ tid ], syn_id, receptor_type, delay, weight );
+  register_connection_( s_node_id, tid, syn_id, is_primary );
+}
+
+void
+nest::ConnectionManager::check_archiving_support_( const ConnectorModel& conn_model, Node& target ) const
+{
   const bool clopath_archiving = conn_model.has_property( ConnectionModelProperties::REQUIRES_CLOPATH_ARCHIVING );
   if ( clopath_archiving and not dynamic_cast< ClopathArchivingNode* >( &target ) )
   {
@@ -897,9 +1326,14 @@ nest::ConnectionManager::connect_( Node& source,
   {
     throw NotImplemented( "This synapse model is not supported by the neuron model of at least one connection." );
   }
+}
 
-  const bool is_primary = conn_model.has_property( ConnectionModelProperties::IS_PRIMARY );
-  conn_model.add_connection( source, target, connections_[ tid ], syn_id, params, delay, weight );
+void
+nest::ConnectionManager::register_connection_( const size_t s_node_id,
+  const size_t tid,
+  const synindex syn_id,
+  const bool is_primary )
+{
   source_table_.add_source( tid, syn_id, s_node_id, is_primary );
 
   increase_connection_count( tid, syn_id );
@@ -1431,13 +1865,75 @@ nest::ConnectionManager::sort_connections( const size_t tid )
   assert( not source_table_.is_cleared() );
   if ( use_compressed_spikes_ )
   {
-    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+#pragma omp single
     {
-      if ( connections_[ tid ][ syn_id ] )
+      connectors_to_sort_.clear();
+      for ( size_t t = 0; t < connections_.size(); ++t )
       {
-        connections_[ tid ][ syn_id ]->sort_connections( source_table_.get_thread_local_sources( tid )[ syn_id ] );
+        for ( synindex syn_id = 0; syn_id < connections_[ t ].size(); ++syn_id )
+        {
+          if ( connections_[ t ][ syn_id ] and connections_[ t ][ syn_id ]->size() > 1 )
+          {
+            connectors_to_sort_.emplace_back( t, syn_id );
+          }
+        }
       }
+
+      // start with the largest connectors to keep the tail of the dynamic schedule short
+      std::stable_sort( connectors_to_sort_.begin(),
+        connectors_to_sort_.end(),
+        [ this ]( const std::pair< size_t, synindex >& lhs, const std::pair< size_t, synindex >& rhs )
+        {
+          return connections_[ lhs.first ][ lhs.second ]->size() > connections_[ rhs.first ][ rhs.second ]->size();
+        } );
+
+      // a connector with more than the average share of a thread cannot be balanced by the dynamic schedule
+      const size_t num_threads = kernel().vp_manager.get_num_threads();
+      size_t num_connections = 0;
+      for ( const auto& [ t, syn_id ] : connectors_to_sort_ )
+      {
+        num_connections += connections_[ t ][ syn_id ]->size();
+      }
+      num_connectors_sorted_in_team_ = 0;
+      while ( num_threads > 1 and num_connectors_sorted_in_team_ < connectors_to_sort_.size() )
+      {
+        const auto [ t, syn_id ] = connectors_to_sort_[ num_connectors_sorted_in_team_ ];
+        const size_t size = connections_[ t ][ syn_id ]->size();
+        if ( size < RADIX_SORT_TEAM_CUTOFF or size * num_threads <= num_connections )
+        {
+          break;
+        }
+        ++num_connectors_sorted_in_team_;
+      }
+    }  // implicit barrier
+
+    // all threads sort the largest connectors together, each one applied to the connections by its owning thread
+    for ( size_t i = 0; i < num_connectors_sorted_in_team_; ++i )
+    {
+      const auto [ t, syn_id ] = connectors_to_sort_[ i ];
+      connections_[ t ][ syn_id ]->sort_connections_in_team(
+        source_table_.get_thread_local_sources( t )[ syn_id ], t, radix_sort_team_buffers_ );
     }
+#pragma omp single
+    {
+      radix_sort_team_buffers_.release();
+    }  // implicit barrier
+
+#pragma omp for schedule( dynamic, 1 )
+    for ( size_t i = 0; i < connectors_to_sort_.size(); ++i )
+    {
+      const auto [ t, syn_id ] = connectors_to_sort_[ i ];
+      BlockVector< Source >& sources = source_table_.get_thread_local_sources( t )[ syn_id ];
+      if ( i >= num_connectors_sorted_in_team_ )
+      {
+        connections_[ t ][ syn_id ]->sort_connections( sources );
+      }
+      if ( sort_connections_by_target_ )
+      {
+        connections_[ t ][ syn_id ]->sort_connections_by_target( t, sources );
+      }
+    }  // implicit barrier
+
     remove_disabled_connections_( tid );
   }
 }
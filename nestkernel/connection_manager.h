@@ -32,6 +32,7 @@
 
 // Includes from nestkernel:
 #include "conn_builder.h"
+#include "connection_check_cache.h"
 #include "connection_id.h"
 #include "connector_base.h"
 #include "nest_time.h"
@@ -78,6 +79,15 @@ public:
   void set_status( const Dictionary& ) override;
   void get_status( Dictionary& ) override;
 
+  /**
+   * Add estimates of the memory held by connection data structures to the
+   * given dictionary, in bytes.
+   *
+   * The entry connections contains for each synapse model with connections
+   * the memory held by the connectors on each thread.
+   */
+  void get_memory_report( Dictionary& ) const;
+
   bool valid_connection_rule( std::string );
 
   void compute_target_data_buffer_size();
@@ -164,6 +174,20 @@ public:
    */
   bool connect( const size_t snode_id, const size_t target, const Dictionary& params, const synindex syn_id );
 
+  /**
+   * Connect nodes given as arrays of sources and targets.
+   *
+   * Connections are sorted by target thread and each thread only creates its
+   * own connections. Connections between nodes with proxies that have no
+   * parameters besides weight, delay and receptor type are created without
+   * a parameter dictionary. The same holds if the synapse model provides
+   * setters for all further parameters, see
+   * ConnectorModel::has_double_parameter_setter(); their values are then
+   * written as columns into the connectors.
+   *
+   * \param p_keys Names of additional synapse parameters.
+   * \param p_values Values of additional synapse parameters, one column of n values per key.
+   */
   void connect_arrays( const long* sources,
     const long* targets,
     const double* weights,
@@ -230,6 +254,35 @@ public:
     const size_t lcid,
     const Dictionary& dict );
 
+  /**
+   * Write the value of one synapse property of each of the given
+   * connections to values.
+   *
+   * values must provide space for one entry per connection. The
+   * connections of each thread are read by that thread. The properties
+   * source, target, target_thread, synapse_id and port are taken from the
+   * connection IDs without accessing the connections.
+   *
+   * @throws KeyError if a connection does not have the property
+   */
+  void
+  get_synapse_status_column( const std::deque< ConnectionID >& conns, const std::string& key, double* values ) const;
+  void get_synapse_status_column( const std::deque< ConnectionID >& conns, const std::string& key, long* values ) const;
+
+  /**
+   * Set one synapse property of each of the given connections to the
+   * corresponding entry of values.
+   *
+   * The connections of each thread are updated by that thread.
+   *
+   * @throws UnaccessedDictionaryEntry if the connections do not have the property
+   */
+  void set_synapse_status_column( const std::deque< ConnectionID >& conns,
+    const std::string& key,
+    const double* values );
+  void
+  set_synapse_status_column( const std::deque< ConnectionID >& conns, const std::string& key, const long* values );
+
   /**
    * Return connections between pairs of neurons.
    *
@@ -306,6 +359,25 @@ public:
     const std::vector< ConnectorModel* >& cm,
     Event& e );
 
+  /**
+   * Send spike event with multiplicity.
+   *
+   * Synapse types that do not declare ConnectionModelProperties::SUPPORTS_MULTIPLICITY receive
+   * the spike as a sequence of events with multiplicity one.
+   *
+   * Returns the number of connections of the source.
+   */
+  size_t send( const size_t tid,
+    const synindex syn_id,
+    const size_t lcid,
+    const std::vector< ConnectorModel* >& cm,
+    SpikeEvent& e );
+
+  /**
+   * Prefetch the connection at the given position, see ConnectorBase::prefetch().
+   */
+  void prefetch_connection( const size_t tid, const synindex syn_id, const size_t lcid ) const;
+
   /**
    * Send event e to all device targets of source source_node_id
    */
@@ -336,6 +408,9 @@ public:
   //! Returns the delay checker for the current thread.
   DelayChecker& get_delay_checker();
 
+  //! Returns the cache of connection checks for the current thread.
+  ConnectionCheckCache& get_connection_check_cache();
+
   //! Removes processed entries from source table
   void clean_source_table( const size_t tid );
 
@@ -386,6 +461,12 @@ public:
   /**
    * Sorts connections in the presynaptic infrastructure by increasing
    * source node ID.
+   *
+   * Must be called by all threads in a parallel region. Connectors are
+   * sorted by whichever thread is free, largest first, so that threads
+   * with many or large connectors do not hold up the others. Connectors
+   * with more than the average number of connections per thread are
+   * first sorted by all threads together, see radix_sort_in_team().
    */
   void sort_connections( const size_t tid );
 
@@ -465,6 +546,40 @@ public:
 private:
   size_t get_num_target_data( const size_t tid ) const;
 
+  /**
+   * Write the status of the connection to dict, without the entries
+   * taken from the connection ID, see get_synapse_status().
+   */
+  void get_synapse_status_( const size_t source_node_id,
+    const size_t target_node_id,
+    const size_t tid,
+    const synindex syn_id,
+    const size_t lcid,
+    Dictionary& dict ) const;
+
+  /**
+   * Return the connector that stores connections with syn_id from source to
+   * target on thread tid, or nullptr if they are stored in the device tables.
+   */
+  ConnectorBase*
+  get_connector_( const Node& source, const Node& target, const size_t tid, const synindex syn_id ) const;
+
+  /**
+   * Return the positions of the given connections in conns, grouped by
+   * target thread.
+   */
+  std::vector< std::vector< size_t > > get_indices_by_thread_( const std::deque< ConnectionID >& conns ) const;
+
+  //! See get_synapse_status_column()
+  template < typename ValueT >
+  void
+  get_synapse_status_column_( const std::deque< ConnectionID >& conns, const std::string& key, ValueT* values ) const;
+
+  //! See set_synapse_status_column()
+  template < typename ValueT >
+  void
+  set_synapse_status_column_( const std::deque< ConnectionID >& conns, const std::string& key, const ValueT* values );
+
   size_t get_num_connections_( const size_t tid, const synindex syn_id ) const;
 
   //! See get_connections()
@@ -558,6 +673,33 @@ private:
     const double delay = numerics::nan,
     const double weight = numerics::nan );
 
+  /**
+   * connect_ variant without parameter dictionary, used for bulk connection.
+   *
+   * Creates a connection from the model's default connection, setting only
+   * receptor type, delay and weight. Delay and weight are ignored if NaN.
+   *
+   * \param receptor_type The receptor type of the connection.
+   */
+  void connect_( Node& source,
+    Node& target,
+    const size_t s_node_id,
+    const size_t tid,
+    const synindex syn_id,
+    const size_t receptor_type,
+    const double delay,
+    const double weight );
+
+  /**
+   * Throw NotImplemented if the synapse model requires archiving not supported by the target.
+   */
+  void check_archiving_support_( const ConnectorModel& conn_model, Node& target ) const;
+
+  /**
+   * Register a newly created connection in source table and connection counts.
+   */
+  void register_connection_( const size_t s_node_id, const size_t tid, const synindex syn_id, const bool is_primary );
+
   /**
    * connect_to_device_ is used to establish a connection between a sender and
    * receiving node if the sender has proxies, and the receiver does not.
@@ -623,6 +765,18 @@ private:
    */
   std::vector< std::vector< ConnectorBase* > > connections_;
 
+  //! Connectors to sort in sort_connections(), as pairs of thread and synapse type
+  std::vector< std::pair< size_t, synindex > > connectors_to_sort_;
+
+  //! Number of connectors at the front of connectors_to_sort_ that all threads sort together
+  size_t num_connectors_sorted_in_team_;
+
+  //! Arrays shared by the threads sorting the largest connectors together
+  RadixSortTeamBuffers radix_sort_team_buffers_;
+
+  //! Number of connections sorted by target thread at once in connect_arrays()
+  static const size_t CONNECT_ARRAYS_BLOCK_SIZE_;
+
   /**
    * A structure to hold the node IDs of presynaptic neurons during
    * postsynaptic connection creation, before the connection
@@ -657,6 +811,9 @@ private:
 
   std::vector< DelayChecker > delay_checkers_;
 
+  //! Outcome of connection checks per combination of models, receptor and synapse, one per thread
+  std::vector< ConnectionCheckCache > connection_check_caches_;
+
   /**
    * A structure to count the number of synapses of a specific
    * type. Arranged in a 2d structure: threads|synapsetypes.
@@ -697,6 +854,14 @@ private:
    */
   bool use_compressed_spikes_;
 
+  /**
+   * Whether to order the connections of each source by target node ID
+   * when connections are sorted, see
+   * ConnectorBase::sort_connections_by_target(); only used with
+   * spike compression.
+   */
+  bool sort_connections_by_target_;
+
   //! Whether primary connections (spikes) exist.
   bool has_primary_connections_;
 
@@ -916,6 +1081,36 @@ ConnectionManager::send( const size_t tid,
   connections_[ tid ][ syn_id ]->send( tid, lcid, cm, e );
 }
 
+inline size_t
+ConnectionManager::send( const size_t tid,
+  const synindex syn_id,
+  const size_t lcid,
+  const std::vector< ConnectorModel* >& cm,
+  SpikeEvent& e )
+{
+  const size_t multiplicity = e.get_multiplicity();
+  if ( multiplicity == 1 or cm[ syn_id ]->has_property( ConnectionModelProperties::SUPPORTS_MULTIPLICITY ) )
+  {
+    return connections_[ tid ][ syn_id ]->send( tid, lcid, cm, e );
+  }
+
+  // Unroll spike multiplicity as plastic synapses only handle individual spikes.
+  e.set_multiplicity( 1 );
+  size_t num_connections = 0;
+  for ( size_t i = 0; i < multiplicity; ++i )
+  {
+    num_connections = connections_[ tid ][ syn_id ]->send( tid, lcid, cm, e );
+  }
+  e.set_multiplicity( multiplicity );
+  return num_connections;
+}
+
+inline void
+ConnectionManager::prefetch_connection( const size_t tid, const synindex syn_id, const size_t lcid ) const
+{
+  connections_[ tid ][ syn_id ]->prefetch( lcid );
+}
+
 inline void
 ConnectionManager::restructure_connection_tables( const size_t tid )
 {
@@ -27,7 +27,11 @@
 #include "config.h"
 
 // C++ includes:
+#include <algorithm>
+#include <concepts>
 #include <cstdlib>
+#include <numeric>
+#include <string>
 #include <vector>
 
 // Includes from libnestutil:
@@ -51,6 +55,52 @@
 namespace nest
 {
 
+/**
+ * Hint to the processor that the memory at the given address will be
+ * accessed soon, so that it can be loaded into the cache in the background.
+ */
+inline void
+prefetch( const void* address )
+{
+#if defined( __GNUC__ )
+  __builtin_prefetch( address );
+#endif
+}
+
+/**
+ * Connection types that store an individual weight per connection and
+ * provide it through get_weight().
+ */
+template < typename ConnectionT >
+concept HasIndividualWeight = requires( const ConnectionT& c ) { c.get_weight(); };
+
+/**
+ * Connection types with individual weights that can be changed with
+ * set_weight() without the checks in set_status().
+ */
+template < typename ConnectionT >
+concept HasSettableWeight = HasIndividualWeight< ConnectionT > and not ConnectionT::checks_weight_in_set_status;
+
+/**
+ * Function setting a double parameter of a connection.
+ *
+ * It throws BadProperty for invalid values, as set_status() does.
+ */
+template < typename ConnectionT >
+using DoubleParameterSetter = void ( * )( ConnectionT&, const double );
+
+/**
+ * Connection types that provide setters for some of their double parameters,
+ * so that these can be written without a status dictionary.
+ *
+ * get_double_parameter_setter() returns nullptr for parameters that can only
+ * be set with set_status().
+ */
+template < typename ConnectionT >
+concept HasDoubleParameterSetters = requires( const std::string& name ) {
+  { ConnectionT::get_double_parameter_setter( name ) } -> std::same_as< DoubleParameterSetter< ConnectionT > >;
+};
+
 /**
  * Base class to allow storing Connectors for different synapse types
  * in vectors. We define the interface here to avoid casting.
@@ -79,6 +129,14 @@ public:
    */
   virtual size_t size() const = 0;
 
+  /**
+   * Return the number of bytes of memory held by this Connector.
+   *
+   * Counts the storage allocated for connections, not memory that
+   * individual connections may allocate themselves.
+   */
+  virtual size_t get_memory_size() const = 0;
+
   /**
    * Write status of the connection at position lcid to the dictionary
    * dict.
@@ -91,6 +149,65 @@ public:
    */
   virtual void set_synapse_status( const size_t tid, const Dictionary& dict, ConnectorModel& cm ) = 0;
 
+  /**
+   * Return true if the connections store an individual weight that can be
+   * read with get_weight().
+   */
+  virtual bool has_individual_weights() const = 0;
+
+  /**
+   * Return the weight of the connection at position lcid.
+   *
+   * Must only be called if has_individual_weights() is true.
+   */
+  virtual double get_weight( const size_t lcid ) const = 0;
+
+  /**
+   * Return true if the weights can be changed with set_weight().
+   */
+  virtual bool has_settable_weights() const = 0;
+
+  /**
+   * Set the weight of the connection at position lcid.
+   *
+   * Must only be called if has_settable_weights() is true.
+   */
+  virtual void set_weight( const size_t lcid, const double weight ) = 0;
+
+  /**
+   * Return true if the delays can be read with get_delay() and changed
+   * with set_delay().
+   */
+  virtual bool has_plain_delays() const = 0;
+
+  /**
+   * Return the delay in ms of the connection at position lcid.
+   *
+   * Must only be called if has_plain_delays() is true.
+   */
+  virtual double get_delay( const size_t lcid ) const = 0;
+
+  /**
+   * Set the delay in ms of the connection at position lcid.
+   *
+   * Must only be called if has_plain_delays() is true. Throws BadDelay if
+   * the delay is not valid.
+   */
+  virtual void set_delay( const size_t lcid, const double delay ) = 0;
+
+  /**
+   * Set a double parameter of consecutive connections.
+   *
+   * The connection at position first_lcid + j is given the value
+   * values[ rows[ j ] ]. Must only be called for parameters accepted by
+   * ConnectorModel::has_double_parameter_setter(), with values checked by
+   * ConnectorModel::check_double_parameter_column().
+   */
+  virtual void set_double_parameter_column( const std::string& name,
+    const size_t first_lcid,
+    const std::vector< size_t >& rows,
+    const double* values ) = 0;
+
   /**
    * Add ConnectionID with given source_node_id and lcid to conns. If
    * target_node_id is given, only add connection if target_node_id matches
@@ -176,6 +293,38 @@ public:
    */
   virtual void sort_connections( BlockVector< Source >& ) = 0;
 
+  /**
+   * Sort connections according to source node IDs, sharing the work among
+   * all threads of the enclosing parallel region.
+   *
+   * Must be called by all threads of the team with the same arguments.
+   * Only thread owner moves the connections, see radix_sort_in_team().
+   */
+  virtual void sort_connections_in_team( BlockVector< Source >&, const size_t owner, RadixSortTeamBuffers& ) = 0;
+
+  /**
+   * Order the connections of each source by the node IDs of their targets.
+   *
+   * Connections to the same target become adjacent, and the targets of
+   * a spike are visited in an order that does not depend on the order
+   * in which connections were created. Each node is a separate
+   * allocation, so node ID order is not memory order; nodes are ordered
+   * by ID rather than address to keep the connection order reproducible.
+   * Connections to the same target keep their relative order. Requires
+   * connections sorted by source, see sort_connections().
+   *
+   * @param tid thread to which the connections belong
+   */
+  virtual void sort_connections_by_target( const size_t tid, BlockVector< Source >& ) = 0;
+
+  /**
+   * Prefetch the connection at the given position.
+   *
+   * This allows the connection to be loaded into the cache while other
+   * spikes are delivered.
+   */
+  virtual void prefetch( const size_t lcid ) const = 0;
+
   /**
    * Set a flag in the connection indicating whether the following
    * connection belongs to the same source.
@@ -223,6 +372,9 @@ private:
   BlockVector< ConnectionT > C_;
   const synindex syn_id_;
 
+  //! Number of connections ahead of the current one whose targets are prefetched in send()
+  static constexpr size_t TARGET_PREFETCH_DISTANCE = 4;
+
 public:
   explicit Connector( const synindex syn_id )
     : syn_id_( syn_id )
@@ -246,6 +398,12 @@ public:
     return C_.size();
   }
 
+  size_t
+  get_memory_size() const override
+  {
+    return sizeof( *this ) + C_.capacity() * sizeof( ConnectionT );
+  }
+
   void
   get_synapse_status( const size_t tid, const size_t lcid, Dictionary& dict ) const override
   {
@@ -266,6 +424,89 @@ public:
     C_[ lcid ].set_status( dict, static_cast< GenericConnectorModel< ConnectionT >& >( cm ) );
   }
 
+  bool
+  has_individual_weights() const override
+  {
+    return HasIndividualWeight< ConnectionT >;
+  }
+
+  double
+  get_weight( const size_t lcid ) const override
+  {
+    assert( lcid < C_.size() );
+
+    if constexpr ( HasIndividualWeight< ConnectionT > )
+    {
+      return C_[ lcid ].get_weight();
+    }
+    else
+    {
+      assert( false );
+      return 0.0;
+    }
+  }
+
+  bool
+  has_settable_weights() const override
+  {
+    return HasSettableWeight< ConnectionT >;
+  }
+
+  void
+  set_weight( const size_t lcid, const double weight ) override
+  {
+    assert( lcid < C_.size() );
+
+    if constexpr ( HasSettableWeight< ConnectionT > )
+    {
+      C_[ lcid ].set_weight( weight );
+    }
+    else
+    {
+      assert( false );
+    }
+  }
+
+  bool
+  has_plain_delays() const override
+  {
+    return ConnectionT::has_plain_delay;
+  }
+
+  double
+  get_delay( const size_t lcid ) const override
+  {
+    assert( lcid < C_.size() );
+    assert( ConnectionT::has_plain_delay );
+
+    return C_[ lcid ].get_delay();
+  }
+
+  void set_delay( const size_t lcid, const double delay ) override;
+
+  void
+  set_double_parameter_column( const std::string& name,
+    const size_t first_lcid,
+    const std::vector< size_t >& rows,
+    const double* values ) override
+  {
+    assert( first_lcid + rows.size() <= C_.size() );
+
+    if constexpr ( HasDoubleParameterSetters< ConnectionT > )
+    {
+      const DoubleParameterSetter< ConnectionT > setter = ConnectionT::get_double_parameter_setter( name );
+      assert( setter );
+      for ( size_t j = 0; j < rows.size(); ++j )
+      {
+        setter( C_[ first_lcid + j ], values[ rows[ j ] ] );
+      }
+    }
+    else
+    {
+      assert( false );
+    }
+  }
+
   void
   push_back( const ConnectionT& c )
   {
@@ -408,8 +649,22 @@ public:
 
     size_t lcid_offset = 0;
 
+    // Targets are prefetched a few connections ahead, but only within the run of connections of this source
+    size_t prefetch_lcid = lcid;
+    bool prefetch_has_more_targets = true;
+
     while ( true )
     {
+      while ( prefetch_has_more_targets and prefetch_lcid < lcid + lcid_offset + TARGET_PREFETCH_DISTANCE )
+      {
+        prefetch_has_more_targets = C_[ prefetch_lcid ].source_has_more_targets();
+        if ( prefetch_has_more_targets )
+        {
+          ++prefetch_lcid;
+          nest::prefetch( C_[ prefetch_lcid ].get_target( tid ) );
+        }
+      }
+
       assert( lcid + lcid_offset < C_.size() );
       ConnectionT& conn = C_[ lcid + lcid_offset ];
 
@@ -444,19 +699,15 @@ public:
     const double t_trig,
     const std::vector< ConnectorModel* >& cm ) override
   {
-    for ( size_t i = 0; i < C_.size(); ++i )
+    // The volume transmitter is a property of the synapse model, so it only needs to be checked once
+    const typename ConnectionT::CommonPropertiesType& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+    if ( cp.get_vt_node_id() != vt_node_id )
     {
-      if ( static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )
-             ->get_common_properties()
-             .get_vt_node_id()
-        == vt_node_id )
-      {
-        C_[ i ].trigger_update_weight( tid,
-          dopa_spikes,
-          t_trig,
-          static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties() );
-      }
+      return;
     }
+
+    ConnectionT::trigger_update_weights( tid, C_, dopa_spikes, t_trig, cp );
   }
 
   void
@@ -465,6 +716,67 @@ public:
     nest::sort( sources, C_ );
   }
 
+  void
+  sort_connections_in_team( BlockVector< Source >& sources, const size_t owner, RadixSortTeamBuffers& team ) override
+  {
+    radix_sort_in_team( sources, C_, owner, team );
+  }
+
+  void
+  sort_connections_by_target( const size_t tid, BlockVector< Source >& sources ) override
+  {
+    const size_t num_connections = C_.size();
+    std::vector< size_t > perm;
+    std::vector< size_t > target_node_ids;
+
+    size_t begin = 0;
+    while ( begin < num_connections )
+    {
+      // find the run of connections with the same source
+      size_t end = begin + 1;
+      while ( end < num_connections and sources[ end ].get_node_id() == sources[ begin ].get_node_id()
+        and sources[ end ].is_disabled() == sources[ begin ].is_disabled() )
+      {
+        ++end;
+      }
+
+      if ( end - begin > 1 )
+      {
+        target_node_ids.clear();
+        for ( size_t lcid = begin; lcid < end; ++lcid )
+        {
+          target_node_ids.push_back( C_[ lcid ].get_target( tid )->get_node_id() );
+        }
+
+        if ( not std::is_sorted( target_node_ids.begin(), target_node_ids.end() ) )
+        {
+          if ( perm.empty() )
+          {
+            perm.resize( num_connections );
+            std::iota( perm.begin(), perm.end(), 0 );
+          }
+          std::stable_sort( perm.begin() + begin,
+            perm.begin() + end,
+            [ &target_node_ids, begin ]( const size_t lhs, const size_t rhs )
+            { return target_node_ids[ lhs - begin ] < target_node_ids[ rhs - begin ]; } );
+        }
+      }
+
+      begin = end;
+    }
+
+    if ( not perm.empty() )
+    {
+      apply_permutation( C_, sources, perm );
+    }
+  }
+
+  void
+  prefetch( const size_t lcid ) const override
+  {
+    nest::prefetch( &C_[ lcid ] );
+  }
+
   void
   set_source_has_more_targets( const size_t lcid, const bool has_more_targets ) override
   {
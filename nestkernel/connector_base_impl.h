@@ -23,6 +23,7 @@
 #include "connector_base.h"
 
 // Includes from nestkernel:
+#include "delay_checker.h"
 #include "kernel_manager.h"
 
 // Includes from models:
@@ -34,6 +35,17 @@
 namespace nest
 {
 
+template < typename ConnectionT >
+void
+Connector< ConnectionT >::set_delay( const size_t lcid, const double delay )
+{
+  assert( lcid < C_.size() );
+  assert( ConnectionT::has_plain_delay );
+
+  kernel().connection_manager.get_delay_checker().assert_valid_delay_ms( delay );
+  C_[ lcid ].set_delay( delay );
+}
+
 template < typename ConnectionT >
 void
 Connector< ConnectionT >::send_weight_event( const size_t tid,
@@ -56,7 +56,8 @@ enum class ConnectionModelProperties : unsigned
   REQUIRES_SYMMETRIC = 1 << 5,
   REQUIRES_CLOPATH_ARCHIVING = 1 << 6,
   REQUIRES_URBANCZIK_ARCHIVING = 1 << 7,
-  REQUIRES_EPROP_ARCHIVING = 1 << 8
+  REQUIRES_EPROP_ARCHIVING = 1 << 8,
+  SUPPORTS_MULTIPLICITY = 1 << 9
 };
 
 template <>
@@ -99,6 +100,43 @@ public:
     const double delay = NAN,
     const double weight = NAN ) = 0;
 
+  /**
+   * Adds a connection without parameter dictionary.
+   *
+   * Used for bulk connection, where filling and parsing a dictionary for each
+   * connection would dominate. Apart from the receptor type, delay and weight,
+   * the connection has the parameters of the default connection.
+   *
+   * @param receptor_type Receptor type of the connection
+   */
+  virtual void add_connection( Node& src,
+    Node& tgt,
+    std::vector< ConnectorBase* >& hetconn,
+    const synindex syn_id,
+    const size_t receptor_type,
+    const double delay,
+    const double weight ) = 0;
+
+  //! Return receptor type used for connections if no receptor type is given
+  virtual size_t get_default_receptor_type() const = 0;
+
+  /**
+   * Return true if the double parameter name of connections can be written
+   * with ConnectorBase::set_double_parameter_column().
+   */
+  virtual bool has_double_parameter_setter( const std::string& name ) const = 0;
+
+  /**
+   * Throw BadProperty if any of the n values is invalid for the double parameter name.
+   *
+   * Some parameters are checked against the weight of the connection, which is given by weights, or is the
+   * default weight if weights is nullptr. Must only be called if has_double_parameter_setter() is true for name.
+   */
+  virtual void check_double_parameter_column( const std::string& name,
+    const double* values,
+    const double* weights,
+    const size_t n ) const = 0;
+
   virtual ConnectorModel* clone( std::string, synindex syn_id ) const = 0;
 
   virtual void calibrate( const TimeConverter& tc ) = 0;
@@ -179,6 +217,27 @@ public:
     const double delay,
     const double weight ) override;
 
+  void add_connection( Node& src,
+    Node& tgt,
+    std::vector< ConnectorBase* >& hetconn,
+    const synindex syn_id,
+    const size_t receptor_type,
+    const double delay,
+    const double weight ) override;
+
+  size_t
+  get_default_receptor_type() const override
+  {
+    return receptor_type_;
+  }
+
+  bool has_double_parameter_setter( const std::string& name ) const override;
+
+  void check_double_parameter_column( const std::string& name,
+    const double* values,
+    const double* weights,
+    const size_t n ) const override;
+
   ConnectorModel* clone( std::string, synindex ) const override;
 
   void calibrate( const TimeConverter& tc ) override;
@@ -201,6 +201,52 @@ GenericConnectorModel< ConnectionT >::used_default_delay()
   }
 }
 
+template < typename ConnectionT >
+bool
+GenericConnectorModel< ConnectionT >::has_double_parameter_setter( const std::string& name ) const
+{
+  if constexpr ( HasDoubleParameterSetters< ConnectionT > )
+  {
+    return ConnectionT::get_double_parameter_setter( name ) != nullptr;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::check_double_parameter_column( const std::string& name,
+  const double* values,
+  const double* weights,
+  const size_t n ) const
+{
+  if constexpr ( HasDoubleParameterSetters< ConnectionT > )
+  {
+    const DoubleParameterSetter< ConnectionT > setter = ConnectionT::get_double_parameter_setter( name );
+    assert( setter );
+
+    // the setters throw for invalid values, so we apply them to a scratch connection
+    ConnectionT connection = ConnectionT( default_connection_ );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if constexpr ( HasIndividualWeight< ConnectionT > )
+      {
+        if ( weights )
+        {
+          connection.set_weight( weights[ i ] );
+        }
+      }
+      setter( connection, values[ i ] );
+    }
+  }
+  else
+  {
+    assert( false );
+  }
+}
+
 template < typename ConnectionT >
 size_t
 GenericConnectorModel< ConnectionT >::get_syn_id() const
@@ -290,6 +336,44 @@ GenericConnectorModel< ConnectionT >::add_connection( Node& src,
   add_connection_( src, tgt, thread_local_connectors, syn_id, connection, actual_receptor_type );
 }
 
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::add_connection( Node& src,
+  Node& tgt,
+  std::vector< ConnectorBase* >& thread_local_connectors,
+  const synindex syn_id,
+  const size_t receptor_type,
+  const double delay,
+  const double weight )
+{
+  if ( not numerics::is_nan( delay ) )
+  {
+    if ( has_property( ConnectionModelProperties::HAS_DELAY ) )
+    {
+      kernel().connection_manager.get_delay_checker().assert_valid_delay_ms( delay );
+    }
+  }
+  else
+  {
+    used_default_delay();
+  }
+
+  // create a new instance of the default connection
+  ConnectionT connection = ConnectionT( default_connection_ );
+
+  if ( not numerics::is_nan( weight ) )
+  {
+    connection.set_weight( weight );
+  }
+
+  if ( not numerics::is_nan( delay ) )
+  {
+    connection.set_delay( delay );
+  }
+
+  add_connection_( src, tgt, thread_local_connectors, syn_id, connection, receptor_type );
+}
+
 
 template < typename ConnectionT >
 void
@@ -23,9 +23,12 @@
 #include "event_delivery_manager.h"
 
 // C++ includes:
-#include <algorithm>  // rotate
+#include <algorithm>  // rotate, copy, clamp, min, equal
 #include <numeric>    // accumulate
 
+// Includes from libnestutil:
+#include "vector_util.h"
+
 // Includes from nestkernel:
 #include "connection_manager.h"
 #include "connection_manager_impl.h"
@@ -56,6 +59,8 @@ EventDeliveryManager::EventDeliveryManager()
   , recv_buffer_spike_data_()
   , send_buffer_off_grid_spike_data_()
   , recv_buffer_off_grid_spike_data_()
+  , num_spikes_received_per_rank_()
+  , spikes_per_batch_()
   , send_buffer_target_data_()
   , recv_buffer_target_data_()
   , buffer_size_target_data_has_changed_( false )
@@ -65,6 +70,8 @@ EventDeliveryManager::EventDeliveryManager()
   , send_recv_buffer_grow_extra_( 0.5 )
   , send_recv_buffer_resize_log_()
   , gather_completed_checker_()
+  , overlap_spike_communication_( false )
+  , spike_data_exchange_pending_( false )
 {
 }
 
@@ -88,11 +95,14 @@ EventDeliveryManager::initialize( const bool adjust_number_of_threads_or_rng_onl
     send_recv_buffer_shrink_spare_ = 0.1;
     send_recv_buffer_grow_extra_ = 0.5;
     send_recv_buffer_resize_log_.clear();
+    overlap_spike_communication_ = false;
+    spike_data_exchange_pending_ = false;
   }
 
   const size_t num_threads = kernel().vp_manager.get_num_threads();
 
   local_spike_counter_.resize( num_threads, 0 );
+  spikes_per_batch_.assign( num_threads, INITIAL_SPIKES_PER_BATCH );
   reset_counters();
   emitted_spikes_register_.resize( num_threads );
   off_grid_emitted_spikes_register_.resize( num_threads );
@@ -117,6 +127,9 @@ EventDeliveryManager::initialize( const bool adjust_number_of_threads_or_rng_onl
 void
 EventDeliveryManager::finalize( const bool )
 {
+  // MPI may still write to the spike data buffers if an exception ended the last run
+  discard_gather_spike_data();
+
   // clear the spike buffers
   for ( auto& vec_spikedata_ptr : emitted_spikes_register_ )
   {
@@ -132,10 +145,12 @@ EventDeliveryManager::finalize( const bool )
 
   send_buffer_secondary_events_.clear();
   recv_buffer_secondary_events_.clear();
+  sent_buffer_secondary_events_.clear();
   send_buffer_spike_data_.clear();
   recv_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
   recv_buffer_off_grid_spike_data_.clear();
+  num_spikes_received_per_rank_.clear();
 }
 
 
@@ -143,6 +158,7 @@ void
 EventDeliveryManager::set_status( const Dictionary& dict )
 {
   dict.update_value( names::off_grid_spiking, off_grid_spiking_ );
+  dict.update_value( names::overlap_spike_communication, overlap_spike_communication_ );
 
   double bsl = send_recv_buffer_shrink_limit_;
   if ( dict.update_value( names::spike_buffer_shrink_limit, bsl ) )
@@ -179,6 +195,7 @@ void
 EventDeliveryManager::get_status( Dictionary& dict )
 {
   dict[ names::off_grid_spiking ] = off_grid_spiking_;
+  dict[ names::overlap_spike_communication ] = overlap_spike_communication_;
   dict[ names::local_spike_counter ] = std::accumulate( local_spike_counter_.begin(), local_spike_counter_.end(), 0 );
   dict[ names::spike_buffer_shrink_limit ] = send_recv_buffer_shrink_limit_;
   dict[ names::spike_buffer_shrink_spare ] = send_recv_buffer_shrink_spare_;
@@ -195,6 +212,35 @@ EventDeliveryManager::get_status( Dictionary& dict )
     dict, names::time_communicate_target_data, names::time_communicate_target_data_cpu );
 }
 
+void
+EventDeliveryManager::get_memory_report( Dictionary& dict ) const
+{
+  size_t spike_data_bytes =
+    vector_util::memory_size( send_buffer_spike_data_ ) + vector_util::memory_size( recv_buffer_spike_data_ );
+  for ( const auto* spikes : emitted_spikes_register_ )
+  {
+    spike_data_bytes += vector_util::memory_size( *spikes );
+  }
+
+  size_t off_grid_spike_data_bytes = vector_util::memory_size( send_buffer_off_grid_spike_data_ )
+    + vector_util::memory_size( recv_buffer_off_grid_spike_data_ );
+  for ( const auto* spikes : off_grid_emitted_spikes_register_ )
+  {
+    off_grid_spike_data_bytes += vector_util::memory_size( *spikes );
+  }
+
+  Dictionary mpi_buffers;
+  mpi_buffers[ names::spike_data ] = static_cast< long >( spike_data_bytes );
+  mpi_buffers[ names::off_grid_spike_data ] = static_cast< long >( off_grid_spike_data_bytes );
+  mpi_buffers[ names::target_data ] = static_cast< long >(
+    vector_util::memory_size( send_buffer_target_data_ ) + vector_util::memory_size( recv_buffer_target_data_ ) );
+  mpi_buffers[ names::secondary_events ] =
+    static_cast< long >( vector_util::memory_size( send_buffer_secondary_events_ )
+      + vector_util::memory_size( recv_buffer_secondary_events_ )
+      + vector_util::memory_size( sent_buffer_secondary_events_ ) );
+  dict[ names::mpi_buffers ] = mpi_buffers;
+}
+
 void
 EventDeliveryManager::resize_send_recv_buffers_target_data()
 {
@@ -206,6 +252,8 @@ EventDeliveryManager::resize_send_recv_buffers_target_data()
 void
 EventDeliveryManager::resize_send_recv_buffers_spike_data_()
 {
+  num_spikes_received_per_rank_.resize( kernel().mpi_manager.get_num_processes(), 0 );
+
   if ( kernel().mpi_manager.get_buffer_size_spike_data() > send_buffer_spike_data_.size() )
   {
     send_buffer_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
@@ -245,6 +293,7 @@ EventDeliveryManager::configure_secondary_buffers()
   send_buffer_secondary_events_.resize( kernel().mpi_manager.get_send_buffer_size_secondary_events_in_int() );
   recv_buffer_secondary_events_.clear();
   recv_buffer_secondary_events_.resize( kernel().mpi_manager.get_recv_buffer_size_secondary_events_in_int() );
+  sent_buffer_secondary_events_.clear();
 }
 
 void
@@ -343,6 +392,96 @@ EventDeliveryManager::gather_secondary_events( const bool done )
     send_buffer_secondary_events_, recv_buffer_secondary_events_ );
 }
 
+void
+EventDeliveryManager::gather_changed_secondary_events( const bool done, const bool full )
+{
+  if ( full )
+  {
+    // the non-MPI exchange swaps buffers, so remember values before exchanging
+    sent_buffer_secondary_events_ = send_buffer_secondary_events_;
+    gather_secondary_events( done );
+    return;
+  }
+
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  const size_t uints_per_value = number_of_uints_covered< double >();
+
+  // Collect values that changed since last sent. Messages consist of the number of changed values
+  // followed by offset in chunk and value of each change. Every rank we exchange secondary events
+  // with receives a message, even if empty, so that receivers know what to expect.
+  std::vector< std::vector< unsigned int > > send_messages( num_processes );
+  std::vector< size_t > max_recv_sizes( num_processes, 0 );
+
+  // the last position of every chunk holds the done marker
+  auto num_values = [ uints_per_value ]( const size_t count_in_int )
+  { return count_in_int > 1 ? ( count_in_int - 1 ) / uints_per_value : 0; };
+
+  for ( size_t rank = 0; rank < num_processes; ++rank )
+  {
+    const size_t num_send_values = num_values( kernel().mpi_manager.get_send_count_secondary_events_in_int( rank ) );
+    const size_t num_recv_values = num_values( kernel().mpi_manager.get_recv_count_secondary_events_in_int( rank ) );
+
+    if ( num_recv_values > 0 )
+    {
+      max_recv_sizes[ rank ] = 1 + num_recv_values * ( 1 + uints_per_value );
+    }
+
+    if ( num_send_values == 0 )
+    {
+      continue;
+    }
+
+    const size_t displacement = kernel().mpi_manager.get_send_displacement_secondary_events_in_int( rank );
+    std::vector< unsigned int >& message = send_messages[ rank ];
+    message.push_back( 0 );
+    for ( size_t offset = 0; offset < num_send_values * uints_per_value; offset += uints_per_value )
+    {
+      auto new_pos = send_buffer_secondary_events_.begin() + displacement + offset;
+      auto sent_pos = sent_buffer_secondary_events_.begin() + displacement + offset;
+
+      // compare bit patterns, so that receivers see exactly the values of the full exchange
+      if ( not std::equal( new_pos, new_pos + uints_per_value, sent_pos ) )
+      {
+        ++message[ 0 ];
+        message.push_back( offset );
+        message.insert( message.end(), new_pos, new_pos + uints_per_value );
+        std::copy( new_pos, new_pos + uints_per_value, sent_pos );
+      }
+    }
+  }
+
+  std::vector< std::vector< unsigned int > > recv_messages( num_processes );
+  kernel().mpi_manager.communicate_secondary_events_sparse( send_messages, recv_messages, max_recv_sizes );
+
+  // Apply changes to values kept from earlier exchanges
+  for ( size_t rank = 0; rank < num_processes; ++rank )
+  {
+    const std::vector< unsigned int >& message = recv_messages[ rank ];
+    if ( message.empty() )
+    {
+      continue;
+    }
+
+    const size_t displacement = kernel().mpi_manager.get_recv_displacement_secondary_events_in_int( rank );
+    const size_t num_changes = message[ 0 ];
+    assert( message.size() == 1 + num_changes * ( 1 + uints_per_value ) );
+    for ( size_t k = 0; k < num_changes; ++k )
+    {
+      const size_t entry = 1 + k * ( 1 + uints_per_value );
+      std::copy( message.begin() + entry + 1,
+        message.begin() + entry + 1 + uints_per_value,
+        recv_buffer_secondary_events_.begin() + displacement + message[ entry ] );
+    }
+  }
+
+  const bool done_all = not kernel().mpi_manager.any_true( not done );
+  for ( size_t rank = 0; rank < num_processes; ++rank )
+  {
+    recv_buffer_secondary_events_[ kernel().mpi_manager.get_done_marker_position_in_secondary_events_recv_buffer(
+      rank ) ] = done_all;
+  }
+}
+
 bool
 EventDeliveryManager::deliver_secondary_events( const size_t tid, const bool called_from_wfr_update )
 {
@@ -355,22 +494,62 @@ EventDeliveryManager::gather_spike_data()
 {
   if ( off_grid_spiking_ )
   {
-    gather_spike_data_( send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    if ( overlap_spike_communication_ )
+    {
+      start_gather_spike_data_( send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    }
+    else
+    {
+      gather_spike_data_( send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    }
   }
   else
   {
-    gather_spike_data_( send_buffer_spike_data_, recv_buffer_spike_data_ );
+    if ( overlap_spike_communication_ )
+    {
+      start_gather_spike_data_( send_buffer_spike_data_, recv_buffer_spike_data_ );
+    }
+    else
+    {
+      gather_spike_data_( send_buffer_spike_data_, recv_buffer_spike_data_ );
+    }
   }
 }
 
-template < typename SpikeDataT >
 void
-EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer,
-  std::vector< SpikeDataT >& recv_buffer )
+EventDeliveryManager::complete_gather_spike_data()
 {
-  // NOTE: For meaning and logic of SpikeData flags for detecting complete transmission
-  //       and information for shrink/grow, see comment in spike_data.h.
+  if ( not spike_data_exchange_pending_ )
+  {
+    return;
+  }
+
+  if ( off_grid_spiking_ )
+  {
+    complete_gather_spike_data_( send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+  }
+  else
+  {
+    complete_gather_spike_data_( send_buffer_spike_data_, recv_buffer_spike_data_ );
+  }
+}
+
+void
+EventDeliveryManager::discard_gather_spike_data()
+{
+  if ( not spike_data_exchange_pending_ )
+  {
+    return;
+  }
+
+  // The send and receive buffers belong to MPI until the exchange has completed
+  kernel().mpi_manager.wait_for_Ialltoall();
+  spike_data_exchange_pending_ = false;
+}
 
+void
+EventDeliveryManager::shrink_send_recv_buffers_spike_data_()
+{
   const size_t old_buff_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
 
   if ( global_max_spikes_per_rank_ < send_recv_buffer_shrink_limit_ * old_buff_size_per_rank )
@@ -382,7 +561,33 @@ EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer
     resize_send_recv_buffers_spike_data_();
     send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
   }
+}
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  // NOTE: For meaning and logic of SpikeData flags for detecting complete transmission
+  //       and information for shrink/grow, see comment in spike_data.h.
+
+  shrink_send_recv_buffers_spike_data_();
+  transmit_spike_data_( send_buffer, recv_buffer );
+
+  // We cannot shrink buffers here, because they first need to be read out by
+  // deliver events. Shrinking will happen at beginning of next gather.
+
+  /* emitted_spike_register is cleared by deliver_events in a thread-parallel context.
+     We could in principle clear it here, but since it can conveniently be done thread-parallel,
+     it is best to postpone.
+   */
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::transmit_spike_data_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
   /* The following do-while loop is executed
    * - once if all spikes fit into current send buffers on all ranks
    * - twice if send buffer size needs to be increased to fit in all spikes
@@ -393,29 +598,8 @@ EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer
     // Need to get new positions in case buffer size has changed
     SendBufferPosition send_buffer_position;
 
-    sw_collocate_spike_data_.start();
+    collocate_spike_data_( send_buffer_position, send_buffer );
 
-    // Set marker at end of each chunk to DEFAULT
-    reset_complete_marker_spike_data_( send_buffer_position, send_buffer );
-    std::vector< size_t > num_spikes_per_rank( kernel().mpi_manager.get_num_processes(), 0 );
-
-    // Collocate spikes to send buffer
-    collocate_spike_data_buffers_( send_buffer_position, emitted_spikes_register_, send_buffer, num_spikes_per_rank );
-
-    if ( off_grid_spiking_ )
-    {
-      collocate_spike_data_buffers_(
-        send_buffer_position, off_grid_emitted_spikes_register_, send_buffer, num_spikes_per_rank );
-    }
-
-    // Largest number of spikes sent from this rank to any other rank.
-    const auto local_max_spikes_per_rank = *std::max_element( num_spikes_per_rank.begin(), num_spikes_per_rank.end() );
-
-    // At this point, all send_buffer entries with spikes to be transmitted, as well
-    // as all chunk-end entries, have marker DEFAULT.
-    set_end_marker_( send_buffer_position, send_buffer, local_max_spikes_per_rank );
-
-    sw_collocate_spike_data_.stop();
     sw_communicate_spike_data_.start();
 #ifdef MPI_SYNC_TIMER
     // We introduce an explicit barrier at this point to measure how long each process idles until all other processes
@@ -438,31 +622,117 @@ EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer
 
     sw_communicate_spike_data_.stop();
 
-    global_max_spikes_per_rank_ = get_global_max_spikes_per_rank_( send_buffer_position, recv_buffer );
+    all_spikes_transmitted = check_spike_data_transmitted_( send_buffer_position, recv_buffer );
 
-    all_spikes_transmitted =
-      global_max_spikes_per_rank_ <= kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  } while ( not all_spikes_transmitted );
+}
 
-    if ( not all_spikes_transmitted )
-    {
-      const size_t new_buff_size_per_rank =
-        static_cast< size_t >( ( 1 + send_recv_buffer_grow_extra_ ) * global_max_spikes_per_rank_ );
+template < typename SpikeDataT >
+void
+EventDeliveryManager::start_gather_spike_data_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  assert( not spike_data_exchange_pending_ );
 
-      kernel().mpi_manager.set_buffer_size_spike_data(
-        kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
-      resize_send_recv_buffers_spike_data_();
-      send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
-    }
+  shrink_send_recv_buffers_spike_data_();
 
-  } while ( not all_spikes_transmitted );
+  SendBufferPosition send_buffer_position;
+  collocate_spike_data_( send_buffer_position, send_buffer );
 
-  // We cannot shrink buffers here, because they first need to be read out by
-  // deliver events. Shrinking will happen at beginning of next gather.
+  sw_communicate_spike_data_.start();
+  if ( off_grid_spiking_ )
+  {
+    kernel().mpi_manager.communicate_off_grid_spike_data_Ialltoall( send_buffer, recv_buffer );
+  }
+  else
+  {
+    kernel().mpi_manager.communicate_spike_data_Ialltoall( send_buffer, recv_buffer );
+  }
+  sw_communicate_spike_data_.stop();
 
-  /* emitted_spike_register is cleared by deliver_events in a thread-parallel context.
-     We could in principle clear it here, but since it can conveniently be done thread-parallel,
-     it is best to postpone.
-   */
+  spike_data_exchange_pending_ = true;
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::complete_gather_spike_data_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  sw_communicate_spike_data_.start();
+  kernel().mpi_manager.wait_for_Ialltoall();
+  sw_communicate_spike_data_.stop();
+
+  spike_data_exchange_pending_ = false;
+
+  // Buffer sizes cannot have changed since the exchange was started, so positions are still valid.
+  const SendBufferPosition send_buffer_position;
+  if ( not check_spike_data_transmitted_( send_buffer_position, recv_buffer ) )
+  {
+    // Buffers have been grown, repeat exchange in blocking mode. The spike registers are
+    // still intact, since they are only cleared in deliver_events().
+    transmit_spike_data_( send_buffer, recv_buffer );
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::collocate_spike_data_( SendBufferPosition& send_buffer_position,
+  std::vector< SpikeDataT >& send_buffer )
+{
+  sw_collocate_spike_data_.start();
+
+  // Set marker at end of each chunk to DEFAULT
+  reset_complete_marker_spike_data_( send_buffer_position, send_buffer );
+  std::vector< size_t > num_spikes_per_rank( kernel().mpi_manager.get_num_processes(), 0 );
+
+  // Collocate spikes to send buffer
+  collocate_spike_data_buffers_( send_buffer_position, emitted_spikes_register_, send_buffer, num_spikes_per_rank );
+
+  if ( off_grid_spiking_ )
+  {
+    collocate_spike_data_buffers_(
+      send_buffer_position, off_grid_emitted_spikes_register_, send_buffer, num_spikes_per_rank );
+  }
+
+  // Without compression, every spike targets a single thread on the receiving rank. Grouping
+  // spikes by that thread lets each receiving thread read only its own entries.
+  if ( not kernel().connection_manager.use_compressed_spikes() and kernel().vp_manager.get_num_threads() > 1 )
+  {
+    sort_spike_data_by_thread_( send_buffer_position, send_buffer );
+  }
+
+  // Largest number of spikes sent from this rank to any other rank.
+  const auto local_max_spikes_per_rank = *std::max_element( num_spikes_per_rank.begin(), num_spikes_per_rank.end() );
+
+  // At this point, all send_buffer entries with spikes to be transmitted, as well
+  // as all chunk-end entries, have marker DEFAULT.
+  set_end_marker_( send_buffer_position, send_buffer, local_max_spikes_per_rank );
+
+  sw_collocate_spike_data_.stop();
+}
+
+template < typename SpikeDataT >
+bool
+EventDeliveryManager::check_spike_data_transmitted_( const SendBufferPosition& send_buffer_position,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  global_max_spikes_per_rank_ = get_global_max_spikes_per_rank_( send_buffer_position, recv_buffer );
+
+  const bool all_spikes_transmitted =
+    global_max_spikes_per_rank_ <= kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+
+  if ( not all_spikes_transmitted )
+  {
+    const size_t new_buff_size_per_rank =
+      static_cast< size_t >( ( 1 + send_recv_buffer_grow_extra_ ) * global_max_spikes_per_rank_ );
+
+    kernel().mpi_manager.set_buffer_size_spike_data(
+      kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
+    resize_send_recv_buffers_spike_data_();
+    send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
+  }
+
+  return all_spikes_transmitted;
 }
 
 template < typename SpikeDataWithRankT, typename SpikeDataT >
@@ -496,6 +766,41 @@ EventDeliveryManager::collocate_spike_data_buffers_( SendBufferPosition& send_bu
   }
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::sort_spike_data_by_thread_( const SendBufferPosition& send_buffer_position,
+  std::vector< SpikeDataT >& send_buffer ) const
+{
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< size_t > thread_offsets( num_threads + 1 );
+  std::vector< SpikeDataT > sorted_chunk;
+
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    const size_t begin = send_buffer_position.begin( rank );
+    const size_t end = send_buffer_position.idx( rank );
+    if ( end - begin < 2 )
+    {
+      continue;
+    }
+
+    // Stable counting sort, so that each thread still delivers its spikes in the order they were emitted
+    std::fill( thread_offsets.begin(), thread_offsets.end(), 0 );
+    for ( size_t i = begin; i < end; ++i )
+    {
+      ++thread_offsets[ send_buffer[ i ].get_tid() + 1 ];
+    }
+    std::partial_sum( thread_offsets.begin(), thread_offsets.end(), thread_offsets.begin() );
+
+    sorted_chunk.resize( end - begin );
+    for ( size_t i = begin; i < end; ++i )
+    {
+      sorted_chunk[ thread_offsets[ send_buffer[ i ].get_tid() ]++ ] = send_buffer[ i ];
+    }
+    std::copy( sorted_chunk.begin(), sorted_chunk.end(), send_buffer.begin() + begin );
+  }
+}
+
 template < typename SpikeDataT >
 void
 EventDeliveryManager::set_end_marker_( const SendBufferPosition& send_buffer_position,
@@ -616,17 +921,19 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
       kernel().simulation_manager.get_clock() + Time::step( lag + 1 - kernel().connection_manager.get_min_delay() );
   }
 
-  // Deliver spikes sent by each rank in order
+  // Find number of spikes received from each rank. Each rank is scanned by one thread only, the implicit
+  // barrier at the end of the loop makes the results available to all threads.
+#pragma omp for
   for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
   {
-    // Continue with next rank if no spikes were sent by current rank
+    num_spikes_received_per_rank_[ rank ] = 0;
+
+    // No spikes were sent by current rank
     if ( recv_buffer[ rank * spike_buffer_size_per_rank ].is_invalid_marker() )
     {
       continue;
     }
 
-    // Find number of spikes received from current rank
-    size_t num_spikes_received = 0;
     for ( size_t i = 0; i < spike_buffer_size_per_rank; ++i )
     {
       const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i ];
@@ -634,90 +941,108 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
       // break if this was the last valid entry from this rank
       if ( spike_data.is_end_marker() )
       {
-        num_spikes_received = i + 1;
+        num_spikes_received_per_rank_[ rank ] = i + 1;
         break;
       }
     }
+  }
 
-    // For each batch, extract data first from receive buffer into value-specific arrays, then deliver from these arrays
-    constexpr size_t SPIKES_PER_BATCH = 8;
-    const size_t num_batches = num_spikes_received / SPIKES_PER_BATCH;
-    const size_t num_remaining_entries = num_spikes_received - num_batches * SPIKES_PER_BATCH;
+  // For each batch, extract data first from receive buffer into value-specific arrays, then deliver from these arrays
+  SpikeEvent se_batch[ MAX_SPIKES_PER_BATCH ];
+  size_t syn_id_batch[ MAX_SPIKES_PER_BATCH ];
+  size_t lcid_batch[ MAX_SPIKES_PER_BATCH ];
+  size_t spikes_per_batch = spikes_per_batch_[ tid ];
 
-    SpikeEvent se_batch[ SPIKES_PER_BATCH ];
-    size_t tid_batch[ SPIKES_PER_BATCH ];
-    size_t syn_id_batch[ SPIKES_PER_BATCH ];
-    size_t lcid_batch[ SPIKES_PER_BATCH ];
+  // Deliver spikes sent by each rank in order
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    const size_t num_spikes_received = num_spikes_received_per_rank_[ rank ];
+
+    // Continue with next rank if no spikes were sent by current rank
+    if ( num_spikes_received == 0 )
+    {
+      continue;
+    }
 
     if ( not kernel().connection_manager.use_compressed_spikes() )
     {
-      for ( size_t i = 0; i < num_batches; ++i )
+      // The sending rank has sorted its spikes by target thread, see sort_spike_data_by_thread_(),
+      // so we only need to visit the contiguous section of entries for this thread.
+      const auto chunk_begin = recv_buffer.begin() + rank * spike_buffer_size_per_rank;
+      const auto chunk_end = chunk_begin + num_spikes_received;
+      const auto thread_begin = std::lower_bound( chunk_begin,
+        chunk_end,
+        tid,
+        []( const SpikeDataT& spike_data, const size_t t ) { return spike_data.get_tid() < t; } );
+      const auto thread_end = std::upper_bound( thread_begin,
+        chunk_end,
+        tid,
+        []( const size_t t, const SpikeDataT& spike_data ) { return t < spike_data.get_tid(); } );
+
+      const size_t first_entry = thread_begin - recv_buffer.begin();
+      const size_t num_thread_spikes = thread_end - thread_begin;
+
+      size_t num_done = 0;
+      while ( num_done < num_thread_spikes )
       {
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        const size_t batch_size = std::min( spikes_per_batch, num_thread_spikes - num_done );
+        for ( size_t j = 0; j < batch_size; ++j )
         {
-          const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i * SPIKES_PER_BATCH + j ];
+          const SpikeDataT& spike_data = recv_buffer[ first_entry + num_done + j ];
           se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
           se_batch[ j ].set_offset( spike_data.get_offset() );
           se_batch[ j ].set_flush_event_flag( spike_data.is_flush_event() );
-          tid_batch[ j ] = spike_data.get_tid();
+          se_batch[ j ].set_multiplicity( spike_data.get_multiplicity() );
           syn_id_batch[ j ] = spike_data.get_syn_id();
           lcid_batch[ j ] = spike_data.get_lcid();
-          se_batch[ j ].set_sender_node_id_info( tid_batch[ j ], syn_id_batch[ j ], lcid_batch[ j ] );
-        }
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
-        {
-          if ( tid_batch[ j ] == tid )
-          {
-            kernel().connection_manager.send( tid_batch[ j ], syn_id_batch[ j ], lcid_batch[ j ], cm, se_batch[ j ] );
-          }
+          kernel().connection_manager.prefetch_connection( tid, syn_id_batch[ j ], lcid_batch[ j ] );
+          se_batch[ j ].set_sender_node_id_info( tid, syn_id_batch[ j ], lcid_batch[ j ] );
         }
-      }
 
-      // Processed all regular-sized batches, now do remainder
-      for ( size_t j = 0; j < num_remaining_entries; ++j )
-      {
-        const SpikeDataT& spike_data =
-          recv_buffer[ rank * spike_buffer_size_per_rank + num_batches * SPIKES_PER_BATCH + j ];
-        se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
-        se_batch[ j ].set_offset( spike_data.get_offset() );
-        se_batch[ j ].set_flush_event_flag( spike_data.is_flush_event() );
-        tid_batch[ j ] = spike_data.get_tid();
-        syn_id_batch[ j ] = spike_data.get_syn_id();
-        lcid_batch[ j ] = spike_data.get_lcid();
-        se_batch[ j ].set_sender_node_id_info( tid_batch[ j ], syn_id_batch[ j ], lcid_batch[ j ] );
-      }
-      for ( size_t j = 0; j < num_remaining_entries; ++j )
-      {
-        if ( tid_batch[ j ] == tid )
+        size_t num_connections = 0;
+        for ( size_t j = 0; j < batch_size; ++j )
         {
-          kernel().connection_manager.send( tid_batch[ j ], syn_id_batch[ j ], lcid_batch[ j ], cm, se_batch[ j ] );
+          num_connections +=
+            kernel().connection_manager.send( tid, syn_id_batch[ j ], lcid_batch[ j ], cm, se_batch[ j ] );
         }
+
+        num_done += batch_size;
+        spikes_per_batch = adapt_spikes_per_batch_( batch_size, num_connections );
       }
     }
     else  // compressed spikes
     {
-      for ( size_t i = 0; i < num_batches; ++i )
+      const size_t first_entry = rank * spike_buffer_size_per_rank;
+
+      size_t num_done = 0;
+      while ( num_done < num_spikes_received )
       {
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        const size_t batch_size = std::min( spikes_per_batch, num_spikes_received - num_done );
+        for ( size_t j = 0; j < batch_size; ++j )
         {
-          const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i * SPIKES_PER_BATCH + j ];
+          const SpikeDataT& spike_data = recv_buffer[ first_entry + num_done + j ];
 
           se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
           se_batch[ j ].set_offset( spike_data.get_offset() );
           se_batch[ j ].set_flush_event_flag( spike_data.is_flush_event() );
+          se_batch[ j ].set_multiplicity( spike_data.get_multiplicity() );
           syn_id_batch[ j ] = spike_data.get_syn_id();
           // for compressed spikes lcid holds the index in the
           // compressed_spike_data structure
           lcid_batch[ j ] = spike_data.get_lcid();
         }
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        for ( size_t j = 0; j < batch_size; ++j )
         {
           // find the spike-data entry for this thread
           const std::vector< SpikeData >& compressed_spike_data =
             kernel().connection_manager.get_compressed_spike_data( syn_id_batch[ j ], lcid_batch[ j ] );
           lcid_batch[ j ] = compressed_spike_data[ tid ].get_lcid();
+          if ( lcid_batch[ j ] != invalid_lcid )
+          {
+            kernel().connection_manager.prefetch_connection( tid, syn_id_batch[ j ], lcid_batch[ j ] );
+          }
         }
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        for ( size_t j = 0; j < batch_size; ++j )
         {
           if ( lcid_batch[ j ] != invalid_lcid )
           {
@@ -726,53 +1051,34 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
             se_batch[ j ].set_sender_node_id_info( tid, syn_id_batch[ j ], lcid_batch[ j ] );
           }
         }
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+
+        size_t num_connections = 0;
+        for ( size_t j = 0; j < batch_size; ++j )
         {
           if ( lcid_batch[ j ] != invalid_lcid )
           {
-            kernel().connection_manager.send( tid, syn_id_batch[ j ], lcid_batch[ j ], cm, se_batch[ j ] );
+            num_connections +=
+              kernel().connection_manager.send( tid, syn_id_batch[ j ], lcid_batch[ j ], cm, se_batch[ j ] );
           }
         }
-      }
 
-      // Processed all regular-sized batches, now do remainder
-      for ( size_t j = 0; j < num_remaining_entries; ++j )
-      {
-        const SpikeDataT& spike_data =
-          recv_buffer[ rank * spike_buffer_size_per_rank + num_batches * SPIKES_PER_BATCH + j ];
-        se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
-        se_batch[ j ].set_offset( spike_data.get_offset() );
-        se_batch[ j ].set_flush_event_flag( spike_data.is_flush_event() );
-        syn_id_batch[ j ] = spike_data.get_syn_id();
-        // for compressed spikes lcid holds the index in the
-        // compressed_spike_data structure
-        lcid_batch[ j ] = spike_data.get_lcid();
-      }
-      for ( size_t j = 0; j < num_remaining_entries; ++j )
-      {
-        // find the spike-data entry for this thread
-        const std::vector< SpikeData >& compressed_spike_data =
-          kernel().connection_manager.get_compressed_spike_data( syn_id_batch[ j ], lcid_batch[ j ] );
-        lcid_batch[ j ] = compressed_spike_data[ tid ].get_lcid();
-      }
-      for ( size_t j = 0; j < num_remaining_entries; ++j )
-      {
-        if ( lcid_batch[ j ] != invalid_lcid )
-        {
-          // non-local sender -> receiver retrieves ID of sender Node from SourceTable based on tid, syn_id, lcid
-          // only if needed, as this is computationally costly
-          se_batch[ j ].set_sender_node_id_info( tid, syn_id_batch[ j ], lcid_batch[ j ] );
-        }
-      }
-      for ( size_t j = 0; j < num_remaining_entries; ++j )
-      {
-        if ( lcid_batch[ j ] != invalid_lcid )
-        {
-          kernel().connection_manager.send( tid, syn_id_batch[ j ], lcid_batch[ j ], cm, se_batch[ j ] );
-        }
+        num_done += batch_size;
+        spikes_per_batch = adapt_spikes_per_batch_( batch_size, num_connections );
       }
     }  // if-else not compressed
   }  // for rank
+
+  spikes_per_batch_[ tid ] = spikes_per_batch;
+}
+
+size_t
+EventDeliveryManager::adapt_spikes_per_batch_( const size_t batch_size, const size_t num_connections )
+{
+  // Sources with few local connections each are delivered in large batches, so that the connections of many spikes
+  // are prefetched at once. Sources with many connections are delivered in small batches, because Connector::send()
+  // prefetches targets while it delivers the spike.
+  const size_t spikes_per_batch = batch_size * CONNECTIONS_PER_BATCH / std::max( num_connections, size_t( 1 ) );
+  return std::clamp( spikes_per_batch, size_t( 1 ), MAX_SPIKES_PER_BATCH );
 }
 
 
@@ -66,6 +66,12 @@ public:
   void set_status( const Dictionary& ) override;
   void get_status( Dictionary& ) override;
 
+  /**
+   * Add estimates of the memory held by MPI communication buffers and spike
+   * registers to the given dictionary, in bytes.
+   */
+  void get_memory_report( Dictionary& ) const;
+
   /**
    * Standard routine for sending events.
    *
@@ -200,9 +206,34 @@ public:
   /**
    * Collocates spikes from register to MPI buffers, communicates via
    * MPI and delivers events to targets.
+   *
+   * If overlap_spike_communication is set, this only starts a non-blocking
+   * exchange, which must be finished by complete_gather_spike_data() before
+   * events are delivered.
    */
   void gather_spike_data();
 
+  /**
+   * Wait for a spike exchange started by gather_spike_data() to finish.
+   *
+   * Repeats the exchange in blocking mode if the send buffers turned out to be
+   * too small. Does nothing if no exchange is pending.
+   */
+  void complete_gather_spike_data();
+
+  /**
+   * Wait for a spike exchange started by gather_spike_data() to finish and drop the received spikes.
+   *
+   * Used when a run ends with an exception, so that no exchange stays pending while
+   * the buffers are resized or freed. Does nothing if no exchange is pending.
+   */
+  void discard_gather_spike_data();
+
+  /**
+   * Return whether the spike exchange is overlapped with other work.
+   */
+  bool get_overlap_spike_communication() const;
+
   /**
    * Collocates presynaptic connection information, communicates via
    * MPI and creates presynaptic connection infrastructure.
@@ -228,6 +259,20 @@ public:
 
   void gather_secondary_events( const bool done );
 
+  /**
+   * Exchange secondary events during waveform relaxation, sending only changed values.
+   *
+   * If full is true, all values are exchanged as by gather_secondary_events()
+   * and remembered as sent. Otherwise, only values whose bit pattern differs
+   * from the value last sent are transmitted, in messages to the ranks with
+   * which secondary connections exist. Receivers keep all other values from
+   * earlier exchanges, so they see the same values as with a full exchange.
+   * Done markers are combined by a reduction.
+   *
+   * @note All secondary events carry double coefficients, which this method relies on.
+   */
+  void gather_changed_secondary_events( const bool done, const bool full );
+
   bool deliver_secondary_events( const size_t tid, const bool called_from_wfr_update );
 
   /**
@@ -284,6 +329,41 @@ private:
   template < typename SpikeDataT >
   void gather_spike_data_( std::vector< SpikeDataT >& send_buffer, std::vector< SpikeDataT >& recv_buffer );
 
+  /**
+   * Collocate and exchange spikes in blocking mode, growing buffers until all spikes have been transmitted.
+   */
+  template < typename SpikeDataT >
+  void transmit_spike_data_( std::vector< SpikeDataT >& send_buffer, std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Collocate spikes and start a non-blocking exchange.
+   */
+  template < typename SpikeDataT >
+  void start_gather_spike_data_( std::vector< SpikeDataT >& send_buffer, std::vector< SpikeDataT >& recv_buffer );
+
+  template < typename SpikeDataT >
+  void complete_gather_spike_data_( std::vector< SpikeDataT >& send_buffer, std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Collocate spikes from the spike registers into the send buffer and set all markers.
+   */
+  template < typename SpikeDataT >
+  void collocate_spike_data_( SendBufferPosition& send_buffer_position, std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Check whether all spikes fit into the buffers in the last exchange and grow the buffers if they did not.
+   *
+   * @returns true if all spikes were transmitted
+   */
+  template < typename SpikeDataT >
+  bool check_spike_data_transmitted_( const SendBufferPosition& send_buffer_position,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Shrink spike buffers if the last exchange used only a small fraction of them.
+   */
+  void shrink_send_recv_buffers_spike_data_();
+
   void resize_send_recv_buffers_spike_data_();
 
   /**
@@ -299,6 +379,15 @@ private:
     std::vector< SpikeDataT >& send_buffer,
     std::vector< size_t >& num_spikes_per_rank );
 
+  /**
+   * Sort the spikes in each per-rank chunk of the send buffer by target thread.
+   *
+   * The sort is stable. It is only needed without spike compression, where each spike carries its target thread.
+   */
+  template < typename SpikeDataT >
+  void sort_spike_data_by_thread_( const SendBufferPosition& send_buffer_position,
+    std::vector< SpikeDataT >& send_buffer ) const;
+
   /**
    * Set end marker for per-rank-chunks signalling completion and providing shrink/grow information.
    */
@@ -332,6 +421,13 @@ private:
   template < typename SpikeDataT >
   void deliver_events_( const size_t tid, const std::vector< SpikeDataT >& recv_buffer );
 
+  /**
+   * Return the number of spikes to deliver in the next batch, given the
+   * number of connections to which the spikes of the last batch were
+   * delivered.
+   */
+  static size_t adapt_spikes_per_batch_( const size_t batch_size, const size_t num_connections );
+
   /**
    * Deletes all spikes from spike registers and resets spike
    * counters.
@@ -441,6 +537,9 @@ private:
   std::vector< unsigned int > send_buffer_secondary_events_;
   std::vector< unsigned int > recv_buffer_secondary_events_;
 
+  //! Values of secondary events last sent by gather_changed_secondary_events()
+  std::vector< unsigned int > sent_buffer_secondary_events_;
+
   /**
    * Number of generated spike events (both off- and on-grid) during the last call to simulate.
    */
@@ -451,6 +550,21 @@ private:
   std::vector< OffGridSpikeData > send_buffer_off_grid_spike_data_;
   std::vector< OffGridSpikeData > recv_buffer_off_grid_spike_data_;
 
+  //! Number of valid entries received from each rank in the last spike exchange, found once per slice by all threads
+  std::vector< size_t > num_spikes_received_per_rank_;
+
+  //! Number of spikes delivered together in deliver_events_() on each thread, see adapt_spikes_per_batch_()
+  std::vector< size_t > spikes_per_batch_;
+
+  //! Largest number of spikes delivered together in deliver_events_()
+  static constexpr size_t MAX_SPIKES_PER_BATCH = 32;
+
+  //! Number of spikes delivered together before the number of connections per spike is known
+  static constexpr size_t INITIAL_SPIKES_PER_BATCH = 8;
+
+  //! Number of connections for which deliver_events_() aims to prefetch data at once
+  static constexpr size_t CONNECTIONS_PER_BATCH = 64;
+
   std::vector< TargetData > send_buffer_target_data_;
   std::vector< TargetData > recv_buffer_target_data_;
 
@@ -478,6 +592,12 @@ private:
 
   PerThreadBoolIndicator gather_completed_checker_;
 
+  //! whether spikes are exchanged with non-blocking MPI while other work proceeds
+  bool overlap_spike_communication_;
+
+  //! whether a non-blocking spike exchange has been started but not yet completed
+  bool spike_data_exchange_pending_;
+
   // private stop watches for benchmarking purposes
   // (intended for internal core developers, not for use in the public API)
   Stopwatch< StopwatchGranularity::Detailed, StopwatchParallelism::MasterOnly > sw_collocate_spike_data_;
@@ -516,6 +636,12 @@ EventDeliveryManager::set_off_grid_communication( bool off_grid_spiking )
   off_grid_spiking_ = off_grid_spiking;
 }
 
+inline bool
+EventDeliveryManager::get_overlap_spike_communication() const
+{
+  return overlap_spike_communication_;
+}
+
 inline size_t
 EventDeliveryManager::read_toggle() const
 {
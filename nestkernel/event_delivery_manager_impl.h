@@ -25,6 +25,9 @@
 
 #include "event_delivery_manager.h"
 
+// C++ includes:
+#include <algorithm>
+
 // Includes from nestkernel:
 #include "connection_manager_impl.h"
 #include "kernel_manager.h"
@@ -109,10 +112,14 @@ EventDeliveryManager::send_remote( size_t tid, SpikeEvent& e, const long lag )
 
   for ( const auto& target : targets )
   {
-    // Unroll spike multiplicity as plastic synapses only handle individual spikes.
-    for ( size_t i = 0; i < e.get_multiplicity(); ++i )
+    // Multiplicity is transmitted with the spike and only unrolled on the receiving side for
+    // synapses that handle individual spikes only, see ConnectionManager::send(). A single
+    // entry holds multiplicities up to SpikeData::MAX_MULTIPLICITY, larger ones are split.
+    for ( size_t remaining = e.get_multiplicity(); remaining > 0; )
     {
-      ( *emitted_spikes_register_[ tid ] ).emplace_back( target, lag, e.is_flush_event() );
+      const size_t multiplicity = std::min( remaining, SpikeData::MAX_MULTIPLICITY );
+      ( *emitted_spikes_register_[ tid ] ).emplace_back( target, lag, e.is_flush_event(), multiplicity );
+      remaining -= multiplicity;
     }
   }
 }
@@ -126,10 +133,12 @@ EventDeliveryManager::send_off_grid_remote( size_t tid, SpikeEvent& e, const lon
 
   for ( const auto& target : targets )
   {
-    // Unroll spike multiplicity as plastic synapses only handle individual spikes.
-    for ( size_t i = 0; i < e.get_multiplicity(); ++i )
+    // See send_remote() for handling of multiplicity.
+    for ( size_t remaining = e.get_multiplicity(); remaining > 0; )
     {
-      ( *off_grid_emitted_spikes_register_[ tid ] ).emplace_back( target, lag, e.get_offset() );
+      const size_t multiplicity = std::min( remaining, SpikeData::MAX_MULTIPLICITY );
+      ( *off_grid_emitted_spikes_register_[ tid ] ).emplace_back( target, lag, e.get_offset(), multiplicity );
+      remaining -= multiplicity;
     }
   }
 }
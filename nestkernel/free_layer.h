@@ -76,6 +76,9 @@ protected:
 
   size_t num_local_nodes_ = 0;
 
+  //! Index of first rank-local node within layer, used to locate positions if nodes are block placed.
+  size_t first_local_lid_ = 0;
+
   /**
    * Class to be used when communicating positions across MPI processes.
    */
@@ -132,6 +135,9 @@ FreeLayer< D >::set_status( const Dictionary& d )
       return node->is_proxy() ? a : a + 1;
     } );
 
+  const auto local_begin = this->node_collection_->rank_local_begin();
+  first_local_lid_ = local_begin < this->node_collection_->end() ? ( *local_begin ).nc_index : 0;
+
   // Read positions from dictionary
   if ( d.known( names::positions ) )
   {
@@ -273,21 +279,12 @@ FreeLayer< D >::get_status( Dictionary& d, NodeCollection const* const nc ) cons
     // - nc has information on which nodes actually belong to it, especially
     //   important for sliced collections with step > 1.
     // - Use the rank-local iterator over the node collection to pick the right
-    //   nodes, then step in lockstep through the positions_ array.
-    auto nc_it = nc->rank_local_begin();
-    const auto nc_end = nc->end();
-    if ( nc_it < nc_end )
+    //   nodes, then look up their positions in the positions_ array.
+    // Node index in node collection is global to NEST, so we need to map it
+    // to the right indices into positions_, which has only rank-local data.
+    for ( auto nc_it = nc->rank_local_begin(); nc_it < nc->end(); ++nc_it )
     {
-      // Node index in node collection is global to NEST, so we need to scale down
-      // to get right indices into positions_, which has only rank-local data.
-      const size_t n_procs = kernel().mpi_manager.get_num_processes();
-      size_t pos_idx = ( *nc_it ).nc_index / n_procs;
-      const size_t step = nc_it.get_step_size() / n_procs;
-
-      for ( ; nc_it < nc->end(); pos_idx += step, ++nc_it )
-      {
-        points.emplace_back( positions_.at( pos_idx ).get_vector() );
-      }
+      points.emplace_back( positions_.at( lid_to_position_id_( ( *nc_it ).nc_index ) ).get_vector() );
     }
   }
 
@@ -397,6 +394,11 @@ FreeLayer< D >::lid_to_position_id_( size_t lid ) const
   {
     return lid;
   }
+  else if ( kernel().vp_manager.is_block_placed( ( *this->node_collection_ )[ 0 ] ) )
+  {
+    // Nodes of a block-placed layer local to this rank are contiguous
+    return lid - first_local_lid_;
+  }
   else
   {
     const auto num_procs = kernel().mpi_manager.get_num_processes();
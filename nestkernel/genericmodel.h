@@ -24,10 +24,13 @@
 #define GENERICMODEL_H
 
 // C++ includes:
+#include <memory>
 #include <new>
+#include <tuple>
 
 // Includes from nestkernel:
 #include "model.h"
+#include "recordables_map.h"
 
 namespace nest
 {
@@ -85,6 +88,15 @@ public:
 
   void sends_secondary_event( SICEvent& sic ) override;
 
+  void
+  update_nodes( Node* const* first, Node* const* last, Time const& origin, const long from, const long to ) override;
+
+  std::unique_ptr< NodeBatchState > create_batch_state( Node* const* first, Node* const* last ) override;
+
+  Node::DoublePropertyReader get_double_property_reader( const std::string& key ) const override;
+
+  size_t get_ring_buffer_memory( const Node& node ) const override;
+
   Node const& get_prototype() const override;
 
   void set_model_id( int ) override;
@@ -99,6 +111,8 @@ private:
 
   size_t get_element_size() const override;
 
+  bool has_cacheable_connection_checks() const override;
+
   /**
    * Call placement new on the supplied memory position.
    */
@@ -154,6 +168,47 @@ GenericModel< ElementT >::create_()
   return n;
 }
 
+template < typename ElementT >
+void
+GenericModel< ElementT >::update_nodes( Node* const* first,
+  Node* const* last,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  for ( ; first != last; ++first )
+  {
+    if ( ( *first )->is_frozen() )
+    {
+      continue;
+    }
+
+    if constexpr ( ElementT::supports_batched_update )
+    {
+      // Qualified call bypasses virtual dispatch and allows the compiler to inline the update.
+      static_cast< ElementT* >( *first )->ElementT::update( origin, from, to );
+    }
+    else
+    {
+      ( *first )->update( origin, from, to );
+    }
+  }
+}
+
+template < typename ElementT >
+std::unique_ptr< NodeBatchState >
+GenericModel< ElementT >::create_batch_state( Node* const* first, Node* const* last )
+{
+  if constexpr ( ElementT::has_batch_state )
+  {
+    if ( ElementT::BatchState::supports( first, last ) )
+    {
+      return std::make_unique< typename ElementT::BatchState >( first, last );
+    }
+  }
+  return nullptr;
+}
+
 template < typename ElementT >
 inline bool
 GenericModel< ElementT >::has_proxies()
@@ -254,6 +309,28 @@ GenericModel< ElementT >::get_status_()
   return d;
 }
 
+template < typename ElementT >
+Node::DoublePropertyReader
+GenericModel< ElementT >::get_double_property_reader( const std::string& key ) const
+{
+  return RecordablesMap< ElementT >::get_host_reader( key );
+}
+
+template < typename ElementT >
+size_t
+GenericModel< ElementT >::get_ring_buffer_memory( const Node& node ) const
+{
+  if constexpr ( requires( const ElementT& element ) { element.ring_buffers(); } )
+  {
+    return std::apply( []( const auto&... buffers ) { return ring_buffer_memory( buffers... ); },
+      static_cast< const ElementT& >( node ).ring_buffers() );
+  }
+  else
+  {
+    return 0;
+  }
+}
+
 template < typename ElementT >
 size_t
 GenericModel< ElementT >::get_element_size() const
@@ -261,6 +338,13 @@ GenericModel< ElementT >::get_element_size() const
   return sizeof( ElementT );
 }
 
+template < typename ElementT >
+bool
+GenericModel< ElementT >::has_cacheable_connection_checks() const
+{
+  return ElementT::has_cacheable_connection_checks;
+}
+
 template < typename ElementT >
 Node const&
 GenericModel< ElementT >::get_prototype() const
@@ -0,0 +1,306 @@
+/*
+ *  history_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef HISTORY_BUFFER_H
+#define HISTORY_BUFFER_H
+
+// C++ includes:
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Contiguous ring buffer for history entries.
+ *
+ * Entries are appended at the back and removed from the front, as with
+ * std::deque, but are stored in a single vector whose capacity is a power
+ * of two. Once the history has reached its working size, appending and
+ * removing entries does not allocate, and all entries stay in one block of
+ * memory. Iterators are random access and, as for std::deque, are
+ * invalidated by push_back().
+ */
+template < typename T >
+class HistoryBuffer
+{
+public:
+  class iterator
+  {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    iterator()
+      : buffer_( nullptr )
+      , idx_( 0 )
+    {
+    }
+
+    iterator( HistoryBuffer* buffer, size_t idx )
+      : buffer_( buffer )
+      , idx_( idx )
+    {
+    }
+
+    reference
+    operator*() const
+    {
+      return ( *buffer_ )[ idx_ ];
+    }
+
+    pointer
+    operator->() const
+    {
+      return &( *buffer_ )[ idx_ ];
+    }
+
+    reference
+    operator[]( difference_type n ) const
+    {
+      return ( *buffer_ )[ idx_ + n ];
+    }
+
+    iterator&
+    operator++()
+    {
+      ++idx_;
+      return *this;
+    }
+
+    iterator
+    operator++( int )
+    {
+      iterator tmp = *this;
+      ++idx_;
+      return tmp;
+    }
+
+    iterator&
+    operator--()
+    {
+      --idx_;
+      return *this;
+    }
+
+    iterator
+    operator--( int )
+    {
+      iterator tmp = *this;
+      --idx_;
+      return tmp;
+    }
+
+    iterator&
+    operator+=( difference_type n )
+    {
+      idx_ += n;
+      return *this;
+    }
+
+    iterator&
+    operator-=( difference_type n )
+    {
+      idx_ -= n;
+      return *this;
+    }
+
+    iterator
+    operator+( difference_type n ) const
+    {
+      return iterator( buffer_, idx_ + n );
+    }
+
+    iterator
+    operator-( difference_type n ) const
+    {
+      return iterator( buffer_, idx_ - n );
+    }
+
+    difference_type
+    operator-( const iterator& other ) const
+    {
+      return static_cast< difference_type >( idx_ ) - static_cast< difference_type >( other.idx_ );
+    }
+
+    bool
+    operator==( const iterator& other ) const
+    {
+      return idx_ == other.idx_ and buffer_ == other.buffer_;
+    }
+
+    bool
+    operator!=( const iterator& other ) const
+    {
+      return not( *this == other );
+    }
+
+    bool
+    operator<( const iterator& other ) const
+    {
+      return idx_ < other.idx_;
+    }
+
+    bool
+    operator>( const iterator& other ) const
+    {
+      return idx_ > other.idx_;
+    }
+
+    bool
+    operator<=( const iterator& other ) const
+    {
+      return idx_ <= other.idx_;
+    }
+
+    bool
+    operator>=( const iterator& other ) const
+    {
+      return idx_ >= other.idx_;
+    }
+
+  private:
+    HistoryBuffer* buffer_;
+    size_t idx_;  //!< logical position, 0 is the front of the buffer
+  };
+
+  HistoryBuffer()
+    : head_( 0 )
+    , size_( 0 )
+  {
+  }
+
+  bool
+  empty() const
+  {
+    return size_ == 0;
+  }
+
+  size_t
+  size() const
+  {
+    return size_;
+  }
+
+  T&
+  operator[]( size_t i )
+  {
+    assert( i < size_ );
+    return entries_[ ( head_ + i ) & ( entries_.size() - 1 ) ];
+  }
+
+  const T&
+  operator[]( size_t i ) const
+  {
+    assert( i < size_ );
+    return entries_[ ( head_ + i ) & ( entries_.size() - 1 ) ];
+  }
+
+  T&
+  front()
+  {
+    return ( *this )[ 0 ];
+  }
+
+  T&
+  back()
+  {
+    return ( *this )[ size_ - 1 ];
+  }
+
+  const T&
+  back() const
+  {
+    return ( *this )[ size_ - 1 ];
+  }
+
+  iterator
+  begin()
+  {
+    return iterator( this, 0 );
+  }
+
+  iterator
+  end()
+  {
+    return iterator( this, size_ );
+  }
+
+  void
+  push_back( const T& entry )
+  {
+    if ( size_ == entries_.size() )
+    {
+      grow_( entry );
+    }
+    entries_[ ( head_ + size_ ) & ( entries_.size() - 1 ) ] = entry;
+    ++size_;
+  }
+
+  void
+  pop_front()
+  {
+    assert( size_ > 0 );
+    head_ = ( head_ + 1 ) & ( entries_.size() - 1 );
+    --size_;
+  }
+
+  /**
+   * Remove all entries, keeping the allocated memory.
+   */
+  void
+  clear()
+  {
+    head_ = 0;
+    size_ = 0;
+  }
+
+private:
+  //! Double capacity and move entries to the start of the new storage, filling new slots with given entry
+  void
+  grow_( const T& fill )
+  {
+    const size_t new_capacity = entries_.empty() ? 8 : 2 * entries_.size();
+    std::vector< T > new_entries;
+    new_entries.reserve( new_capacity );
+    for ( size_t i = 0; i < size_; ++i )
+    {
+      new_entries.push_back( ( *this )[ i ] );
+    }
+    new_entries.resize( new_capacity, fill );
+    entries_.swap( new_entries );
+    head_ = 0;
+  }
+
+  std::vector< T > entries_;  //!< storage, size is zero or a power of two
+  size_t head_;               //!< position of the front entry in entries_
+  size_t size_;               //!< number of entries
+};
+
+}  // namespace nest
+
+#endif /* HISTORY_BUFFER_H */
@@ -31,6 +31,7 @@
 #include <sys/types.h>
 
 // C++ includes:
+#include <cassert>
 #include <cstdlib>
 
 // Includes from libnestutil:
@@ -41,8 +42,10 @@
 #include "io_manager_impl.h"
 #include "kernel_manager.h"
 #include "recording_backend_ascii.h"
+#include "recording_backend_binary.h"
 #include "recording_backend_memory.h"
 #include "recording_backend_screen.h"
+#include "recording_device.h"
 #ifdef HAVE_MPI
 #include "recording_backend_mpi.h"
 #include "stimulation_backend_mpi.h"
@@ -73,6 +76,7 @@ IOManager::initialize( const bool adjust_number_of_threads_or_rng_only )
     // Register backends again, since finalize cleans up
     // so backends from external modules are unloaded
     register_recording_backend< RecordingBackendASCII >( "ascii" );
+    register_recording_backend< RecordingBackendBinary >( "binary" );
     register_recording_backend< RecordingBackendMemory >( "memory" );
     register_recording_backend< RecordingBackendScreen >( "screen" );
 #ifdef HAVE_MPI
@@ -109,11 +113,15 @@ IOManager::initialize( const bool adjust_number_of_threads_or_rng_only )
   {
     it.second->initialize();
   }
+
+  buffering_devices_.resize( kernel().vp_manager.get_num_threads() );
 }
 
 void
 IOManager::finalize( const bool adjust_number_of_threads_or_rng_only )
 {
+  buffering_devices_.clear();
+
   for ( const auto& it : recording_backends_ )
   {
     it.second->finalize();
@@ -230,6 +238,17 @@ IOManager::get_status( Dictionary& d )
   d[ names::stimulation_backends ] = stimulation_backends;
 }
 
+void
+IOManager::get_memory_report( Dictionary& d ) const
+{
+  Dictionary recording_backends;
+  for ( const auto& [ name, backend ] : recording_backends_ )
+  {
+    recording_backends[ name ] = static_cast< long >( backend->get_memory_size() );
+  }
+  d[ names::recording_backends ] = recording_backends;
+}
+
 void
 IOManager::pre_run_hook()
 {
@@ -246,6 +265,15 @@ IOManager::pre_run_hook()
 void
 IOManager::post_run_hook()
 {
+  // Devices write to the data of their own thread in the backends, so they can be flushed in any order
+  for ( const auto& thread_devices : buffering_devices_ )
+  {
+    for ( RecordingDevice* device : thread_devices )
+    {
+      device->flush_buffered_events();
+    }
+  }
+
   for ( auto& it : recording_backends_ )
   {
     it.second->post_run_hook();
@@ -281,6 +309,11 @@ IOManager::prepare()
 void
 IOManager::cleanup()
 {
+  for ( auto& thread_devices : buffering_devices_ )
+  {
+    thread_devices.clear();
+  }
+
   for ( auto& it : recording_backends_ )
   {
     it.second->cleanup();
@@ -303,14 +336,12 @@ IOManager::is_valid_stimulation_backend( const std::string& backend_name ) const
   return stimulation_backends_.find( backend_name ) != stimulation_backends_.end();
 }
 
-void
-IOManager::write( const std::string& backend_name,
-  const RecordingDevice& device,
-  const Event& event,
-  const std::vector< double >& double_values,
-  const std::vector< long >& long_values )
+RecordingBackend*
+IOManager::get_recording_backend( const std::string& backend_name ) const
 {
-  recording_backends_[ backend_name ]->write( device, event, double_values, long_values );
+  const auto backend = recording_backends_.find( backend_name );
+  assert( backend != recording_backends_.end() );
+  return backend->second;
 }
 
 void
@@ -361,12 +392,9 @@ IOManager::enroll_stimulator( const std::string& backend_name, StimulationDevice
 }
 
 void
-IOManager::set_recording_value_names( const std::string& backend_name,
-  const RecordingDevice& device,
-  const std::vector< std::string >& double_value_names,
-  const std::vector< std::string >& long_value_names )
+IOManager::register_buffering_device( RecordingDevice& device )
 {
-  recording_backends_[ backend_name ]->set_value_names( device, double_value_names, long_value_names );
+  buffering_devices_[ device.get_thread() ].push_back( &device );
 }
 
 void
@@ -389,4 +417,18 @@ IOManager::get_recording_backend_device_status( const std::string& backend_name,
   recording_backends_[ backend_name ]->get_device_status( device, d );
 }
 
+void
+IOManager::drain_recording_backend_device_events( const std::string& backend_name,
+  const RecordingDevice& device,
+  RecordedEvents& events )
+{
+  auto* memory_backend = dynamic_cast< RecordingBackendMemory* >( recording_backends_[ backend_name ] );
+  if ( not memory_backend )
+  {
+    throw BadProperty(
+      String::compose( "Draining events is only supported by the memory backend, not by '%1'.", backend_name ) );
+  }
+  memory_backend->drain_device_events( device, events );
+}
+
 }  // namespace nest
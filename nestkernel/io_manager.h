@@ -25,6 +25,7 @@
 
 // C++ includes:
 #include <string>
+#include <vector>
 
 // Includes from libnestutil:
 #include "manager_interface.h"
@@ -35,6 +36,8 @@
 namespace nest
 {
 
+struct RecordedEvents;
+
 /**
  * Manager to handle everything related to input and output.
  *
@@ -56,6 +59,12 @@ public:
   void set_status( const Dictionary& ) override;
   void get_status( Dictionary& ) override;
 
+  /**
+   * Add the memory held by each recording backend for recorded data to
+   * the given dictionary, in bytes.
+   */
+  void get_memory_report( Dictionary& ) const;
+
   void set_recording_backend_status( std::string, const Dictionary& );
   Dictionary get_recording_backend_status( std::string );
 
@@ -85,7 +94,8 @@ public:
 
   /**
    * Clean up in all registered recording backends after a single call to run by
-   * calling the backends' post_run_hook() functions
+   * calling the backends' post_run_hook() functions. Devices registered with
+   * register_buffering_device() are flushed before.
    */
   void post_run_hook();
   void pre_run_hook();
@@ -113,40 +123,41 @@ public:
   bool is_valid_stimulation_backend( const std::string& ) const;
 
   /**
-   * Send device data to a given recording backend.
+   * Return the recording backend registered under the given name.
    *
-   * This function is called from a RecordingDevice `device` when it
-   * wants to write data to a given recording backend, identified by
-   * its `backend_name`. The function takes an Event `event` from
-   * which some fundamental data is taken and additionally vectors of
-   * `double_values` and `long_values` that have to be written. The
-   * data vectors may be empty, if no additional data has to be
-   * written.
+   * Recording devices call this function once in their pre_run_hook()
+   * and then hand over their data directly to the returned backend, so
+   * that the backend does not have to be looked up by name for every
+   * recorded event. The returned pointer stays valid until the kernel
+   * is reset.
    *
-   * \param backend_name the name of the RecordingBackend to write to
-   * \param device a reference to the RecordingDevice that wants to write
-   * \param event the Event to be written
-   * \param double_values a vector of doubles to be written
-   * \param long_values a vector of longs to be written
+   * \param backend_name the name of the RecordingBackend
    */
-  void write( const std::string&,
-    const RecordingDevice&,
-    const Event&,
-    const std::vector< double >&,
-    const std::vector< long >& );
+  RecordingBackend* get_recording_backend( const std::string& backend_name ) const;
 
   void enroll_recorder( const std::string&, const RecordingDevice&, const Dictionary& );
   void enroll_stimulator( const std::string&, StimulationDevice&, const Dictionary& );
 
-  void set_recording_value_names( const std::string& backend_name,
-    const RecordingDevice& device,
-    const std::vector< std::string >& double_value_names,
-    const std::vector< std::string >& long_value_names );
+  /**
+   * Register a recording device that buffers events during a run.
+   *
+   * Devices register in their pre_run_hook(). Their buffered events are
+   * handed to the backends at the end of each run, see post_run_hook().
+   * Registrations hold until cleanup().
+   */
+  void register_buffering_device( RecordingDevice& device );
 
   void check_recording_backend_device_status( const std::string&, const Dictionary& );
   void get_recording_backend_device_defaults( const std::string&, Dictionary& );
   void get_recording_backend_device_status( const std::string&, const RecordingDevice&, Dictionary& );
 
+  /**
+   * Move the events recorded by a device out of the given recording backend.
+   *
+   * @throws BadProperty if the backend does not support draining events
+   */
+  void drain_recording_backend_device_events( const std::string&, const RecordingDevice&, RecordedEvents& );
+
 private:
   void set_data_path_prefix_( const Dictionary& );
 
@@ -163,6 +174,9 @@ private:
    * A mapping from names to registered stimulation backends
    */
   std::map< std::string, StimulationBackend* > stimulation_backends_;
+
+  //! Recording devices that buffer events during a run, per thread
+  std::vector< std::vector< RecordingDevice* > > buffering_devices_;
 };
 
 }  // namespace nest
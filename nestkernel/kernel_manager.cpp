@@ -333,6 +333,18 @@ nest::KernelManager::get_status( Dictionary& dict )
   sw_mpi_synchronization_.get_status( dict, names::time_mpi_synchronization, names::time_mpi_synchronization_cpu );
 }
 
+void
+nest::KernelManager::get_memory_report( Dictionary& dict ) const
+{
+  assert( is_initialized() );
+
+  connection_manager.get_memory_report( dict );
+  event_delivery_manager.get_memory_report( dict );
+  model_manager.get_memory_report( dict );
+  node_manager.get_memory_report( dict );
+  io_manager.get_memory_report( dict );
+}
+
 void
 nest::KernelManager::write_to_dump( const std::string& msg )
 {
@@ -92,15 +92,25 @@
  local_num_threads                     integertype - The local number of threads, defaults to 1.
  max_buffer_size_target_data           integertype - Maximal size of MPI buffers for communication of connections,
                                                      defaults to 16777216.
+ node_placement                        stringtype  - Policy for placing neurons created next on virtual processes,
+                                                     either "round_robin" (default) or "block"; the latter places
+                                                     contiguous blocks of each population on the same rank.
  num_processes                         integertype - The number of MPI processes (read only).
  off_grid_spiking                      booltype    - Whether to transmit precise spike times in MPI communication (read
                                                      only).
+ overlap_spike_communication           booltype    - Whether to exchange spikes with non-blocking MPI, so that the
+                                                     exchange overlaps with the exchange and delivery of secondary
+                                                     events, defaults to false.
  total_num_virtual_procs               integertype - The total number of virtual processes, defaults to 1.
  use_compressed_spikes                 booltype    - Whether to use spike compression; if a neuron has targets on
                                                      multiple threads of a process, this switch makes sure that only a
                                                      single packet is sent to the process instead of one packet per
                                                      target thread (implies that connections will be sorted by source),
                                                      defaults to true.
+ sort_connections_by_target            booltype    - Whether to order the connections of each source by target when
+                                                     connections are sorted, so that spikes are delivered to targets in
+                                                     order of their node IDs; only used with spike compression,
+                                                     defaults to false.
 
  Random number generators
  rng_seed                              integertype - Seed value used as basis of seeding of all random number generators
@@ -249,6 +259,16 @@ public:
   void set_status( const Dictionary& );
   void get_status( Dictionary& );
 
+  /**
+   * Fill the dictionary with the estimated number of bytes held by
+   * connections, tables, MPI buffers, nodes, ring buffers and recording
+   * backends of this process.
+   *
+   * The report is not part of the kernel status, because computing it
+   * requires iterating over all local nodes.
+   */
+  void get_memory_report( Dictionary& ) const;
+
   void prepare();
   void cleanup();
 
@@ -41,13 +41,49 @@
 namespace nest
 {
 
-NodeCollectionMetadataPTR AbstractLayer::cached_ntree_md_ = NodeCollectionMetadataPTR( nullptr );
-NodeCollectionMetadataPTR AbstractLayer::cached_vector_md_ = NodeCollectionMetadataPTR( nullptr );
+size_t AbstractLayer::cache_hits_ = 0;
+size_t AbstractLayer::cache_misses_ = 0;
+size_t AbstractLayer::cache_memory_ = 0;
+size_t AbstractLayer::cache_budget_ = AbstractLayer::default_cache_budget_;
 
 AbstractLayer::~AbstractLayer()
 {
 }
 
+void
+AbstractLayer::get_cache_status( Dictionary& d )
+{
+  d[ names::spatial_index_cache_budget ] = static_cast< double >( cache_budget_ ) / ( 1024 * 1024 );
+  d[ names::spatial_index_cache_memory ] = static_cast< double >( cache_memory_ ) / ( 1024 * 1024 );
+  d[ names::spatial_index_cache_hits ] = static_cast< long >( cache_hits_ );
+  d[ names::spatial_index_cache_misses ] = static_cast< long >( cache_misses_ );
+}
+
+void
+AbstractLayer::set_cache_status( const Dictionary& d )
+{
+  double budget = static_cast< double >( cache_budget_ ) / ( 1024 * 1024 );
+  if ( d.update_value( names::spatial_index_cache_budget, budget ) )
+  {
+    if ( budget < 0 )
+    {
+      throw BadProperty( "spatial_index_cache_budget >= 0 required." );
+    }
+    cache_budget_ = static_cast< size_t >( budget * 1024 * 1024 );
+  }
+}
+
+void
+AbstractLayer::reset_caches()
+{
+  Layer< 2 >::clear_cache();
+  Layer< 3 >::clear_cache();
+  assert( cache_memory_ == 0 );
+  cache_hits_ = 0;
+  cache_misses_ = 0;
+  cache_budget_ = default_cache_budget_;
+}
+
 NodeCollectionPTR
 AbstractLayer::create_layer( const Dictionary& layer_dict )
 {
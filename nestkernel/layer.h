@@ -26,6 +26,7 @@
 // C++ includes:
 #include <bitset>
 #include <iostream>
+#include <list>
 #include <utility>
 
 // Includes from nestkernel:
@@ -110,6 +111,33 @@ public:
   virtual double compute_distance( const std::vector< double >& from_pos,
     const std::vector< double >& to_pos ) const = 0;
 
+  /**
+   * Computes displacements in one dimension from a batch of positions to a
+   * given position. When using periodic boundary conditions, the minimum
+   * displacements are computed.
+   *
+   * @param from_positions  positions in layer, stored one after the other
+   * @param to_pos          position to which displacements are to be computed
+   * @param dimension       dimension of the displacements
+   * @param displacements   array the displacements are written to
+   */
+  virtual void compute_displacements( const std::vector< double >& from_positions,
+    const std::vector< double >& to_pos,
+    const unsigned int dimension,
+    std::vector< double >& displacements ) const = 0;
+
+  /**
+   * Computes distances from a batch of positions to a given position. When
+   * using periodic boundary conditions, the minimum distances are computed.
+   *
+   * @param from_positions  positions in layer, stored one after the other
+   * @param to_pos          position to which distances are to be computed
+   * @param distances       array the distances are written to
+   */
+  virtual void compute_distances( const std::vector< double >& from_positions,
+    const std::vector< double >& to_pos,
+    std::vector< double >& distances ) const = 0;
+
   /**
    * Connect this layer to the given target layer. The actual connections
    * are made in class ConnectionCreator.
@@ -175,31 +203,40 @@ public:
   void set_node_collection( NodeCollectionPTR );
   NodeCollectionPTR get_node_collection();
 
-protected:
   /**
-   * The NodeCollection to which the layer belongs
+   * Write statistics and budget of the global position caches to the dictionary.
    */
-  NodeCollectionPTR node_collection_;
+  static void get_cache_status( Dictionary& d );
 
   /**
-   * Metadata for the layer for which we cache global position information
+   * Set the memory budget of the global position caches from the dictionary.
    */
-  static NodeCollectionMetadataPTR cached_ntree_md_;
+  static void set_cache_status( const Dictionary& d );
 
   /**
-   * Metadata for the layer for which we cache global position information
+   * Clear the global position caches of all dimensions and reset statistics and budget.
    */
-  static NodeCollectionMetadataPTR cached_vector_md_;
+  static void reset_caches();
 
+protected:
   /**
-   * Clear the cache for global position information
+   * The NodeCollection to which the layer belongs
    */
-  virtual void clear_ntree_cache_() const = 0;
+  NodeCollectionPTR node_collection_;
 
-  /**
-   * Clear the cache for global position information
-   */
-  virtual void clear_vector_cache_() const = 0;
+  //! Number of requests for global positions served from the caches
+  static size_t cache_hits_;
+
+  //! Number of requests for global positions which required collecting positions
+  static size_t cache_misses_;
+
+  //! Memory used by cached global positions of all dimensions, in bytes
+  static size_t cache_memory_;
+
+  //! Maximal memory used by cached global positions, in bytes
+  static size_t cache_budget_;
+
+  static constexpr size_t default_cache_budget_ = 1024 * 1024 * 1024;
 
   /**
    * Gets metadata of the NodeCollection to which this layer belongs.
@@ -224,8 +261,6 @@ public:
 
   Layer( const Layer& other_layer );
 
-  ~Layer() override;
-
   /**
    * Change properties of the layer according to the
    * entries in the dictionary.
@@ -332,14 +367,23 @@ public:
 
   double compute_distance( const std::vector< double >& from_pos, const std::vector< double >& to_pos ) const override;
 
+  void compute_displacements( const std::vector< double >& from_positions,
+    const std::vector< double >& to_pos,
+    const unsigned int dimension,
+    std::vector< double >& displacements ) const override;
+
+  void compute_distances( const std::vector< double >& from_positions,
+    const std::vector< double >& to_pos,
+    std::vector< double >& distances ) const override;
+
 
   /**
    * Get positions for all nodes in layer, including nodes on other MPI processes.
    *
    * The positions will be cached so that subsequent calls for
-   * the same layer are fast. One one layer is cached at the time, so the
-   * user should group together all ConnectLayers calls using the same
-   * pool layer.
+   * the same layer are fast. Positions of several layers are kept in a
+   * least recently used cache, limited by the spatial_index_cache_budget
+   * kernel attribute.
    */
   std::shared_ptr< Ntree< D, size_t > > get_global_positions_ntree( NodeCollectionPTR node_collection );
 
@@ -355,7 +399,8 @@ public:
     Position< D > extent,
     NodeCollectionPTR node_collection );
 
-  std::vector< std::pair< Position< D >, size_t > >* get_global_positions_vector( NodeCollectionPTR node_collection );
+  std::shared_ptr< std::vector< std::pair< Position< D >, size_t > > > get_global_positions_vector(
+    NodeCollectionPTR node_collection );
 
   virtual std::vector< std::pair< Position< D >, size_t > > get_global_positions_vector( const MaskPTR mask,
     const Position< D >& anchor,
@@ -411,18 +456,43 @@ public:
     AbstractLayerPTR target_layer,
     const std::string& syn_model ) override;
 
+  /**
+   * Clear the cache for global position information of this dimension.
+   */
+  static void clear_cache();
+
 protected:
   /**
-   * Clear the cache for global position information
+   * Global position information for one NodeCollection.
+   *
+   * An entry holds either an Ntree, built with the given periodicity and
+   * extent, or a vector of positions sorted by node ID.
    */
-  void clear_ntree_cache_() const override;
+  struct CacheEntry_
+  {
+    NodeCollectionPTR node_collection;
+    std::bitset< D > periodic;
+    Position< D > extent;
+    std::shared_ptr< Ntree< D, size_t > > ntree;
+    std::shared_ptr< std::vector< std::pair< Position< D >, size_t > > > vector;
+    size_t memory;  //!< estimated memory used by the positions, in bytes
+  };
 
   /**
-   * Clear the cache for global position information
+   * Find cached Ntree (or vector if ntree is false) for the given NodeCollection and geometry.
+   *
+   * A found entry is moved to the front of the cache.
+   * @returns iterator to the entry, or the end of the cache
    */
-  void clear_vector_cache_() const override;
+  typename std::list< CacheEntry_ >::iterator find_cache_entry_( NodeCollectionPTR node_collection,
+    bool ntree,
+    const std::bitset< D >& periodic,
+    const Position< D >& extent ) const;
 
-  std::shared_ptr< Ntree< D, size_t > > do_get_global_positions_ntree_( NodeCollectionPTR node_collection );
+  /**
+   * Insert entry at the front of the cache and evict least recently used entries beyond the budget.
+   */
+  void insert_cache_entry_( CacheEntry_ entry ) const;
 
   /**
    * Insert global position info into ntree.
@@ -441,10 +511,9 @@ protected:
   std::bitset< D > periodic_;  //!< periodic b.c.
 
   /**
-   * Global position information for a single layer
+   * Global position information, most recently used first
    */
-  static std::shared_ptr< Ntree< D, size_t > > cached_ntree_;
-  static std::vector< std::pair< Position< D >, size_t > >* cached_vector_;
+  static std::list< CacheEntry_ > cache_;
 
   friend class MaskedLayer< D >;
 };
@@ -606,20 +675,6 @@ inline Layer< D >::Layer( const Layer& other_layer )
 {
 }
 
-template < int D >
-inline Layer< D >::~Layer()
-{
-  if ( cached_ntree_md_ == get_metadata() )
-  {
-    clear_ntree_cache_();
-  }
-
-  if ( cached_vector_md_ == get_metadata() )
-  {
-    clear_vector_cache_();
-  }
-}
-
 template < int D >
 inline Position< D >
 Layer< D >::compute_displacement( const Position< D >& from_pos, const size_t to_lid ) const
@@ -662,30 +717,73 @@ Layer< D >::compute_distance( const std::vector< double >& from_pos, const std::
 }
 
 template < int D >
-inline std::vector< double >
-Layer< D >::get_position_vector( const size_t sind ) const
+inline void
+Layer< D >::compute_displacements( const std::vector< double >& from_positions,
+  const std::vector< double >& to_pos,
+  const unsigned int dimension,
+  std::vector< double >& displacements ) const
 {
-  return get_position( sind ).get_vector();
+  const size_t num_positions = from_positions.size() / D;
+  displacements.resize( num_positions );
+
+  const double to = to_pos[ dimension ];
+  for ( size_t i = 0; i < num_positions; ++i )
+  {
+    displacements[ i ] = to - from_positions[ i * D + dimension ];
+  }
+
+  // The periodic case is handled in a separate loop so that the plain case
+  // remains a simple, vectorizable subtraction.
+  if ( periodic_[ dimension ] )
+  {
+    const double extent = extent_[ dimension ];
+    const double inv_extent = 1 / extent;
+    for ( auto& displacement : displacements )
+    {
+      displacement -= extent * std::round( displacement * inv_extent );
+    }
+  }
 }
 
 template < int D >
 inline void
-Layer< D >::clear_ntree_cache_() const
+Layer< D >::compute_distances( const std::vector< double >& from_positions,
+  const std::vector< double >& to_pos,
+  std::vector< double >& distances ) const
 {
-  cached_ntree_ = std::shared_ptr< Ntree< D, size_t > >();
-  cached_ntree_md_ = NodeCollectionMetadataPTR( nullptr );
+  distances.assign( from_positions.size() / D, 0. );
+
+  std::vector< double > displacements;
+  for ( unsigned int i = 0; i < D; ++i )
+  {
+    compute_displacements( from_positions, to_pos, i, displacements );
+    for ( size_t j = 0; j < distances.size(); ++j )
+    {
+      distances[ j ] += displacements[ j ] * displacements[ j ];
+    }
+  }
+  for ( auto& distance : distances )
+  {
+    distance = std::sqrt( distance );
+  }
+}
+
+template < int D >
+inline std::vector< double >
+Layer< D >::get_position_vector( const size_t sind ) const
+{
+  return get_position( sind ).get_vector();
 }
 
 template < int D >
 inline void
-Layer< D >::clear_vector_cache_() const
+Layer< D >::clear_cache()
 {
-  if ( cached_vector_ != 0 )
+  for ( const auto& entry : cache_ )
   {
-    delete cached_vector_;
+    cache_memory_ -= entry.memory;
   }
-  cached_vector_ = 0;
-  cached_vector_md_ = NodeCollectionMetadataPTR( nullptr );
+  cache_.clear();
 }
 
 }  // namespace nest
@@ -36,10 +36,7 @@ namespace nest
 {
 
 template < int D >
-std::shared_ptr< Ntree< D, size_t > > Layer< D >::cached_ntree_;
-
-template < int D >
-std::vector< std::pair< Position< D >, size_t > >* Layer< D >::cached_vector_ = 0;
+std::list< typename Layer< D >::CacheEntry_ > Layer< D >::cache_;
 
 template < int D >
 Position< D >
@@ -136,21 +133,56 @@ Layer< D >::connect( NodeCollectionPTR source_nc,
 }
 
 template < int D >
-std::shared_ptr< Ntree< D, size_t > >
-Layer< D >::get_global_positions_ntree( NodeCollectionPTR node_collection )
+typename std::list< typename Layer< D >::CacheEntry_ >::iterator
+Layer< D >::find_cache_entry_( NodeCollectionPTR node_collection,
+  bool ntree,
+  const std::bitset< D >& periodic,
+  const Position< D >& extent ) const
 {
-  if ( cached_ntree_md_ == node_collection->get_metadata() )
+  for ( auto it = cache_.begin(); it != cache_.end(); ++it )
   {
-    assert( cached_ntree_.get() );
-    return cached_ntree_;
+    if ( ( it->ntree.get() != nullptr ) != ntree
+      or it->node_collection->get_metadata() != node_collection->get_metadata() )
+    {
+      continue;
+    }
+    if ( ntree and ( it->periodic != periodic or it->extent != extent ) )
+    {
+      continue;
+    }
+    // Sliced NodeCollections share the metadata of the layer
+    if ( not( *it->node_collection == node_collection ) )
+    {
+      continue;
+    }
+
+    cache_.splice( cache_.begin(), cache_, it );
+    return cache_.begin();
   }
+  return cache_.end();
+}
 
-  clear_ntree_cache_();
+template < int D >
+void
+Layer< D >::insert_cache_entry_( CacheEntry_ entry ) const
+{
+  cache_memory_ += entry.memory;
+  cache_.push_front( std::move( entry ) );
 
-  cached_ntree_ = std::shared_ptr< Ntree< D, size_t > >(
-    new Ntree< D, size_t >( this->lower_left_, this->extent_, this->periodic_ ) );
+  // Entries are only held by shared pointers, so evicting entries still in use is safe.
+  // The new entry is always kept, even if it exceeds the budget by itself.
+  while ( cache_memory_ > cache_budget_ and cache_.size() > 1 )
+  {
+    cache_memory_ -= cache_.back().memory;
+    cache_.pop_back();
+  }
+}
 
-  return do_get_global_positions_ntree_( node_collection );
+template < int D >
+std::shared_ptr< Ntree< D, size_t > >
+Layer< D >::get_global_positions_ntree( NodeCollectionPTR node_collection )
+{
+  return get_global_positions_ntree( periodic_, lower_left_, extent_, node_collection );
 }
 
 template < int D >
@@ -160,9 +192,6 @@ Layer< D >::get_global_positions_ntree( std::bitset< D > periodic,
   Position< D > extent,
   NodeCollectionPTR node_collection )
 {
-  clear_ntree_cache_();
-  clear_vector_cache_();
-
   // Keep layer geometry for non-periodic dimensions
   for ( int i = 0; i < D; ++i )
   {
@@ -173,74 +202,65 @@ Layer< D >::get_global_positions_ntree( std::bitset< D > periodic,
     }
   }
 
-  cached_ntree_ =
-    std::shared_ptr< Ntree< D, size_t > >( new Ntree< D, size_t >( this->lower_left_, extent, periodic ) );
-
-  do_get_global_positions_ntree_( node_collection );
-
-  // Do not use cache since the periodic bits and extents were altered.
-  cached_ntree_md_ = NodeCollectionMetadataPTR( nullptr );
+  const auto cached = find_cache_entry_( node_collection, true, periodic, extent );
+  if ( cached != cache_.end() )
+  {
+    ++cache_hits_;
+    return cached->ntree;
+  }
+  ++cache_misses_;
 
-  return cached_ntree_;
-}
+  auto ntree = std::make_shared< Ntree< D, size_t > >( this->lower_left_, extent, periodic );
 
-template < int D >
-std::shared_ptr< Ntree< D, size_t > >
-Layer< D >::do_get_global_positions_ntree_( NodeCollectionPTR node_collection )
-{
-  if ( cached_vector_md_ == node_collection->get_metadata() )
+  // Vectors are filled in the same order as trees, so a cached vector can be used instead of collecting positions
+  const auto cached_vector = find_cache_entry_( node_collection, false, periodic, extent );
+  if ( cached_vector != cache_.end() )
   {
-    // Convert from vector to Ntree
-    std::copy( cached_vector_->begin(), cached_vector_->end(), std::back_inserter( *cached_ntree_ ) );
+    std::copy( cached_vector->vector->begin(), cached_vector->vector->end(), std::back_inserter( *ntree ) );
   }
   else
   {
-    insert_global_positions_ntree_( *cached_ntree_, node_collection );
+    insert_global_positions_ntree_( *ntree, node_collection );
   }
 
-  clear_vector_cache_();
-
-  cached_ntree_md_ = node_collection->get_metadata();
-
-  return cached_ntree_;
+  size_t num_positions = 0;
+  for ( auto it = ntree->begin(); it != ntree->end(); ++it )
+  {
+    ++num_positions;
+  }
+  insert_cache_entry_( { node_collection,
+    periodic,
+    extent,
+    ntree,
+    nullptr,
+    num_positions * sizeof( std::pair< Position< D >, size_t > ) } );
+
+  return ntree;
 }
 
 template < int D >
-std::vector< std::pair< Position< D >, size_t > >*
+std::shared_ptr< std::vector< std::pair< Position< D >, size_t > > >
 Layer< D >::get_global_positions_vector( NodeCollectionPTR node_collection )
 {
-  if ( cached_vector_md_ == node_collection->get_metadata() )
-  {
-    assert( cached_vector_ );
-    return cached_vector_;
-  }
-
-  clear_vector_cache_();
-
-  cached_vector_ = new std::vector< std::pair< Position< D >, size_t > >;
-
-  if ( cached_ntree_md_ == node_collection->get_metadata() )
-  {
-    // Convert from NTree to vector
-
-    typename std::back_insert_iterator< std::vector< std::pair< Position< D >, size_t > > > to =
-      std::back_inserter( *cached_vector_ );
-
-    for ( typename Ntree< D, size_t >::iterator from = cached_ntree_->begin(); from != cached_ntree_->end(); ++from )
-    {
-      *to = *from;
-    }
-  }
-  else
+  const auto cached = find_cache_entry_( node_collection, false, periodic_, extent_ );
+  if ( cached != cache_.end() )
   {
-    insert_global_positions_vector_( *cached_vector_, node_collection );
+    ++cache_hits_;
+    return cached->vector;
   }
+  ++cache_misses_;
 
-  clear_ntree_cache_();
+  auto positions = std::make_shared< std::vector< std::pair< Position< D >, size_t > > >();
+  insert_global_positions_vector_( *positions, node_collection );
 
-  cached_vector_md_ = node_collection->get_metadata();
+  insert_cache_entry_( { node_collection,
+    periodic_,
+    extent_,
+    nullptr,
+    positions,
+    positions->capacity() * sizeof( std::pair< Position< D >, size_t > ) } );
 
-  return cached_vector_;
+  return positions;
 }
 
 template < int D >
@@ -308,7 +328,7 @@ Layer< D >::dump_connections( std::ostream& out,
   const auto& connectome = kernel().connection_manager.get_connections( conn_filter );
 
   // Get positions of remote nodes
-  std::vector< std::pair< Position< D >, size_t > >* src_vec = get_global_positions_vector( node_collection );
+  const auto src_vec = get_global_positions_vector( node_collection );
 
   // Iterate over connectome and write every connection, looking up source position only if source neuron changes
   size_t previous_source_node_id = 0;  // dummy initial value, cannot be node_id of any node
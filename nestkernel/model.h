@@ -24,12 +24,14 @@
 #define MODEL_H
 
 // C++ includes:
+#include <memory>
 #include <new>
 #include <string>
 #include <vector>
 
 // Includes from nestkernel:
 #include "node.h"
+#include "node_batch_state.h"
 
 
 namespace nest
@@ -171,6 +173,51 @@ public:
    */
   virtual size_t get_element_size() const = 0;
 
+  /**
+   * Return whether connection checks for nodes of this model can be cached.
+   *
+   * @see Node::has_cacheable_connection_checks
+   */
+  virtual bool has_cacheable_connection_checks() const = 0;
+
+  /**
+   * Update all nodes in [first, last) through the interval (origin+from, origin+to].
+   *
+   * All nodes must have been created by this model. Frozen nodes are skipped.
+   * @see Node::update()
+   */
+  virtual void
+  update_nodes( Node* const* first, Node* const* last, Time const& origin, const long from, const long to ) = 0;
+
+  /**
+   * Load the state of the non-frozen nodes in [first, last) into structure-of-arrays storage for a run.
+   *
+   * All nodes must have been created by this model. Returns an empty pointer for models that update
+   * their nodes in place and for ranges of nodes that the model cannot hold in arrays.
+   * @see Node::has_batch_state
+   */
+  virtual std::unique_ptr< NodeBatchState > create_batch_state( Node* const* first, Node* const* last ) = 0;
+
+  /**
+   * Return a function that reads the property key from nodes of this model
+   * without calling get_status(), or an empty function if there is none.
+   *
+   * Recordables of models with a static RecordablesMap are read this way.
+   * NodeManager::get_status_columns() resolves the reader once per model.
+   */
+  virtual Node::DoublePropertyReader get_double_property_reader( const std::string& key ) const = 0;
+
+  /**
+   * Return the number of bytes held by the input ring buffers of the node.
+   *
+   * The node must have been created by this model. Models name their ring
+   * buffers in a private member function ring_buffers() returning a tuple of
+   * references, see ring_buffer_memory(); nodes without it hold none. The
+   * value is computed on demand for the memory report, so it does not add to
+   * the cost of creating or updating nodes.
+   */
+  virtual size_t get_ring_buffer_memory( const Node& node ) const = 0;
+
   /**
    * Return const reference to the prototype.
    */
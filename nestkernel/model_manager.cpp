@@ -430,6 +430,21 @@ ModelManager::compare_model_by_id_( const int a, const int b )
     < kernel().model_manager.get_node_model( b )->get_name();
 }
 
+void
+ModelManager::get_memory_report( Dictionary& dict ) const
+{
+  Dictionary nodes;
+  for ( Model* model : node_models_ )
+  {
+    const size_t num_nodes = model->mem_capacity() - model->mem_available();
+    if ( num_nodes > 0 )
+    {
+      nodes[ model->get_name() ] = static_cast< long >( num_nodes * model->get_element_size() );
+    }
+  }
+  dict[ names::nodes ] = nodes;
+}
+
 void
 ModelManager::memory_info() const
 {
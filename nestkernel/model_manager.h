@@ -169,6 +169,12 @@ public:
    */
   void memory_info() const;
 
+  /**
+   * Add the memory held by the nodes of each node model to the given
+   * dictionary, in bytes.
+   */
+  void get_memory_report( Dictionary& ) const;
+
   std::unique_ptr< SecondaryEvent > get_secondary_event_prototype( const synindex syn_id, const size_t tid );
 
 private:
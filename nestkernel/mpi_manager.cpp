@@ -69,6 +69,7 @@ nest::MPIManager::MPIManager()
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
+  , ialltoall_request_( MPI_REQUEST_NULL )
 #endif
 {
 }
@@ -803,6 +804,21 @@ nest::MPIManager::communicate_Alltoallv_( void* send_buffer,
     comm );
 }
 
+void
+nest::MPIManager::communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count )
+{
+  assert( ialltoall_request_ == MPI_REQUEST_NULL );
+  MPI_Ialltoall(
+    send_buffer, send_recv_count, MPI_UNSIGNED, recv_buffer, send_recv_count, MPI_UNSIGNED, comm, &ialltoall_request_ );
+}
+
+void
+nest::MPIManager::wait_for_Ialltoall()
+{
+  // MPI_Wait resets the request to MPI_REQUEST_NULL and returns at once for MPI_REQUEST_NULL
+  MPI_Wait( &ialltoall_request_, MPI_STATUS_IGNORE );
+}
+
 void
 nest::MPIManager::communicate_recv_counts_secondary_events()
 {
@@ -822,6 +838,50 @@ nest::MPIManager::synchronize()
 }
 
 
+void
+nest::MPIManager::communicate_secondary_events_sparse( const std::vector< std::vector< unsigned int > >& send_messages,
+  std::vector< std::vector< unsigned int > >& recv_messages,
+  const std::vector< size_t >& max_recv_sizes )
+{
+  const int tag = 0;
+  std::vector< MPI_Request > requests;
+  std::vector< size_t > recv_ranks;
+
+  // post receives first, then all sends
+  for ( size_t rank = 0; rank < max_recv_sizes.size(); ++rank )
+  {
+    if ( max_recv_sizes[ rank ] > 0 )
+    {
+      recv_messages[ rank ].resize( max_recv_sizes[ rank ] );
+      requests.emplace_back();
+      recv_ranks.push_back( rank );
+      MPI_Irecv(
+        &recv_messages[ rank ][ 0 ], max_recv_sizes[ rank ], MPI_UNSIGNED, rank, tag, comm, &requests.back() );
+    }
+  }
+
+  for ( size_t rank = 0; rank < send_messages.size(); ++rank )
+  {
+    if ( not send_messages[ rank ].empty() )
+    {
+      requests.emplace_back();
+      MPI_Isend(
+        &send_messages[ rank ][ 0 ], send_messages[ rank ].size(), MPI_UNSIGNED, rank, tag, comm, &requests.back() );
+    }
+  }
+
+  std::vector< MPI_Status > statuses( requests.size() );
+  MPI_Waitall( requests.size(), &requests[ 0 ], &statuses[ 0 ] );
+
+  // receive requests come first, shrink messages to their actual size
+  for ( size_t i = 0; i < recv_ranks.size(); ++i )
+  {
+    int count;
+    MPI_Get_count( &statuses[ i ], MPI_UNSIGNED, &count );
+    recv_messages[ recv_ranks[ i ] ].resize( count );
+  }
+}
+
 // any_true: takes a single bool, exchanges with all other processes,
 // and returns "true" if one or more processes provide "true"
 bool
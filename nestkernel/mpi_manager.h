@@ -211,6 +211,8 @@ public:
     const int* recv_counts,
     const int* recv_displacements );
 
+  void communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
+
 #endif /* HAVE_MPI */
 
   template < class D >
@@ -226,6 +228,39 @@ public:
   template < class D >
   void communicate_secondary_events_Alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
 
+  /**
+   * Exchange variable-size messages of secondary events with individual ranks.
+   *
+   * A message is sent to every rank for which send_messages contains a
+   * non-empty message, and a message is received from every rank for which
+   * max_recv_sizes is non-zero. Received messages are stored in recv_messages.
+   */
+  void communicate_secondary_events_sparse( const std::vector< std::vector< unsigned int > >& send_messages,
+    std::vector< std::vector< unsigned int > >& recv_messages,
+    const std::vector< size_t >& max_recv_sizes );
+
+  /**
+   * Start a non-blocking Alltoall.
+   *
+   * Neither buffer may be touched until wait_for_Ialltoall() has returned.
+   * Only a single non-blocking Alltoall may be pending at any time.
+   */
+  template < class D >
+  void communicate_Ialltoall( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const unsigned int send_recv_count );
+  template < class D >
+  void communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+  template < class D >
+  void communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+
+  /**
+   * Block until the pending non-blocking Alltoall has completed.
+   *
+   * Returns immediately if no non-blocking Alltoall is pending.
+   */
+  void wait_for_Ialltoall();
+
   /**
    * Ensure all processes have reached the same stage by waiting until all
    * processes have sent a dummy message to process 0.
@@ -352,6 +387,9 @@ private:
   MPI_Comm comm;
   MPI_Datatype MPI_OFFGRID_SPIKE;
 
+  //! Handle of the pending non-blocking Alltoall, MPI_REQUEST_NULL if none is pending
+  MPI_Request ialltoall_request_;
+
   void communicate_Allgather( std::vector< unsigned int >& send_buffer,
     std::vector< unsigned int >& recv_buffer,
     std::vector< int >& displacements );
@@ -652,6 +690,14 @@ MPIManager::any_true( const bool my_bool )
   return my_bool;
 }
 
+inline void
+MPIManager::communicate_secondary_events_sparse( const std::vector< std::vector< unsigned int > >& send_messages,
+  std::vector< std::vector< unsigned int > >& recv_messages,
+  const std::vector< size_t >& )
+{
+  recv_messages = send_messages;
+}
+
 inline double
 MPIManager::time_communicate( int, int )
 {
@@ -712,6 +758,18 @@ MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffe
     &recv_displacements_secondary_events_in_int_per_rank_[ 0 ] );
 }
 
+template < class D >
+void
+MPIManager::communicate_Ialltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count )
+{
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_Ialltoall_( send_buffer_int, recv_buffer_int, send_recv_count );
+}
+
 #else  // HAVE_MPI
 template < class D >
 void
@@ -722,6 +780,18 @@ MPIManager::MPIManager::communicate_Alltoall( std::vector< D >& send_buffer,
   recv_buffer.swap( send_buffer );
 }
 
+template < class D >
+void
+MPIManager::communicate_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer, const unsigned int )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+inline void
+MPIManager::wait_for_Ialltoall()
+{
+}
+
 template < class D >
 void
 MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
@@ -760,6 +830,26 @@ MPIManager::communicate_off_grid_spike_data_Alltoall( std::vector< D >& send_buf
 
   communicate_Alltoall( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
 }
+
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank =
+    sizeof( SpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall( send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+}
+
+template < class D >
+void
+MPIManager::communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
+    sizeof( OffGridSpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
+}
 }
 
 #endif /* MPI_MANAGER_H */
@@ -34,6 +34,7 @@
 
 // Includes from nestkernel:
 #include "kernel_manager.h"
+#include "vp_manager_impl.h"
 
 inline size_t
 nest::MPIManager::get_process_id_of_vp( const size_t vp ) const
@@ -73,7 +74,7 @@ nest::MPIManager::communicate_Allgatherv( std::vector< T >& send_buffer,
 inline size_t
 nest::MPIManager::get_process_id_of_node_id( const size_t node_id ) const
 {
-  return node_id % kernel().vp_manager.get_num_virtual_processes() % num_processes_;
+  return get_process_id_of_vp( kernel().vp_manager.node_id_to_vp( node_id ) );
 }
 
 #else  // HAVE_MPI
@@ -30,6 +30,8 @@
 #include "kernel_manager.h"
 #include "mpi_manager_impl.h"
 #include "parameter.h"
+#include "recording_backend_memory.h"
+#include "recording_device.h"
 
 #include "sp_manager.h"
 #include "sp_manager_impl.h"
@@ -164,6 +166,17 @@ get_kernel_status()
   return d;
 }
 
+Dictionary
+get_memory_report()
+{
+  assert( kernel().is_initialized() );
+
+  Dictionary d;
+  kernel().get_memory_report( d );
+
+  return d;
+}
+
 // TODO: Add the possibility to filter for specific keys
 Dictionary
 get_nc_status( NodeCollectionPTR nc )
@@ -206,6 +219,12 @@ get_nc_status( NodeCollectionPTR nc )
   return result;
 }
 
+Dictionary
+get_nc_status_columns( NodeCollectionPTR nc, const std::vector< std::string >& keys )
+{
+  return kernel().node_manager.get_status_columns( nc, keys );
+}
+
 void
 set_nc_status( NodeCollectionPTR nc, std::vector< Dictionary >& params )
 {
@@ -304,6 +323,30 @@ get_connection_status( const std::deque< ConnectionID >& conns )
   return result;
 }
 
+void
+get_connection_status_column( const std::deque< ConnectionID >& conns, const std::string& key, double* values )
+{
+  kernel().connection_manager.get_synapse_status_column( conns, key, values );
+}
+
+void
+get_connection_status_column( const std::deque< ConnectionID >& conns, const std::string& key, long* values )
+{
+  kernel().connection_manager.get_synapse_status_column( conns, key, values );
+}
+
+void
+set_connection_status_column( const std::deque< ConnectionID >& conns, const std::string& key, const double* values )
+{
+  kernel().connection_manager.set_synapse_status_column( conns, key, values );
+}
+
+void
+set_connection_status_column( const std::deque< ConnectionID >& conns, const std::string& key, const long* values )
+{
+  kernel().connection_manager.set_synapse_status_column( conns, key, values );
+}
+
 void
 set_node_status( const size_t node_id, const Dictionary& dict )
 {
@@ -316,6 +359,26 @@ get_node_status( const size_t node_id )
   return kernel().node_manager.get_status( node_id );
 }
 
+std::vector< std::shared_ptr< RecordedEvents > >
+drain_recorded_events( const size_t node_id )
+{
+  std::vector< std::shared_ptr< RecordedEvents > > result;
+  for ( Node* node : kernel().node_manager.get_thread_siblings( node_id ) )
+  {
+    auto* device = dynamic_cast< RecordingDevice* >( node );
+    if ( not device )
+    {
+      throw BadProperty( "Events can only be drained from recording devices." );
+    }
+
+    auto events = std::make_shared< RecordedEvents >();
+    device->drain_events( *events );
+    result.push_back( events );
+  }
+
+  return result;
+}
+
 Dictionary
 get_connection_status( const ConnectionID& conn )
 {
@@ -24,6 +24,7 @@
 #define NEST_H
 
 // C++ includes:
+#include <memory>
 #include <ostream>
 
 // Includes from libnestutil:
@@ -43,6 +44,8 @@
 namespace nest
 {
 
+struct RecordedEvents;
+
 /**
  * Register connection model (i.e. an instance of a class inheriting from `Connection`).
  */
@@ -70,16 +73,47 @@ size_t nc_size( NodeCollectionPTR nc );
 void set_kernel_status( const Dictionary& dict );
 Dictionary get_kernel_status();
 
+/**
+ * Get the estimated number of bytes held by the main data structures of this process.
+ */
+Dictionary get_memory_report();
+
 Dictionary get_nc_status( NodeCollectionPTR node_collection );
+
+/**
+ * Get selected properties of all MPI-local nodes in the node collection as one vector of values per key.
+ */
+Dictionary get_nc_status_columns( NodeCollectionPTR node_collection, const std::vector< std::string >& keys );
 void set_nc_status( NodeCollectionPTR nc, std::vector< Dictionary >& params );
 
 void set_node_status( const size_t node_id, const Dictionary& dict );
 Dictionary get_node_status( const size_t node_id );
 
+/**
+ * Move the events recorded by a recording device out of the memory backend.
+ *
+ * @returns the events recorded by each thread-local instance of the device, in order of threads
+ */
+std::vector< std::shared_ptr< RecordedEvents > > drain_recorded_events( const size_t node_id );
+
 void set_connection_status( const std::deque< ConnectionID >& conns, const Dictionary& dict );
 void set_connection_status( const std::deque< ConnectionID >& conns, const std::vector< Dictionary >& dicts );
 std::vector< Dictionary > get_connection_status( const std::deque< ConnectionID >& conns );
 
+/**
+ * Read one property of all given connections into values, which must hold one entry per connection.
+ */
+void get_connection_status_column( const std::deque< ConnectionID >& conns, const std::string& key, double* values );
+void get_connection_status_column( const std::deque< ConnectionID >& conns, const std::string& key, long* values );
+
+/**
+ * Set one property of all given connections from values, which must hold one entry per connection.
+ */
+void
+set_connection_status_column( const std::deque< ConnectionID >& conns, const std::string& key, const double* values );
+void
+set_connection_status_column( const std::deque< ConnectionID >& conns, const std::string& key, const long* values );
+
 NodeCollectionPTR slice_nc( const NodeCollectionPTR nc, long start, long stop, long step );
 
 NodeCollectionPTR create( const std::string& model_name, const size_t n );
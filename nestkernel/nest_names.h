@@ -123,12 +123,14 @@ const std::string clear( "clear" );
 const std::string comp_idx( "comp_idx" );
 const std::string comparator( "comparator" );
 const std::string compartments( "compartments" );
+const std::string compressed_spike_data( "compressed_spike_data" );
 const std::string conc_Mg2( "conc_Mg2" );
 const std::string configbit_0( "configbit_0" );
 const std::string configbit_1( "configbit_1" );
 const std::string connection_count( "connection_count" );
 const std::string connection_rules( "connection_rules" );
 const std::string connection_type( "connection_type" );
+const std::string connections( "connections" );
 const std::string consistent_integration( "consistent_integration" );
 const std::string continuous( "continuous" );
 const std::string count_covariance( "count_covariance" );
@@ -314,6 +316,7 @@ const std::string kappa( "kappa" );
 const std::string kappa_reg( "kappa_reg" );
 const std::string keep_source_table( "keep_source_table" );
 const std::string kernel( "kernel" );
+const std::string kernel_cutoff( "kernel_cutoff" );
 
 const std::string label( "label" );
 const std::string lambda( "lambda" );
@@ -352,6 +355,7 @@ const std::string model( "model" );
 const std::string model_id( "model_id" );
 const std::string modules( "modules" );
 const std::string mpi_address( "mpi_address" );
+const std::string mpi_buffers( "mpi_buffers" );
 const std::string mpi_rank( "mpi_rank" );
 const std::string ms_per_tic( "ms_per_tic" );
 const std::string mu( "mu" );
@@ -377,13 +381,16 @@ const std::string new_buffer_size( "new_buffer_size" );
 const std::string next_readout_time( "next_readout_time" );
 const std::string no_synapses( "no_synapses" );
 const std::string node_models( "node_models" );
+const std::string node_placement( "node_placement" );
 const std::string node_uses_wfr( "node_uses_wfr" );
+const std::string nodes( "nodes" );
 const std::string noise( "noise" );
 const std::string noisy_rate( "noisy_rate" );
 const std::string num_connections( "num_connections" );
 const std::string num_processes( "num_processes" );
 const std::string number_of_connections( "number_of_connections" );
 
+const std::string off_grid_spike_data( "off_grid_spike_data" );
 const std::string off_grid_spiking( "off_grid_spiking" );
 const std::string offset( "offset" );
 const std::string offsets( "offsets" );
@@ -395,6 +402,7 @@ const std::string origin( "origin" );
 const std::string other( "other" );
 const std::string outdegree( "outdegree" );
 const std::string outer_radius( "outer_radius" );
+const std::string overlap_spike_communication( "overlap_spike_communication" );
 const std::string overwrite_files( "overwrite_files" );
 
 const std::string P( "P" );
@@ -470,6 +478,7 @@ const std::string requires_symmetric( "requires_symmetric" );
 const std::string reset_pattern( "reset_pattern" );
 const std::string resolution( "resolution" );
 const std::string rho( "rho" );
+const std::string ring_buffers( "ring_buffers" );
 const std::string rng_seed( "rng_seed" );
 const std::string rng_type( "rng_type" );
 const std::string rng_types( "rng_types" );
@@ -484,6 +493,7 @@ const std::string s_GABA( "s_GABA" );
 const std::string SIC_scale( "SIC_scale" );
 const std::string SIC_th( "SIC_th" );
 const std::string sdev( "sdev" );
+const std::string secondary_events( "secondary_events" );
 const std::string send_buffer_size_secondary_events( "send_buffer_size_secondary_events" );
 const std::string senders( "senders" );
 const std::string shape( "shape" );
@@ -495,18 +505,28 @@ const std::string sion_chunksize( "sion_chunksize" );
 const std::string sion_collective( "sion_collective" );
 const std::string sion_n_files( "sion_n_files" );
 const std::string size_of( "sizeof" );
+const std::string skip_sampling( "skip_sampling" );
 const std::string soma_curr( "soma_curr" );
 const std::string soma_exc( "soma_exc" );
 const std::string soma_inh( "soma_inh" );
+const std::string sort_connections_by_target( "sort_connections_by_target" );
 const std::string source( "source" );
+const std::string source_table( "source_table" );
+const std::string spatial_index_cache_budget( "spatial_index_cache_budget" );
+const std::string spatial_index_cache_hits( "spatial_index_cache_hits" );
+const std::string spatial_index_cache_memory( "spatial_index_cache_memory" );
+const std::string spatial_index_cache_misses( "spatial_index_cache_misses" );
 const std::string spherical( "spherical" );
 const std::string spike_buffer_grow_extra( "spike_buffer_grow_extra" );
 const std::string spike_buffer_resize_log( "spike_buffer_resize_log" );
 const std::string spike_buffer_shrink_limit( "spike_buffer_shrink_limit" );
 const std::string spike_buffer_shrink_spare( "spike_buffer_shrink_spare" );
+const std::string spike_data( "spike_data" );
 const std::string spike_dependent_threshold( "spike_dependent_threshold" );
 const std::string spike_multiplicities( "spike_multiplicities" );
 const std::string spike_times( "spike_times" );
+const std::string spike_train_file( "spike_train_file" );
+const std::string spike_train_sender( "spike_train_sender" );
 const std::string spike_weights( "spike_weights" );
 const std::string start( "start" );
 const std::string state( "state" );
@@ -544,7 +564,10 @@ const std::string t_ref_remaining( "t_ref_remaining" );
 const std::string t_ref_tot( "t_ref_tot" );
 const std::string t_spike( "t_spike" );
 const std::string target( "target" );
+const std::string target_data( "target_data" );
 const std::string target_signal( "target_signal" );
+const std::string target_table( "target_table" );
+const std::string target_table_devices( "target_table_devices" );
 const std::string target_thread( "target_thread" );
 const std::string targets( "targets" );
 const std::string tau( "tau" );
@@ -673,6 +696,7 @@ const std::string u_bar_bar( "u_bar_bar" );
 const std::string u_bar_minus( "u_bar_minus" );
 const std::string u_bar_plus( "u_bar_plus" );
 const std::string u_ref_squared( "u_ref_squared" );
+const std::string update_nodes_in_batches( "update_nodes_in_batches" );
 const std::string update_time_limit( "update_time_limit" );
 const std::string upper_right( "upper_right" );
 const std::string use_compressed_spikes( "use_compressed_spikes" );
@@ -712,6 +736,7 @@ const std::string weight_per_lut_entry( "weight_per_lut_entry" );
 const std::string weight_recorder( "weight_recorder" );
 const std::string weights( "weights" );
 const std::string wfr_comm_interval( "wfr_comm_interval" );
+const std::string wfr_incremental_exchange( "wfr_incremental_exchange" );
 const std::string wfr_interpolation_order( "wfr_interpolation_order" );
 const std::string wfr_max_iterations( "wfr_max_iterations" );
 const std::string wfr_tol( "wfr_tol" );
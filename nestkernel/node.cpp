@@ -496,7 +496,7 @@ Node::get_K_values( double, double&, double&, double& )
 }
 
 void
-nest::Node::get_history( double, double, std::deque< histentry >::iterator*, std::deque< histentry >::iterator* )
+nest::Node::get_history( double, double, HistoryBuffer< histentry >::iterator*, HistoryBuffer< histentry >::iterator* )
 {
   throw UnexpectedEvent();
 }
@@ -26,6 +26,7 @@
 // C++ includes:
 #include <bitset>
 #include <deque>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -36,6 +37,7 @@
 #include "deprecation_warning.h"
 #include "event.h"
 #include "histentry.h"
+#include "history_buffer.h"
 #include "nest_names.h"
 #include "nest_time.h"
 #include "nest_types.h"
@@ -52,6 +54,8 @@ class Model;
 class ArchivingNode;
 class TimeConverter;
 class WeightOptimizer;
+template < typename ElementT >
+class GenericModel;
 
 /**
  * @defgroup user_interface Model developer interface.
@@ -106,6 +110,33 @@ class Node
   Node& operator=( const Node& );  //!< not implemented
 
 public:
+  /**
+   * Whether nodes of this type can be updated in batches without virtual dispatch.
+   *
+   * Models setting this to true must make GenericModel a friend so that it can call
+   * their update() method directly, see GenericModel::update_nodes().
+   */
+  static constexpr bool supports_batched_update = false;
+
+  /**
+   * Whether nodes of this type keep their state in structure-of-arrays form while they are updated in batches.
+   *
+   * Models setting this to true must provide a class BatchState derived from NodeBatchState with a constructor
+   * taking a range of nodes and a static function supports() telling whether it can hold a given range, see
+   * GenericModel::create_batch_state().
+   */
+  static constexpr bool has_batch_state = false;
+
+  /**
+   * Whether connection checks for nodes of this type depend only on the models involved.
+   *
+   * If true, the outcome of send_test_event() and handles_test_event() for a combination of source model,
+   * target model, receptor type and synapse model is computed once per thread and reused for all further
+   * connections with this combination, see ConnectionCheckCache. Models whose send_test_event() or
+   * handles_test_event() depend on or modify the state of the node must set this to false.
+   */
+  static constexpr bool has_cacheable_connection_checks = true;
+
   Node();
   Node( Node const& );
   virtual ~Node();
@@ -345,6 +376,9 @@ public:
    */
   virtual void get_status( Dictionary& ) const = 0;
 
+  //! Function reading a floating point property from a node of the same model
+  typedef std::function< double( const Node& ) > DoublePropertyReader;
+
 public:
   /**
    * @defgroup event_interface Communication.
@@ -816,8 +850,8 @@ public:
    */
   virtual void get_history( double t1,
     double t2,
-    std::deque< histentry >::iterator* start,
-    std::deque< histentry >::iterator* finish );
+    HistoryBuffer< histentry >::iterator* start,
+    HistoryBuffer< histentry >::iterator* finish );
 
   // for Clopath synapse
   virtual void get_LTP_history( double t1,
@@ -0,0 +1,62 @@
+/*
+ *  node_batch_state.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef NODE_BATCH_STATE_H
+#define NODE_BATCH_STATE_H
+
+// Includes from nestkernel:
+#include "nest_time.h"
+
+namespace nest
+{
+
+/**
+ * State of the nodes of a NodeUpdateBatch, held in structure-of-arrays form during a run.
+ *
+ * Models that set Node::has_batch_state provide a class ElementT::BatchState derived from this one and
+ * constructible from a range of nodes. Each thread creates one instance per batch at the beginning of
+ * SimulationManager::update_(), unless ElementT::BatchState::supports() rejects the batch, which is then
+ * updated node by node. The constructor copies the state of all non-frozen nodes into contiguous
+ * per-thread arrays, update() advances all of them, and store() copies the state back into the nodes at
+ * the end of the run. Between runs, the nodes own their state, so that status access is not affected.
+ */
+class NodeBatchState
+{
+public:
+  virtual ~NodeBatchState() = default;
+
+  /**
+   * Update all nodes of the batch through the interval (origin+from, origin+to].
+   *
+   * @see Node::update()
+   */
+  virtual void update( Time const& origin, const long from, const long to ) = 0;
+
+  /**
+   * Write the state back into the nodes.
+   */
+  virtual void store() = 0;
+};
+
+}  // namespace nest
+
+#endif /* NODE_BATCH_STATE_H */
@@ -71,12 +71,20 @@ nc_const_iterator::nc_const_iterator( NodeCollectionPTR collection_ptr,
   , rank_or_vp_( kind == NCIteratorKind::RANK_LOCAL
         ? kernel().mpi_manager.get_rank()
         : ( kind == NCIteratorKind::THREAD_LOCAL ? kernel().vp_manager.get_vp() : invalid_thread ) )
+  , scan_for_local_( ( kind == NCIteratorKind::RANK_LOCAL or kind == NCIteratorKind::THREAD_LOCAL )
+      and not kernel().vp_manager.has_round_robin_placement() )
   , primitive_collection_( &collection )
   , composite_collection_( nullptr )
 {
   assert( not collection_ptr.get() or collection_ptr.get() == &collection );
   assert( element_idx_ <= collection.size() );  // allow == for end()
 
+  if ( scan_for_local_ )
+  {
+    step_ = stride;
+    advance_to_local_();
+  }
+
   FULL_LOGGING_ONLY(
     kernel().write_to_dump( String::compose( "NCIT Prim ctor rk %1, thr %2, pix %3, eix %4, step %5, kind %6, rvp %7",
       kernel().mpi_manager.get_rank(),
@@ -105,6 +113,8 @@ nc_const_iterator::nc_const_iterator( NodeCollectionPTR collection_ptr,
   , rank_or_vp_( kind == NCIteratorKind::RANK_LOCAL
         ? kernel().mpi_manager.get_rank()
         : ( kind == NCIteratorKind::THREAD_LOCAL ? kernel().vp_manager.get_vp() : invalid_thread ) )
+  , scan_for_local_( ( kind == NCIteratorKind::RANK_LOCAL or kind == NCIteratorKind::THREAD_LOCAL )
+      and not kernel().vp_manager.has_round_robin_placement() )
   , primitive_collection_( nullptr )
   , composite_collection_( &collection )
 {
@@ -113,6 +123,12 @@ nc_const_iterator::nc_const_iterator( NodeCollectionPTR collection_ptr,
   // Allow <= for end iterator
   assert( ( part < collection.parts_.size() and offset <= collection.parts_[ part ].size() ) );
 
+  if ( scan_for_local_ )
+  {
+    step_ = stride;
+    advance_to_local_();
+  }
+
   FULL_LOGGING_ONLY(
     kernel().write_to_dump( String::compose( "NCIT Comp ctor rk %1, thr %2, pix %3, eix %4, step %5, kind %6, rvp %7",
       kernel().mpi_manager.get_rank(),
@@ -265,6 +281,52 @@ nc_const_iterator::advance_local_iter_to_new_part_( size_t n )
   }
 }
 
+bool
+nc_const_iterator::is_end_() const
+{
+  if ( primitive_collection_ )
+  {
+    return element_idx_ >= primitive_collection_->size();
+  }
+  return part_idx_ == composite_collection_->last_part_ and element_idx_ == composite_collection_->last_elem_ + 1;
+}
+
+bool
+nc_const_iterator::is_local_() const
+{
+  const size_t node_id = ( **this ).node_id;
+  if ( kind_ == NCIteratorKind::RANK_LOCAL )
+  {
+    return kernel().mpi_manager.get_process_id_of_node_id( node_id ) == rank_or_vp_;
+  }
+  return kernel().vp_manager.node_id_to_vp( node_id ) == rank_or_vp_;
+}
+
+void
+nc_const_iterator::advance_global_by_one_()
+{
+  const auto new_element_idx = find_next_within_part_( 1 );
+  if ( primitive_collection_ or new_element_idx != element_idx_ )
+  {
+    element_idx_ = new_element_idx;
+  }
+  else
+  {
+    advance_global_iter_to_new_part_( 1 );
+  }
+}
+
+void
+nc_const_iterator::advance_to_local_()
+{
+  assert( scan_for_local_ );
+
+  while ( not is_end_() and not is_local_() )
+  {
+    advance_global_by_one_();
+  }
+}
+
 NodeIDTriple
 nc_const_iterator::operator*() const
 {
@@ -597,6 +659,12 @@ NodeCollectionPrimitive::operator+( NodeCollectionPTR rhs ) const
 NodeCollection::const_iterator
 NodeCollectionPrimitive::rank_local_begin( NodeCollectionPTR cp ) const
 {
+  if ( not kernel().vp_manager.has_round_robin_placement() )
+  {
+    // iterator moves to first local element itself
+    return const_iterator( cp, *this, 0, 1, nc_const_iterator::NCIteratorKind::RANK_LOCAL );
+  }
+
   const size_t num_processes = kernel().mpi_manager.get_num_processes();
   const size_t rank = kernel().mpi_manager.get_rank();
   const size_t first_elem_rank =
@@ -616,6 +684,12 @@ NodeCollectionPrimitive::rank_local_begin( NodeCollectionPTR cp ) const
 NodeCollection::const_iterator
 NodeCollectionPrimitive::thread_local_begin( NodeCollectionPTR cp ) const
 {
+  if ( not kernel().vp_manager.has_round_robin_placement() )
+  {
+    // iterator moves to first local element itself
+    return nc_const_iterator( cp, *this, 0, 1, nc_const_iterator::NCIteratorKind::THREAD_LOCAL );
+  }
+
   const size_t num_vps = kernel().vp_manager.get_num_virtual_processes();
   const size_t current_vp = kernel().vp_manager.thread_to_vp( kernel().vp_manager.get_thread_id() );
   const size_t vp_first_node = kernel().vp_manager.node_id_to_vp( first_ );
@@ -1143,6 +1217,13 @@ NodeCollectionComposite::gid_to_rank_( size_t gid )
 NodeCollection::const_iterator
 NodeCollectionComposite::rank_local_begin( NodeCollectionPTR cp ) const
 {
+  if ( not kernel().vp_manager.has_round_robin_placement() )
+  {
+    // iterator moves to first local element itself
+    return nc_const_iterator(
+      cp, *this, first_part_, first_elem_, stride_, nc_const_iterator::NCIteratorKind::RANK_LOCAL );
+  }
+
   const size_t num_ranks = kernel().mpi_manager.get_num_processes();
   const size_t current_rank = kernel().mpi_manager.get_rank();
 
@@ -1166,6 +1247,13 @@ NodeCollectionComposite::rank_local_begin( NodeCollectionPTR cp ) const
 NodeCollection::const_iterator
 NodeCollectionComposite::thread_local_begin( NodeCollectionPTR cp ) const
 {
+  if ( not kernel().vp_manager.has_round_robin_placement() )
+  {
+    // iterator moves to first local element itself
+    return nc_const_iterator(
+      cp, *this, first_part_, first_elem_, stride_, nc_const_iterator::NCIteratorKind::THREAD_LOCAL );
+  }
+
   const size_t num_vps = kernel().vp_manager.get_num_virtual_processes();
   const size_t current_vp = kernel().vp_manager.thread_to_vp( kernel().vp_manager.get_thread_id() );
 
@@ -410,6 +410,12 @@ public:
  *     c. Otherwise, set `element_idx_ = nc.first_in_part_[part_idx_]` and then find the first element
  *       after that local the current thread/rank using the same algorithm as for the local iterator intialization
  *   6. Set to the end() iterator if we did not find a valid solution.
+ *
+ * #### Local iterators without round-robin placement
+ *
+ * The phase adjustment above relies on nodes being placed round robin on VPs. If any nodes have been placed
+ * with a different policy (see `NodePlacement`), local iterators instead step like global iterators with
+ * `step_ = nc.stride_` and skip all elements that are not local to the rank/thread.
  */
 class nc_const_iterator
 {
@@ -433,6 +439,7 @@ private:
   size_t step_;                 //!< internal step also accounting for stepping over rank/thread
   const NCIteratorKind kind_;   //!< whether to iterate over all elements or rank/thread specific
   const size_t rank_or_vp_;     //!< rank or vp iterator is bound to
+  const bool scan_for_local_;   //!< local iterator testing each element, used if placement is not round robin
 
   //! Pointer to primitive collection to iterate over.  Zero if iterator is for composite collection.
   NodeCollectionPrimitive const* const primitive_collection_;
@@ -485,6 +492,18 @@ private:
    */
   void advance_local_iter_to_new_part_( size_t n );
 
+  //! Return true if iterator points to the end of the collection.
+  bool is_end_() const;
+
+  //! Return true if the element the iterator points to is local to rank_or_vp_.
+  bool is_local_() const;
+
+  //! Advance by one element as a global iterator.
+  void advance_global_by_one_();
+
+  //! Advance until the iterator points to a local element or the end, only used if scan_for_local_.
+  void advance_to_local_();
+
 public:
   using iterator_category = std::forward_iterator_tag;
   using difference_type = long;
@@ -514,7 +533,8 @@ public:
    * For thread- and rank-local iterators, this takes into account stepping over all VPs / ranks.
    * For stepped node collections, this takes also stepping into account. Thus if we have a
    * thread-local iterator in a simulation with 4 VPs and a node-collection step of 3, then the
-   * iterator's step is 12.
+   * iterator's step is 12. If nodes are not placed round robin, local iterators test each element
+   * and the step equals the node-collection step.
    */
   size_t get_step_size() const;
 };
@@ -1144,6 +1164,16 @@ nc_const_iterator::operator+=( const size_t n )
     return *this;
   }
 
+  if ( scan_for_local_ )
+  {
+    for ( size_t k = 0; k < n and not is_end_(); ++k )
+    {
+      advance_global_by_one_();
+      advance_to_local_();
+    }
+    return *this;
+  }
+
   const auto new_element_idx = find_next_within_part_( n );
 
   // For a primitive collection, we either have a new element or are at the end
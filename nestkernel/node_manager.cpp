@@ -24,7 +24,9 @@
 
 // C++ includes:
 #include <algorithm>
+#include <functional>
 #include <iomanip>
+#include <map>
 #include <set>
 
 // Includes from libnestutil:
@@ -50,6 +52,7 @@ NodeManager::NodeManager()
   , node_collection_container_()
   , wfr_nodes_vec_()
   , wfr_is_used_( false )
+  , update_batches_vec_()
   , size_last_local_data_update_( 0 )  // zero to force update
   , num_active_nodes_( 0 )
   , num_thread_local_devices_()
@@ -72,6 +75,9 @@ NodeManager::initialize( const bool adjust_number_of_threads_or_rng_only )
   size_last_local_data_update_ = 0;
   local_nodes_.resize( kernel().vp_manager.get_num_threads() );
   num_thread_local_devices_.resize( kernel().vp_manager.get_num_threads(), 0 );
+  // update_thread_local_node_data() returns early if there are no nodes, so drop batches of destructed nodes here
+  update_batches_vec_.clear();
+  update_batches_vec_.resize( kernel().vp_manager.get_num_threads() );
   update_thread_local_node_data();
 
   if ( not adjust_number_of_threads_or_rng_only )
@@ -99,6 +105,199 @@ NodeManager::get_status( size_t idx )
   return d;
 }
 
+Dictionary
+NodeManager::get_status_columns( NodeCollectionPTR nc, const std::vector< std::string >& keys )
+{
+  // properties that are read from the node without calling get_status()
+  const std::map< std::string, std::function< long( const Node& ) > > node_properties = {
+    { names::global_id, []( const Node& node ) { return static_cast< long >( node.get_node_id() ); } },
+    { names::model_id, []( const Node& node ) { return static_cast< long >( node.get_model_id() ); } },
+    { names::vp, []( const Node& node ) { return static_cast< long >( node.get_vp() ); } },
+    { names::thread, []( const Node& node ) { return static_cast< long >( node.get_thread() ); } },
+    { names::thread_local_id, []( const Node& node ) { return static_cast< long >( node.get_thread_lid() ); } }
+  };
+
+  // how the properties are read from the nodes of one model
+  struct ModelReaders
+  {
+    //! reader for each key, empty if the property is read from the status dictionary
+    std::vector< Node::DoublePropertyReader > readers;
+    //! whether any property has to be read from the status dictionary
+    bool needs_status = false;
+  };
+
+  // collect MPI-local nodes grouped by thread and resolve the type and reader of each property once per model
+  std::vector< Node* > nodes;
+  std::vector< const ModelReaders* > node_readers;
+  std::vector< std::vector< size_t > > indices_by_thread( kernel().vp_manager.get_num_threads() );
+  std::vector< bool > is_double( keys.size(), false );
+  std::map< size_t, ModelReaders > model_readers;
+  for ( const auto& node_triple : *nc )
+  {
+    Node* node = get_mpi_local_node_or_device_head( node_triple.node_id );
+    if ( node->is_proxy() )
+    {
+      continue;
+    }
+
+    // devices are represented by their instance on thread 0
+    indices_by_thread[ node->get_thread() ].push_back( nodes.size() );
+    nodes.push_back( node );
+
+    const auto [ model_it, is_new_model ] = model_readers.try_emplace( node->get_model_id() );
+    ModelReaders& model = model_it->second;
+    node_readers.push_back( &model );
+    if ( not is_new_model )
+    {
+      continue;
+    }
+
+    model.readers.resize( keys.size() );
+    const Model& node_model = *kernel().model_manager.get_node_model( node->get_model_id() );
+    Dictionary status;
+    bool have_status = false;
+    for ( size_t k = 0; k < keys.size(); ++k )
+    {
+      if ( node_properties.find( keys[ k ] ) != node_properties.end() )
+      {
+        continue;
+      }
+
+      // readers also exist for recordables that get_status() does not export, which must not be readable here
+      if ( not have_status )
+      {
+        status = node->get_status_base();
+        have_status = true;
+      }
+      if ( not status.known( keys[ k ] ) )
+      {
+        throw KeyError( keys[ k ], "node status", "get_status_columns" );
+      }
+
+      model.readers[ k ] = node_model.get_double_property_reader( keys[ k ] );
+      if ( model.readers[ k ] )
+      {
+        is_double[ k ] = true;
+        continue;
+      }
+
+      model.needs_status = true;
+      const auto& value = status.at( keys[ k ] );
+      if ( std::holds_alternative< double >( value ) )
+      {
+        is_double[ k ] = true;
+      }
+      else if ( not std::holds_alternative< long >( value ) )
+      {
+        throw TypeMismatch( "integer or double", get_typename( value ) );
+      }
+    }
+  }
+
+  std::vector< std::vector< long > > long_columns( keys.size() );
+  std::vector< std::vector< double > > double_columns( keys.size() );
+  for ( size_t k = 0; k < keys.size(); ++k )
+  {
+    if ( is_double[ k ] )
+    {
+      double_columns[ k ].resize( nodes.size() );
+    }
+    else
+    {
+      long_columns[ k ].resize( nodes.size() );
+    }
+  }
+
+  std::vector< std::exception_ptr > exceptions_raised( kernel().vp_manager.get_num_threads() );
+
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      // the dictionary is reused for all nodes, so that its entries are allocated only once per thread
+      Dictionary status;
+      for ( const size_t i : indices_by_thread[ tid ] )
+      {
+        const Node& node = *nodes[ i ];
+        const ModelReaders& model = *node_readers[ i ];
+
+        if ( model.needs_status )
+        {
+          node.get_status( status );
+        }
+
+        for ( size_t k = 0; k < keys.size(); ++k )
+        {
+          const auto node_property = node_properties.find( keys[ k ] );
+          if ( node_property != node_properties.end() )
+          {
+            const long value = node_property->second( node );
+            if ( is_double[ k ] )
+            {
+              double_columns[ k ][ i ] = value;
+            }
+            else
+            {
+              long_columns[ k ][ i ] = value;
+            }
+            continue;
+          }
+
+          if ( model.readers[ k ] )
+          {
+            double_columns[ k ][ i ] = model.readers[ k ]( node );
+            continue;
+          }
+
+          if ( not status.known( keys[ k ] ) )
+          {
+            throw KeyError( keys[ k ], "node status", "get_status_columns" );
+          }
+          const auto& value = status.at( keys[ k ] );
+          if ( is_double[ k ] )
+          {
+            double_columns[ k ][ i ] =
+              std::holds_alternative< long >( value ) ? std::get< long >( value ) : std::get< double >( value );
+          }
+          else
+          {
+            long_columns[ k ][ i ] = std::get< long >( value );
+          }
+        }
+      }
+    }
+    catch ( ... )
+    {
+      exceptions_raised.at( tid ) = std::current_exception();
+    }
+  }  // of omp parallel
+
+  for ( auto eptr : exceptions_raised )
+  {
+    if ( eptr )
+    {
+      std::rethrow_exception( eptr );
+    }
+  }
+
+  Dictionary result;
+  for ( size_t k = 0; k < keys.size(); ++k )
+  {
+    if ( is_double[ k ] )
+    {
+      result[ keys[ k ] ] = std::move( double_columns[ k ] );
+    }
+    else
+    {
+      result[ keys[ k ] ] = std::move( long_columns[ k ] );
+    }
+  }
+
+  return result;
+}
+
 NodeCollectionPTR
 NodeManager::add_node( size_t model_id, long n )
 {
@@ -127,6 +326,7 @@ NodeManager::add_node( size_t model_id, long n )
   }
 
   kernel().modelrange_manager.add_range( model_id, min_node_id, max_node_id );
+  kernel().vp_manager.add_node_range( min_node_id, max_node_id, model->has_proxies() );
 
   // clear any exceptions from previous call
   std::vector< std::exception_ptr >( kernel().vp_manager.get_num_threads() ).swap( exceptions_raised_ );
@@ -200,15 +400,13 @@ NodeManager::add_neurons_( Model& model, size_t min_node_id, size_t max_node_id
     try
     {
       model.reserve_additional( tid, max_new_per_thread );
-      // Need to find smallest node ID with:
-      //   - node ID local to this vp
-      //   - node_id >= min_node_id
+      // Node IDs placed on this vp, as given by the node placement policy
       const size_t vp = kernel().vp_manager.thread_to_vp( tid );
-      const size_t min_node_id_vp = kernel().vp_manager.node_id_to_vp( min_node_id );
+      const VPNodeIDs vp_node_ids = kernel().vp_manager.get_node_ids_on_vp( min_node_id, max_node_id, vp );
 
-      size_t node_id = min_node_id + ( num_vps + vp - min_node_id_vp ) % num_vps;
+      size_t node_id = vp_node_ids.first;
 
-      while ( node_id <= max_node_id )
+      while ( node_id <= vp_node_ids.last )
       {
         Node* node = model.create( tid );
         node->set_node_id_( node_id );
@@ -218,7 +416,7 @@ NodeManager::add_neurons_( Model& model, size_t min_node_id, size_t max_node_id
         node->set_initialized();
 
         local_nodes_[ tid ].add_local_node( *node );
-        node_id += num_vps;
+        node_id += vp_node_ids.step;
       }
       local_nodes_[ tid ].set_max_node_id( max_node_id );
     }
@@ -415,8 +613,7 @@ NodeManager::is_local_node_id( size_t node_id ) const
 size_t
 NodeManager::get_max_num_local_nodes() const
 {
-  return static_cast< size_t >(
-    ceil( static_cast< double >( size() ) / kernel().vp_manager.get_num_virtual_processes() ) );
+  return kernel().vp_manager.get_max_num_nodes_per_vp( size() );
 }
 
 size_t
@@ -480,6 +677,12 @@ NodeManager::get_mpi_local_node_or_device_head( size_t node_id )
   return node;
 }
 
+bool
+NodeManager::node_has_proxies( size_t node_id ) const
+{
+  return kernel().model_manager.get_node_model( kernel().modelrange_manager.get_model_id( node_id ) )->has_proxies();
+}
+
 std::vector< Node* >
 NodeManager::get_thread_siblings( size_t node_id ) const
 {
@@ -509,9 +712,11 @@ NodeManager::update_thread_local_node_data()
     return;
   }
 
-  // We clear the existing wfr_nodes_vec_ and then rebuild it.
+  // We clear the existing wfr_nodes_vec_ and update_batches_vec_ and then rebuild them.
   wfr_nodes_vec_.clear();
   wfr_nodes_vec_.resize( kernel().vp_manager.get_num_threads() );
+  update_batches_vec_.clear();
+  update_batches_vec_.resize( kernel().vp_manager.get_num_threads() );
 
   for ( size_t tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
   {
@@ -532,6 +737,13 @@ NodeManager::update_thread_local_node_data()
       {
         wfr_nodes_vec_[ tid ].push_back( node );
       }
+
+      Model* model = kernel().model_manager.get_node_model( node->get_model_id() );
+      if ( update_batches_vec_[ tid ].empty() or update_batches_vec_[ tid ].back().model != model )
+      {
+        update_batches_vec_[ tid ].push_back( { model, {} } );
+      }
+      update_batches_vec_[ tid ].back().nodes.push_back( node );
     }
   }  // end of for threads
 
@@ -750,6 +962,21 @@ NodeManager::get_status( Dictionary& d )
   sw_construction_create_.get_status( d, names::time_construction_create, names::time_construction_create_cpu );
 }
 
+void
+NodeManager::get_memory_report( Dictionary& d ) const
+{
+  size_t ring_buffers = 0;
+  for ( const auto& nodes : local_nodes_ )
+  {
+    for ( const auto& node : nodes )
+    {
+      const Node* const n = node.get_node();
+      ring_buffers += kernel().model_manager.get_node_model( n->get_model_id() )->get_ring_buffer_memory( *n );
+    }
+  }
+  d[ names::ring_buffers ] = static_cast< long >( ring_buffers );
+}
+
 void
 NodeManager::set_status( const Dictionary& )
 {
@@ -43,6 +43,20 @@ namespace nest
 class Node;
 class Model;
 
+/**
+ * Run of consecutive thread-local nodes created by the same model.
+ *
+ * All nodes in a batch are updated by a single call to Model::update_nodes(), which avoids the virtual call per
+ * node for models with Node::supports_batched_update. Models with Node::has_batch_state instead hold the state
+ * of the batch in arrays during a run, see NodeBatchState. Batching is switched on with the kernel attribute
+ * update_nodes_in_batches.
+ */
+struct NodeUpdateBatch
+{
+  Model* model;                //!< model that created all nodes in the batch
+  std::vector< Node* > nodes;  //!< nodes in order of increasing node ID
+};
+
 class NodeManager : public ManagerInterface
 {
 public:
@@ -54,6 +68,12 @@ public:
   void set_status( const Dictionary& ) override;
   void get_status( Dictionary& ) override;
 
+  /**
+   * Add the memory held by the ring buffers of all local nodes to the given
+   * dictionary, in bytes. The sizes are collected from the nodes on each call.
+   */
+  void get_memory_report( Dictionary& ) const;
+
   /**
    * Get properties of a node.
    *
@@ -62,6 +82,28 @@ public:
    */
   Dictionary get_status( size_t );
 
+  /**
+   * Get selected properties of all nodes in a node collection that are
+   * local to this MPI process.
+   *
+   * The result contains one entry per key. Each entry is a
+   * std::vector< long > or std::vector< double >, with values in the
+   * order of the node collection. The type of each property is resolved
+   * once per model, and the column is double if any model provides it as
+   * double. The properties global_id, model_id, vp, thread and
+   * thread_local_id are read from the nodes directly, as are properties
+   * for which the model provides a reader through
+   * Model::get_double_property_reader(). Only for the remaining properties,
+   * each thread calls Node::get_status() for its own nodes, reusing one
+   * dictionary for all of them. As for get_status(), only properties in the
+   * status dictionary of the model can be read, so recordables that the
+   * model does not export there are rejected.
+   *
+   * @throws KeyError if a local node does not have one of the properties
+   * @throws TypeMismatch if a property is neither integer nor floating point
+   */
+  Dictionary get_status_columns( NodeCollectionPTR nc, const std::vector< std::string >& keys );
+
   /**
    * Set properties of a Node.
    *
@@ -161,6 +203,15 @@ public:
    */
   Node* get_mpi_local_node_or_device_head( size_t );
 
+  /**
+   * Return true if nodes of the model of the given node have proxies.
+   *
+   * Nodes without proxies, i.e., devices, exist on every thread of every
+   * rank. Unlike the get_node_or_proxy() functions, this does not touch the
+   * shared proxy nodes and may thus be called from any thread.
+   */
+  bool node_has_proxies( size_t node_id ) const;
+
   /**
    * Return a vector that contains the thread siblings.
    *
@@ -172,7 +223,8 @@ public:
   std::vector< Node* > get_thread_siblings( size_t n ) const;
 
   /**
-   * Rebuild per-thread vectors of local nodes and of local nodes needing WFR and set thread-local ID on nodes.
+   * Rebuild per-thread vectors of local nodes, of local nodes needing WFR and of update batches and set thread-local ID
+   * on nodes.
    *
    * @note This method must be called from a serial context before connection creation or simulation.
    */
@@ -196,6 +248,11 @@ public:
    */
   const std::vector< Node* >& get_wfr_nodes_on_thread( size_t ) const;
 
+  /**
+   * Get thread-local nodes of given thread grouped into runs of nodes of the same model.
+   */
+  const std::vector< NodeUpdateBatch >& get_update_batches_on_thread( size_t ) const;
+
   /**
    * Prepare nodes for simulation and register nodes in node_list.
    *
@@ -351,6 +408,8 @@ private:
   bool wfr_is_used_;                                   //!< there is at least one node that uses
                                                        //!< waveform relaxation
 
+  std::vector< std::vector< NodeUpdateBatch > > update_batches_vec_;  //!< thread-local nodes grouped by model
+
   size_t size_last_local_data_update_;  //! Network size when local node data was last updated
   size_t num_active_nodes_;             //!< number of nodes created by prepare_nodes
 
@@ -408,6 +467,12 @@ NodeManager::set_have_nodes_changed( const bool changed )
   have_nodes_changed_ = changed;
 }
 
+inline const std::vector< NodeUpdateBatch >&
+NodeManager::get_update_batches_on_thread( size_t t ) const
+{
+  return update_batches_vec_.at( t );
+}
+
 inline bool
 NodeManager::thread_local_data_is_up_to_date() const
 {
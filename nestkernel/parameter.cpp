@@ -20,7 +20,9 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "node.h"
 #include "node_collection.h"
@@ -33,6 +35,46 @@
 namespace nest
 {
 
+namespace
+{
+
+/**
+ * @returns true if the parameter is the Euclidean distance between source and target.
+ */
+bool
+is_euclidean_distance( const ParameterPTR& p )
+{
+  const auto* distance = dynamic_cast< const SpatialDistanceParameter* >( p.get() );
+  return distance and distance->is_euclidean();
+}
+
+}  // namespace
+
+void
+Parameter::values( RngPtr rng,
+  const std::vector< double >& source_positions,
+  const std::vector< double >& target_pos,
+  const AbstractLayer& layer,
+  Node* node,
+  std::vector< double >& result )
+{
+  const size_t num_dimensions = target_pos.size();
+  result.resize( source_positions.size() / num_dimensions );
+
+  std::vector< double > source_pos( num_dimensions );
+  for ( size_t i = 0; i < result.size(); ++i )
+  {
+    std::copy_n( source_positions.begin() + i * num_dimensions, num_dimensions, source_pos.begin() );
+    result[ i ] = value( rng, source_pos, target_pos, layer, node );
+  }
+}
+
+double
+Parameter::get_cutoff_distance( double ) const
+{
+  return std::numeric_limits< double >::infinity();
+}
+
 std::vector< double >
 Parameter::apply( const NodeCollectionPTR& nc, const std::vector< std::vector< double > >& positions )
 {
@@ -77,8 +119,70 @@ Parameter::apply( const NodeCollectionPTR& nc, const std::vector< std::vector< d
   return result;
 }
 
+double
+ConstantParameter::get_cutoff_distance( double threshold ) const
+{
+  return value_ <= threshold ? 0.0 : std::numeric_limits< double >::infinity();
+}
+
+double
+ProductParameter::get_cutoff_distance( double threshold ) const
+{
+  // Scaling by a positive constant scales the threshold
+  double cutoff = std::numeric_limits< double >::infinity();
+  const auto* const c1 = dynamic_cast< const ConstantParameter* >( parameter1_.get() );
+  const auto* const c2 = dynamic_cast< const ConstantParameter* >( parameter2_.get() );
+  if ( c1 and c1->get_value() > 0 )
+  {
+    cutoff = std::min( cutoff, parameter2_->get_cutoff_distance( threshold / c1->get_value() ) );
+  }
+  if ( c2 and c2->get_value() > 0 )
+  {
+    cutoff = std::min( cutoff, parameter1_->get_cutoff_distance( threshold / c2->get_value() ) );
+  }
+  return cutoff;
+}
+
+double
+ComparingParameter::get_cutoff_distance( double threshold ) const
+{
+  if ( threshold >= 1 )
+  {
+    return 0.0;
+  }
+  if ( threshold < 0 )
+  {
+    return std::numeric_limits< double >::infinity();
+  }
+
+  // The comparison is false beyond c for distance < c, distance <= c, c > distance and c >= distance
+  const auto* const c1 = dynamic_cast< const ConstantParameter* >( parameter1_.get() );
+  const auto* const c2 = dynamic_cast< const ConstantParameter* >( parameter2_.get() );
+  if ( is_euclidean_distance( parameter1_ ) and c2 and ( comparator_ == 0 or comparator_ == 1 ) )
+  {
+    return std::max( c2->get_value(), 0.0 );
+  }
+  if ( c1 and is_euclidean_distance( parameter2_ ) and ( comparator_ == 4 or comparator_ == 5 ) )
+  {
+    return std::max( c1->get_value(), 0.0 );
+  }
+  return std::numeric_limits< double >::infinity();
+}
+
+double
+ConditionalParameter::get_cutoff_distance( double threshold ) const
+{
+  // Beyond the cutoff of a comparison only the false branch is taken
+  const double condition_cutoff = dynamic_cast< const ComparingParameter* >( condition_.get() )
+    ? condition_->get_cutoff_distance( 0.0 )
+    : std::numeric_limits< double >::infinity();
+  return std::max( if_false_->get_cutoff_distance( threshold ),
+    std::min( condition_cutoff, if_true_->get_cutoff_distance( threshold ) ) );
+}
+
 NormalParameter::NormalParameter( const Dictionary& d )
-  : mean_( 0.0 )
+  : Parameter( false, false, true )
+  , mean_( 0.0 )
   , std_( 1.0 )
 {
   d.update_value( names::mean, mean_ );
@@ -118,7 +222,8 @@ NormalParameter::value( RngPtr rng, Node* node )
 
 
 LognormalParameter::LognormalParameter( const Dictionary& d )
-  : mean_( 0.0 )
+  : Parameter( false, false, true )
+  , mean_( 0.0 )
   , std_( 1.0 )
 {
   d.update_value( names::mean, mean_ );
@@ -227,8 +332,47 @@ SpatialDistanceParameter::value( RngPtr,
   }
 }
 
+void
+SpatialDistanceParameter::values( RngPtr,
+  const std::vector< double >& source_positions,
+  const std::vector< double >& target_pos,
+  const AbstractLayer& layer,
+  Node*,
+  std::vector< double >& result )
+{
+  switch ( dimension_ )
+  {
+  case 0:
+  {
+    layer.compute_distances( source_positions, target_pos, result );
+    return;
+  }
+  case 1:
+  case 2:
+  case 3:
+    if ( ( unsigned int ) dimension_ > layer.get_num_dimensions() )
+    {
+      throw KernelException(
+        "Spatial distance dimension must be within the defined number of "
+        "dimensions for the nodes." );
+    }
+    layer.compute_displacements( source_positions, target_pos, dimension_ - 1, result );
+    for ( auto& displacement : result )
+    {
+      displacement = std::abs( displacement );
+    }
+    return;
+  default:
+    throw KernelException(
+      String::compose( "SpatialDistanceParameter dimension must be either 0 for unspecified,"
+                       " or 1-3 for x-z. Got ",
+        dimension_ ) );
+    break;
+  }
+}
+
 RedrawParameter::RedrawParameter( const ParameterPTR p, const double min, const double max )
-  : Parameter( p->is_spatial() )
+  : Parameter( p->is_spatial(), false, p->is_random() )
   , p_( p )
   , min_( min )
   , max_( max )
@@ -292,6 +436,7 @@ ExpDistParameter::ExpDistParameter( const Dictionary& d )
   {
     throw BadProperty( "beta > 0 required for exponential distribution parameter, got beta=" + std::to_string( beta ) );
   }
+  is_random_ = p_->is_random();
 }
 
 double
@@ -304,6 +449,35 @@ ExpDistParameter::value( RngPtr rng,
   return std::exp( -p_->value( rng, source_pos, target_pos, layer, node ) * inv_beta_ );
 }
 
+void
+ExpDistParameter::values( RngPtr rng,
+  const std::vector< double >& source_positions,
+  const std::vector< double >& target_pos,
+  const AbstractLayer& layer,
+  Node* node,
+  std::vector< double >& result )
+{
+  p_->values( rng, source_positions, target_pos, layer, node, result );
+  for ( auto& v : result )
+  {
+    v = std::exp( -v * inv_beta_ );
+  }
+}
+
+double
+ExpDistParameter::get_cutoff_distance( double threshold ) const
+{
+  if ( threshold >= 1 )
+  {
+    return 0.0;
+  }
+  if ( threshold <= 0 or not is_euclidean_distance( p_ ) )
+  {
+    return std::numeric_limits< double >::infinity();
+  }
+  return -std::log( threshold ) / inv_beta_;
+}
+
 GaussianParameter::GaussianParameter( const Dictionary& d )
   : Parameter( true )
   , p_( d.get< ParameterPTR >( "x" ) )
@@ -315,6 +489,7 @@ GaussianParameter::GaussianParameter( const Dictionary& d )
   {
     throw BadProperty( "std > 0 required for gaussian distribution parameter, got std=" + std::to_string( std ) );
   }
+  is_random_ = p_->is_random();
 }
 
 double
@@ -328,6 +503,37 @@ GaussianParameter::value( RngPtr rng,
   return std::exp( -dx * dx * inv_two_std2_ );
 }
 
+void
+GaussianParameter::values( RngPtr rng,
+  const std::vector< double >& source_positions,
+  const std::vector< double >& target_pos,
+  const AbstractLayer& layer,
+  Node* node,
+  std::vector< double >& result )
+{
+  p_->values( rng, source_positions, target_pos, layer, node, result );
+  for ( auto& v : result )
+  {
+    const auto dx = v - mean_;
+    v = std::exp( -dx * dx * inv_two_std2_ );
+  }
+}
+
+double
+GaussianParameter::get_cutoff_distance( double threshold ) const
+{
+  if ( threshold >= 1 )
+  {
+    return 0.0;
+  }
+  if ( threshold <= 0 or not is_euclidean_distance( p_ ) )
+  {
+    return std::numeric_limits< double >::infinity();
+  }
+  // The kernel decays monotonically for distances larger than the mean
+  return std::max( mean_ + std::sqrt( -std::log( threshold ) / inv_two_std2_ ), 0.0 );
+}
+
 
 Gaussian2DParameter::Gaussian2DParameter( const Dictionary& d )
   : Parameter( true )
@@ -363,6 +569,7 @@ Gaussian2DParameter::Gaussian2DParameter( const Dictionary& d )
     throw BadProperty(
       "std_y > 0 required for gaussian2d distribution parameter, got std_y=" + std::to_string( std_y ) );
   }
+  is_random_ = px_->is_random() or py_->is_random();
 }
 
 double
@@ -377,6 +584,25 @@ Gaussian2DParameter::value( RngPtr rng,
   return std::exp( -dx * dx * x_term_const_ - dy * dy * y_term_const_ + dx * dy * xy_term_const_ );
 }
 
+void
+Gaussian2DParameter::values( RngPtr rng,
+  const std::vector< double >& source_positions,
+  const std::vector< double >& target_pos,
+  const AbstractLayer& layer,
+  Node* node,
+  std::vector< double >& result )
+{
+  std::vector< double > values_y;
+  px_->values( rng, source_positions, target_pos, layer, node, result );
+  py_->values( rng, source_positions, target_pos, layer, node, values_y );
+  for ( size_t i = 0; i < result.size(); ++i )
+  {
+    const auto dx = result[ i ] - mean_x_;
+    const auto dy = values_y[ i ] - mean_y_;
+    result[ i ] = std::exp( -dx * dx * x_term_const_ - dy * dy * y_term_const_ + dx * dy * xy_term_const_ );
+  }
+}
+
 
 GaborParameter::GaborParameter( const Dictionary& d )
   : Parameter( true )
@@ -399,6 +625,7 @@ GaborParameter::GaborParameter( const Dictionary& d )
   {
     throw BadProperty( String::compose( "gamma > 0 required for gabor function parameter, got gamma=%1", gamma ) );
   }
+  is_random_ = px_->is_random() or py_->is_random();
 }
 
 double
@@ -421,6 +648,31 @@ GaborParameter::value( RngPtr rng,
   return gabor_res;
 }
 
+void
+GaborParameter::values( RngPtr rng,
+  const std::vector< double >& source_positions,
+  const std::vector< double >& target_pos,
+  const AbstractLayer& layer,
+  Node* node,
+  std::vector< double >& result )
+{
+  std::vector< double > values_y;
+  px_->values( rng, source_positions, target_pos, layer, node, result );
+  py_->values( rng, source_positions, target_pos, layer, node, values_y );
+  for ( size_t i = 0; i < result.size(); ++i )
+  {
+    const auto dx = result[ i ];
+    const auto dy = values_y[ i ];
+    const auto dx_prime = dx * cos_ + dy * sin_;
+    const auto dy_prime = -dx * sin_ + dy * cos_;
+    const auto gabor_exp =
+      std::exp( -gamma_ * gamma_ * dx_prime * dx_prime * inv_two_std2_ - dy_prime * dy_prime * inv_two_std2_ );
+    const auto gabor_cos_plus =
+      std::max( std::cos( 2 * numerics::pi * dy_prime / lambda_ + psi_ * numerics::pi / 180. ), 0. );
+    result[ i ] = gabor_exp * gabor_cos_plus;
+  }
+}
+
 
 GammaParameter::GammaParameter( const Dictionary& d )
   : Parameter( true )
@@ -438,6 +690,7 @@ GammaParameter::GammaParameter( const Dictionary& d )
   {
     throw BadProperty( "theta > 0 required for gamma distribution parameter, got theta=" + std::to_string( theta ) );
   }
+  is_random_ = p_->is_random();
 }
 
 double
@@ -451,6 +704,21 @@ GammaParameter::value( RngPtr rng,
   return std::pow( x, kappa_ - 1. ) * std::exp( -1. * inv_theta_ * x ) * delta_;
 }
 
+void
+GammaParameter::values( RngPtr rng,
+  const std::vector< double >& source_positions,
+  const std::vector< double >& target_pos,
+  const AbstractLayer& layer,
+  Node* node,
+  std::vector< double >& result )
+{
+  p_->values( rng, source_positions, target_pos, layer, node, result );
+  for ( auto& x : result )
+  {
+    x = std::pow( x, kappa_ - 1. ) * std::exp( -1. * inv_theta_ * x ) * delta_;
+  }
+}
+
 
 ParameterPTR
 multiply_parameter( const ParameterPTR first, const ParameterPTR second )
@@ -24,6 +24,7 @@
 #define PARAMETER_H_
 
 // C++ includes:
+#include <algorithm>
 #include <cmath>
 
 // Includes from nestkernel:
@@ -52,10 +53,12 @@ public:
    *
    * @param is_spatial true if the Parameter contains spatial elements
    * @param returns_int_only true if the value of the parameter can only be an integer
+   * @param is_random true if generating a value draws random numbers
    */
-  Parameter( bool is_spatial = false, bool returns_int_only = false )
+  Parameter( bool is_spatial = false, bool returns_int_only = false, bool is_random = false )
     : is_spatial_( is_spatial )
     , returns_int_only_( returns_int_only )
+    , is_random_( is_random )
   {
   }
 
@@ -98,6 +101,48 @@ public:
     const AbstractLayer& layer,
     Node* node );
 
+  /**
+   * Generates values for a batch of source positions and a single target position.
+   *
+   * Used when connecting spatial nodes. The source positions are stored
+   * contiguously, one position of target_pos.size() coordinates after the
+   * other, and one value per source position is written to result. The
+   * default implementation calls value() for each source position, while
+   * the arithmetic and spatial parameters evaluate their subexpressions
+   * over the whole batch, so that each node of the expression tree is
+   * visited once per batch instead of once per node pair.
+   *
+   * Random parameters draw all numbers for one node of the expression
+   * tree before moving on to the next, so the sequence of random numbers
+   * used may differ from calling value() for each source position.
+   *
+   * @param rng pointer to the random number generator
+   * @param source_positions positions of the source nodes
+   * @param target_pos position of the target node
+   * @param layer spatial layer
+   * @param node target node, required for normal and lognormal parameters
+   * @param result array to which the values are written, resized to the batch size
+   */
+  virtual void values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result );
+
+  /**
+   * Returns a distance beyond which the parameter does not exceed the given threshold.
+   *
+   * Used to restrict spatial connection kernels to a ball around the
+   * target node. The bound refers to the Euclidean distance between source
+   * and target as computed by the layer. Parameters for which no such bound
+   * is known return infinity, which is the default.
+   *
+   * @param threshold value which the parameter must not exceed beyond the distance
+   * @returns the distance, or infinity if no bound is known.
+   */
+  virtual double get_cutoff_distance( double threshold ) const;
+
   /**
    * Applies a parameter on a single-node ID NodeCollection and given array of positions.
    * @returns array of result values, one per position in the vector.
@@ -118,9 +163,17 @@ public:
    */
   bool returns_int_only() const;
 
+  /**
+   * Check if generating a value of the Parameter draws random numbers.
+   *
+   * @returns true if the Parameter depends on random numbers, false otherwise.
+   */
+  bool is_random() const;
+
 protected:
   bool is_spatial_ { false };
   bool returns_int_only_ { false };
+  bool is_random_ { false };
 
   bool value_is_integer_( const double value ) const;
 };
@@ -169,6 +222,28 @@ public:
     return value_;
   }
 
+  void
+  values( RngPtr,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer&,
+    Node*,
+    std::vector< double >& result ) override
+  {
+    result.assign( source_positions.size() / target_pos.size(), value_ );
+  }
+
+  double get_cutoff_distance( double threshold ) const override;
+
+  /**
+   * @returns the constant value of this parameter.
+   */
+  double
+  get_value() const
+  {
+    return value_;
+  }
+
 private:
   double value_;
 };
@@ -192,7 +267,8 @@ public:
    * max - maximum value
    */
   UniformParameter( const Dictionary& d )
-    : lower_( 0.0 )
+    : Parameter( false, false, true )
+    , lower_( 0.0 )
     , range_( 1.0 )
   {
     d.update_value( names::min, lower_ );
@@ -213,6 +289,21 @@ public:
     return lower_ + rng->drand() * range_;
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer&,
+    Node*,
+    std::vector< double >& result ) override
+  {
+    result.resize( source_positions.size() / target_pos.size() );
+    for ( auto& v : result )
+    {
+      v = lower_ + rng->drand() * range_;
+    }
+  }
+
 private:
   double lower_, range_;
 };
@@ -234,7 +325,7 @@ public:
    * max - maximum value
    */
   UniformIntParameter( const Dictionary& d )
-    : Parameter( false, true )
+    : Parameter( false, true, true )
     , max_( 1 )
   {
     d.update_integer_value( names::max, max_ );
@@ -326,7 +417,8 @@ public:
    * beta - the scale parameter
    */
   ExponentialParameter( const Dictionary& d )
-    : beta_( 1.0 )
+    : Parameter( false, false, true )
+    , beta_( 1.0 )
   {
     d.update_value( names::beta, beta_ );
     if ( beta_ < 0 )
@@ -420,6 +512,33 @@ public:
     throw KernelException( "Wrong synaptic_endpoint_." );
   }
 
+  void
+  values( RngPtr,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer&,
+    Node*,
+    std::vector< double >& result ) override
+  {
+    const size_t num_dimensions = target_pos.size();
+    result.resize( source_positions.size() / num_dimensions );
+    switch ( synaptic_endpoint_ )
+    {
+    case 0:
+      throw BadParameterValue( "Node position parameter cannot be used when connecting." );
+    case 1:
+      for ( size_t i = 0; i < result.size(); ++i )
+      {
+        result[ i ] = source_positions[ i * num_dimensions + dimension_ ];
+      }
+      return;
+    case 2:
+      std::fill( result.begin(), result.end(), target_pos[ dimension_ ] );
+      return;
+    }
+    throw KernelException( "Wrong synaptic_endpoint_." );
+  }
+
 private:
   long dimension_;
   int synaptic_endpoint_;
@@ -457,6 +576,22 @@ public:
     const AbstractLayer& layer,
     Node* ) override;
 
+  void values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override;
+
+  /**
+   * @returns true if the parameter represents the Euclidean distance between the nodes.
+   */
+  bool
+  is_euclidean() const
+  {
+    return dimension_ == 0;
+  }
+
 private:
   int dimension_;
 };
@@ -474,7 +609,9 @@ public:
    * Copies are made of the supplied Parameter objects.
    */
   ProductParameter( const ParameterPTR m1, const ParameterPTR m2 )
-    : Parameter( m1->is_spatial() or m2->is_spatial(), m1->returns_int_only() and m2->returns_int_only() )
+    : Parameter( m1->is_spatial() or m2->is_spatial(),
+        m1->returns_int_only() and m2->returns_int_only(),
+        m1->is_random() or m2->is_random() )
     , parameter1_( m1 )
     , parameter2_( m2 )
   {
@@ -507,6 +644,25 @@ public:
       * parameter2_->value( rng, source_pos, target_pos, layer, node );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    std::vector< double > values2;
+    parameter1_->values( rng, source_positions, target_pos, layer, node, result );
+    parameter2_->values( rng, source_positions, target_pos, layer, node, values2 );
+    for ( size_t i = 0; i < result.size(); ++i )
+    {
+      result[ i ] *= values2[ i ];
+    }
+  }
+
+  double get_cutoff_distance( double threshold ) const override;
+
 protected:
   ParameterPTR const parameter1_;
   ParameterPTR const parameter2_;
@@ -524,7 +680,9 @@ public:
    * Copies are made of the supplied Parameter objects.
    */
   QuotientParameter( ParameterPTR m1, ParameterPTR m2 )
-    : Parameter( m1->is_spatial() or m2->is_spatial(), m1->returns_int_only() and m2->returns_int_only() )
+    : Parameter( m1->is_spatial() or m2->is_spatial(),
+        m1->returns_int_only() and m2->returns_int_only(),
+        m1->is_random() or m2->is_random() )
     , parameter1_( m1 )
     , parameter2_( m2 )
   {
@@ -557,6 +715,23 @@ public:
       / parameter2_->value( rng, source_pos, target_pos, layer, node );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    std::vector< double > values2;
+    parameter1_->values( rng, source_positions, target_pos, layer, node, result );
+    parameter2_->values( rng, source_positions, target_pos, layer, node, values2 );
+    for ( size_t i = 0; i < result.size(); ++i )
+    {
+      result[ i ] /= values2[ i ];
+    }
+  }
+
 protected:
   ParameterPTR const parameter1_;
   ParameterPTR const parameter2_;
@@ -574,7 +749,9 @@ public:
    * Copies are made of the supplied Parameter objects.
    */
   SumParameter( ParameterPTR m1, ParameterPTR m2 )
-    : Parameter( m1->is_spatial() or m2->is_spatial(), m1->returns_int_only() and m2->returns_int_only() )
+    : Parameter( m1->is_spatial() or m2->is_spatial(),
+        m1->returns_int_only() and m2->returns_int_only(),
+        m1->is_random() or m2->is_random() )
     , parameter1_( m1 )
     , parameter2_( m2 )
   {
@@ -607,6 +784,23 @@ public:
       + parameter2_->value( rng, source_pos, target_pos, layer, node );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    std::vector< double > values2;
+    parameter1_->values( rng, source_positions, target_pos, layer, node, result );
+    parameter2_->values( rng, source_positions, target_pos, layer, node, values2 );
+    for ( size_t i = 0; i < result.size(); ++i )
+    {
+      result[ i ] += values2[ i ];
+    }
+  }
+
 protected:
   ParameterPTR const parameter1_;
   ParameterPTR const parameter2_;
@@ -624,7 +818,9 @@ public:
    * Copies are made of the supplied Parameter objects.
    */
   DifferenceParameter( ParameterPTR m1, ParameterPTR m2 )
-    : Parameter( m1->is_spatial() or m2->is_spatial(), m1->returns_int_only() and m2->returns_int_only() )
+    : Parameter( m1->is_spatial() or m2->is_spatial(),
+        m1->returns_int_only() and m2->returns_int_only(),
+        m1->is_random() or m2->is_random() )
     , parameter1_( m1 )
     , parameter2_( m2 )
   {
@@ -657,6 +853,23 @@ public:
       - parameter2_->value( rng, source_pos, target_pos, layer, node );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    std::vector< double > values2;
+    parameter1_->values( rng, source_positions, target_pos, layer, node, result );
+    parameter2_->values( rng, source_positions, target_pos, layer, node, values2 );
+    for ( size_t i = 0; i < result.size(); ++i )
+    {
+      result[ i ] -= values2[ i ];
+    }
+  }
+
 protected:
   ParameterPTR const parameter1_;
   ParameterPTR const parameter2_;
@@ -682,7 +895,7 @@ public:
    *
    */
   ComparingParameter( ParameterPTR m1, ParameterPTR m2, const Dictionary& d )
-    : Parameter( m1->is_spatial() or m2->is_spatial(), true )
+    : Parameter( m1->is_spatial() or m2->is_spatial(), true, m1->is_random() or m2->is_random() )
     , parameter1_( m1 )
     , parameter2_( m2 )
     , comparator_( -1 )
@@ -725,6 +938,25 @@ public:
       parameter2_->value( rng, source_pos, target_pos, layer, node ) );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    std::vector< double > values2;
+    parameter1_->values( rng, source_positions, target_pos, layer, node, result );
+    parameter2_->values( rng, source_positions, target_pos, layer, node, values2 );
+    for ( size_t i = 0; i < result.size(); ++i )
+    {
+      result[ i ] = compare_( result[ i ], values2[ i ] );
+    }
+  }
+
+  double get_cutoff_distance( double threshold ) const override;
+
 protected:
   ParameterPTR const parameter1_;
   ParameterPTR const parameter2_;
@@ -767,7 +999,8 @@ public:
    */
   ConditionalParameter( ParameterPTR condition, ParameterPTR if_true, ParameterPTR if_false )
     : Parameter( condition->is_spatial() or if_true->is_spatial() or if_false->is_spatial(),
-        if_true->returns_int_only() and if_false->returns_int_only() )
+        if_true->returns_int_only() and if_false->returns_int_only(),
+        condition->is_random() or if_true->is_random() or if_false->is_random() )
     , condition_( condition )
     , if_true_( if_true )
     , if_false_( if_false )
@@ -815,6 +1048,29 @@ public:
     }
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    // Both branches are evaluated over the whole batch and the results
+    // selected element-wise, which keeps the loops free of branches.
+    std::vector< double > values_true;
+    std::vector< double > values_false;
+    condition_->values( rng, source_positions, target_pos, layer, node, result );
+    if_true_->values( rng, source_positions, target_pos, layer, node, values_true );
+    if_false_->values( rng, source_positions, target_pos, layer, node, values_false );
+    for ( size_t i = 0; i < result.size(); ++i )
+    {
+      result[ i ] = result[ i ] ? values_true[ i ] : values_false[ i ];
+    }
+  }
+
+  double get_cutoff_distance( double threshold ) const override;
+
 protected:
   ParameterPTR const condition_;
   ParameterPTR const if_true_;
@@ -833,7 +1089,7 @@ public:
    * object.
    */
   MinParameter( ParameterPTR p, const double other_value )
-    : Parameter( p->is_spatial(), p->returns_int_only() and value_is_integer_( other_value ) )
+    : Parameter( p->is_spatial(), p->returns_int_only() and value_is_integer_( other_value ), p->is_random() )
     , p_( p )
     , other_value_( other_value )
   {
@@ -866,6 +1122,21 @@ public:
     return std::min( p_->value( rng, source_pos, target_pos, layer, node ), other_value_ );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    p_->values( rng, source_positions, target_pos, layer, node, result );
+    for ( auto& v : result )
+    {
+      v = std::min( v, other_value_ );
+    }
+  }
+
 protected:
   ParameterPTR const p_;
   double other_value_;
@@ -883,7 +1154,7 @@ public:
    * object.
    */
   MaxParameter( ParameterPTR p, const double other_value )
-    : Parameter( p->is_spatial(), p->returns_int_only() and value_is_integer_( other_value ) )
+    : Parameter( p->is_spatial(), p->returns_int_only() and value_is_integer_( other_value ), p->is_random() )
     , p_( p )
     , other_value_( other_value )
   {
@@ -915,6 +1186,21 @@ public:
     return std::max( p_->value( rng, source_pos, target_pos, layer, node ), other_value_ );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    p_->values( rng, source_positions, target_pos, layer, node, result );
+    for ( auto& v : result )
+    {
+      v = std::max( v, other_value_ );
+    }
+  }
+
 protected:
   ParameterPTR const p_;
   double other_value_;
@@ -971,7 +1257,7 @@ public:
    * supplied Parameter object.
    */
   ExpParameter( ParameterPTR p )
-    : Parameter( p->is_spatial() )
+    : Parameter( p->is_spatial(), false, p->is_random() )
     , p_( p )
   {
   }
@@ -1001,6 +1287,21 @@ public:
     return std::exp( p_->value( rng, source_pos, target_pos, layer, node ) );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    p_->values( rng, source_positions, target_pos, layer, node, result );
+    for ( auto& v : result )
+    {
+      v = std::exp( v );
+    }
+  }
+
 protected:
   ParameterPTR const p_;
 };
@@ -1017,7 +1318,7 @@ public:
    * supplied Parameter object.
    */
   SinParameter( ParameterPTR p )
-    : Parameter( p->is_spatial() )
+    : Parameter( p->is_spatial(), false, p->is_random() )
     , p_( p )
   {
   }
@@ -1047,6 +1348,21 @@ public:
     return std::sin( p_->value( rng, source_pos, target_pos, layer, node ) );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    p_->values( rng, source_positions, target_pos, layer, node, result );
+    for ( auto& v : result )
+    {
+      v = std::sin( v );
+    }
+  }
+
 protected:
   ParameterPTR const p_;
 };
@@ -1062,7 +1378,7 @@ public:
    * supplied Parameter object.
    */
   CosParameter( ParameterPTR p )
-    : Parameter( p->is_spatial() )
+    : Parameter( p->is_spatial(), false, p->is_random() )
     , p_( p )
   {
   }
@@ -1092,6 +1408,21 @@ public:
     return std::cos( p_->value( rng, source_pos, target_pos, layer, node ) );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    p_->values( rng, source_positions, target_pos, layer, node, result );
+    for ( auto& v : result )
+    {
+      v = std::cos( v );
+    }
+  }
+
 protected:
   ParameterPTR const p_;
 };
@@ -1108,7 +1439,7 @@ public:
    * Construct the parameter. A copy is made of the supplied Parameter object.
    */
   PowParameter( ParameterPTR p, const double exponent )
-    : Parameter( p->is_spatial(), p->returns_int_only() )
+    : Parameter( p->is_spatial(), p->returns_int_only(), p->is_random() )
     , p_( p )
     , exponent_( exponent )
   {
@@ -1140,6 +1471,21 @@ public:
     return std::pow( p_->value( rng, source_pos, target_pos, layer, node ), exponent_ );
   }
 
+  void
+  values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override
+  {
+    p_->values( rng, source_positions, target_pos, layer, node, result );
+    for ( auto& v : result )
+    {
+      v = std::pow( v, exponent_ );
+    }
+  }
+
 protected:
   ParameterPTR const p_;
   const double exponent_;
@@ -1162,7 +1508,7 @@ public:
    * A copy is made of the supplied Parameter objects.
    */
   DimensionParameter( ParameterPTR px, ParameterPTR py )
-    : Parameter( true )
+    : Parameter( true, false, px->is_random() or py->is_random() )
     , num_dimensions_( 2 )
     , px_( px )
     , py_( py )
@@ -1171,7 +1517,7 @@ public:
   }
 
   DimensionParameter( ParameterPTR px, ParameterPTR py, ParameterPTR pz )
-    : Parameter( true )
+    : Parameter( true, false, px->is_random() or py->is_random() or pz->is_random() )
     , num_dimensions_( 3 )
     , px_( px )
     , py_( py )
@@ -1267,6 +1613,15 @@ public:
     const AbstractLayer& layer,
     Node* node ) override;
 
+  void values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override;
+
+  double get_cutoff_distance( double threshold ) const override;
+
 protected:
   ParameterPTR const p_;
   const double inv_beta_;
@@ -1311,6 +1666,15 @@ public:
     const AbstractLayer& layer,
     Node* node ) override;
 
+  void values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override;
+
+  double get_cutoff_distance( double threshold ) const override;
+
 protected:
   ParameterPTR const p_;
   const double mean_;
@@ -1360,6 +1724,13 @@ public:
     const AbstractLayer& layer,
     Node* node ) override;
 
+  void values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override;
+
 protected:
   ParameterPTR const px_;
   ParameterPTR const py_;
@@ -1411,6 +1782,13 @@ public:
     const AbstractLayer& layer,
     Node* node ) override;
 
+  void values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override;
+
 protected:
   std::shared_ptr< Parameter > const px_;
   std::shared_ptr< Parameter > const py_;
@@ -1462,6 +1840,13 @@ public:
     const AbstractLayer& layer,
     Node* node ) override;
 
+  void values( RngPtr rng,
+    const std::vector< double >& source_positions,
+    const std::vector< double >& target_pos,
+    const AbstractLayer& layer,
+    Node* node,
+    std::vector< double >& result ) override;
+
 protected:
   ParameterPTR const p_;
   const double kappa_;
@@ -1491,6 +1876,12 @@ Parameter::returns_int_only() const
   return returns_int_only_;
 }
 
+inline bool
+Parameter::is_random() const
+{
+  return is_random_;
+}
+
 inline bool
 Parameter::value_is_integer_( const double value ) const
 {
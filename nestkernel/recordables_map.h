@@ -25,6 +25,8 @@
 
 // C++ includes:
 #include <cassert>
+#include <concepts>
+#include <functional>
 #include <map>
 #include <string>
 #include <utility>
@@ -34,6 +36,8 @@
 
 namespace nest
 {
+class Node;
+
 /**
  * Map names of recordables to data access functions.
  *
@@ -100,6 +104,46 @@ public:
     // return recordables_;
   }
 
+  /**
+   * Return a function that reads the recordable name from a node of type
+   * HostNode, or an empty function if there is no such recordable.
+   */
+  std::function< double( const Node& ) >
+  get_reader( const std::string& name ) const
+  {
+    const auto it = this->find( name );
+    if ( it == this->end() )
+    {
+      return std::function< double( const Node& ) >();
+    }
+
+    const DataAccessFct fct = it->second;
+    return [ fct ]( const Node& node ) { return ( static_cast< const HostNode& >( node ).*fct )(); };
+  }
+
+  /**
+   * Return the reader for the recordable name from the static map
+   * HostNode::recordablesMap_, or an empty function if HostNode has no
+   * such map or the map has no such recordable.
+   *
+   * Models declare RecordablesMap< HostNode > a friend, so this gives
+   * GenericModel access to their private map.
+   */
+  static std::function< double( const Node& ) >
+  get_host_reader( const std::string& name )
+  {
+    if constexpr ( requires {
+                     { &HostNode::recordablesMap_ } -> std::same_as< RecordablesMap* >;
+                   } )
+    {
+      return HostNode::recordablesMap_.get_reader( name );
+    }
+    else
+    {
+      return std::function< double( const Node& ) >();
+    }
+  }
+
 private:
   //! Insertion functions to be used in create(), adds entry to map and list
   void
@@ -22,7 +22,19 @@
 
 #include "recording_backend.h"
 
+// Includes from nestkernel:
+#include "event.h"
+
 const std::vector< std::string > nest::RecordingBackend::NO_DOUBLE_VALUE_NAMES;
 const std::vector< std::string > nest::RecordingBackend::NO_LONG_VALUE_NAMES;
 const std::vector< double > nest::RecordingBackend::NO_DOUBLE_VALUES;
 const std::vector< long > nest::RecordingBackend::NO_LONG_VALUES;
+
+void
+nest::RecordingBackend::write_batch( const RecordingDevice& device, const std::vector< SpikeEvent >& events )
+{
+  for ( const auto& event : events )
+  {
+    write( device, event, NO_DOUBLE_VALUES, NO_LONG_VALUES );
+  }
+}
@@ -33,6 +33,7 @@ namespace nest
 
 class RecordingDevice;
 class Event;
+class SpikeEvent;
 
 /**
  * Abstract base class for all NESTio recording backends
@@ -56,10 +57,11 @@ class Event;
  * each recording backend via the IOManager. At the end of each run,
  * it calls post_run_hook() respectively.
  *
- * During the simulation, recording devices call IOManager::write() in
- * order to record data. These calls are forwarded to the backend, the
- * device is enrolled with. Cleanup on the user level finally calls
- * the cleanup() function of all backends.
+ * At the beginning of each run, recording devices obtain the backend
+ * they are enrolled with from IOManager::get_recording_backend(). During
+ * the simulation, they call write() or write_batch() on that backend
+ * directly in order to record data. Cleanup on the user level finally
+ * calls the cleanup() function of all backends.
  *
  */
 
@@ -234,6 +236,21 @@ public:
     const std::vector< double >& double_values,
     const std::vector< long >& long_values ) = 0;
 
+  /**
+   * Write a batch of spike events recorded by a device.
+   *
+   * This is equivalent to calling write() without additional values for
+   * each of the events in order, but allows backends to look up the data
+   * for the device only once per batch. Spike recorders collect the events
+   * they receive and hand them over once per time slice. The default
+   * implementation calls write() for each event.
+   *
+   * @param device the RecordingDevice, backend-specific channel to write to
+   * @param events the events in the order in which they were received
+   *
+   */
+  virtual void write_batch( const RecordingDevice& device, const std::vector< SpikeEvent >& events );
+
   /**
    * Set the status of the recording backend using the key-value pairs
    * contained in the params dictionary.
@@ -301,6 +318,20 @@ public:
    */
   virtual void get_device_status( const RecordingDevice& device, Dictionary& params ) const = 0;
 
+  /**
+   * Return an estimate of the number of bytes held by the backend for
+   * recorded data.
+   *
+   * This is reported in the memory report of the kernel status. The
+   * default implementation returns 0 for backends that do not keep
+   * recorded data in memory.
+   */
+  virtual size_t
+  get_memory_size() const
+  {
+    return 0;
+  }
+
   static const std::vector< std::string > NO_DOUBLE_VALUE_NAMES;
   static const std::vector< std::string > NO_LONG_VALUE_NAMES;
   static const std::vector< double > NO_DOUBLE_VALUES;
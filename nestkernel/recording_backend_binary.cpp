@@ -0,0 +1,678 @@
+/*
+ *  recording_backend_binary.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "recording_backend_binary.h"
+
+// C++ includes:
+#include <iomanip>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "vector_util.h"
+
+// Includes from nestkernel:
+#include "recording_device.h"
+#include "vp_manager_impl.h"
+
+
+const unsigned int nest::RecordingBackendBinary::BINARY_REC_BACKEND_VERSION = 2;
+
+namespace
+{
+
+template < typename T >
+void
+write_raw( std::ofstream& file, const T& value )
+{
+  file.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+}
+
+template < typename T >
+void
+write_raw( std::ofstream& file, const std::vector< T >& values )
+{
+  file.write( reinterpret_cast< const char* >( values.data() ), values.size() * sizeof( T ) );
+}
+
+void
+write_raw( std::ofstream& file, const std::string& value )
+{
+  write_raw( file, static_cast< uint32_t >( value.size() ) );
+  file.write( value.data(), value.size() );
+}
+
+}  // namespace
+
+nest::RecordingBackendBinary::RecordingBackendBinary()
+  : buffer_size_( 4096 )
+  , writing_( false )
+  , stop_( false )
+{
+}
+
+nest::RecordingBackendBinary::~RecordingBackendBinary() throw()
+{
+  stop_writer_();
+}
+
+void
+nest::RecordingBackendBinary::initialize()
+{
+  data_map tmp( kernel().vp_manager.get_num_threads() );
+  device_data_.swap( tmp );
+}
+
+void
+nest::RecordingBackendBinary::finalize()
+{
+  stop_writer_();
+}
+
+void
+nest::RecordingBackendBinary::enroll( const RecordingDevice& device, const Dictionary& params )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    std::string vp_node_id_string = compute_vp_node_id_string_( device );
+    std::string modelname = device.get_name();
+    auto p = device_data_[ t ].emplace( node_id, DeviceData( modelname, vp_node_id_string, node_id ) );
+    device_data = p.first;
+  }
+
+  device_data->second.set_status( params );
+}
+
+void
+nest::RecordingBackendBinary::disenroll( const RecordingDevice& device )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    // The writer may still hold blocks referring to the file of the device
+    wait_for_writer_();
+    device_data_[ t ].erase( device_data );
+  }
+}
+
+void
+nest::RecordingBackendBinary::set_value_names( const RecordingDevice& device,
+  const std::vector< std::string >& double_value_names,
+  const std::vector< std::string >& long_value_names )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  assert( device_data != device_data_[ t ].end() );
+  device_data->second.set_value_names( double_value_names, long_value_names );
+}
+
+void
+nest::RecordingBackendBinary::pre_run_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::post_run_hook()
+{
+  submit_all_blocks_();
+  wait_for_writer_();
+
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.flush_file();
+    }
+  }
+
+  check_writer_error_();
+}
+
+void
+nest::RecordingBackendBinary::post_step_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::prepare()
+{
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.open_file();
+      device_data.second.block_ = acquire_block_( device_data.second );
+    }
+  }
+
+  start_writer_();
+}
+
+void
+nest::RecordingBackendBinary::cleanup()
+{
+  submit_all_blocks_();
+  stop_writer_();
+
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.block_.reset();
+      device_data.second.close_file();
+    }
+  }
+  free_.clear();
+
+  check_writer_error_();
+}
+
+void
+nest::RecordingBackendBinary::write( const RecordingDevice& device,
+  const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    return;
+  }
+
+  device_data->second.write( event, double_values, long_values );
+
+  if ( device_data->second.block_->size() >= buffer_size_ )
+  {
+    submit_block_( device_data->second );
+  }
+}
+
+void
+nest::RecordingBackendBinary::write_batch( const RecordingDevice& device, const std::vector< SpikeEvent >& events )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    return;
+  }
+
+  for ( const auto& event : events )
+  {
+    device_data->second.write( event, NO_DOUBLE_VALUES, NO_LONG_VALUES );
+    if ( device_data->second.block_->size() >= buffer_size_ )
+    {
+      submit_block_( device_data->second );
+    }
+  }
+}
+
+const std::string
+nest::RecordingBackendBinary::compute_vp_node_id_string_( const RecordingDevice& device ) const
+{
+  const double num_vps = kernel().vp_manager.get_num_virtual_processes();
+  const double num_nodes = kernel().node_manager.size();
+  const int vp_digits = static_cast< int >( std::floor( std::log10( num_vps ) ) + 1 );
+  const int node_id_digits = static_cast< int >( std::floor( std::log10( num_nodes ) ) + 1 );
+
+  std::ostringstream vp_node_id_string;
+  vp_node_id_string << "-" << std::setfill( '0' ) << std::setw( node_id_digits ) << device.get_node_id() << "-"
+                    << std::setfill( '0' ) << std::setw( vp_digits ) << device.get_vp();
+
+  return vp_node_id_string.str();
+}
+
+void
+nest::RecordingBackendBinary::submit_block_( DeviceData& device_data )
+{
+  std::unique_ptr< Block > block = acquire_block_( device_data );
+  block.swap( device_data.block_ );
+  {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    pending_.push_back( std::move( block ) );
+  }
+  blocks_submitted_.notify_one();
+}
+
+void
+nest::RecordingBackendBinary::submit_all_blocks_()
+{
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      if ( device_data.second.block_ and device_data.second.block_->size() > 0 )
+      {
+        submit_block_( device_data.second );
+      }
+    }
+  }
+}
+
+std::unique_ptr< nest::RecordingBackendBinary::Block >
+nest::RecordingBackendBinary::acquire_block_( DeviceData& device_data )
+{
+  std::unique_ptr< Block > block;
+  {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    if ( not free_.empty() )
+    {
+      block = std::move( free_.back() );
+      free_.pop_back();
+    }
+  }
+  if ( not block )
+  {
+    block = std::make_unique< Block >();
+  }
+
+  block->reset(
+    &device_data.file_, device_data.num_double_values(), device_data.num_long_values(), buffer_size_ );
+  return block;
+}
+
+void
+nest::RecordingBackendBinary::start_writer_()
+{
+  if ( writer_.joinable() )
+  {
+    return;
+  }
+
+  stop_ = false;
+  writer_error_.clear();
+  writer_ = std::thread( &RecordingBackendBinary::write_blocks_, this );
+}
+
+void
+nest::RecordingBackendBinary::stop_writer_()
+{
+  if ( not writer_.joinable() )
+  {
+    return;
+  }
+
+  {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    stop_ = true;
+  }
+  blocks_submitted_.notify_one();
+  writer_.join();
+}
+
+void
+nest::RecordingBackendBinary::wait_for_writer_()
+{
+  std::unique_lock< std::mutex > lock( mutex_ );
+  blocks_written_.wait( lock, [ this ] { return pending_.empty() and not writing_; } );
+}
+
+void
+nest::RecordingBackendBinary::check_writer_error_()
+{
+  std::string error;
+  {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    error.swap( writer_error_ );
+  }
+
+  if ( not error.empty() )
+  {
+    LOG( VerbosityLevel::ERROR, "RecordingBackendBinary::write()", error );
+    throw IOError();
+  }
+}
+
+void
+nest::RecordingBackendBinary::write_blocks_()
+{
+  std::unique_lock< std::mutex > lock( mutex_ );
+  while ( true )
+  {
+    blocks_submitted_.wait( lock, [ this ] { return stop_ or not pending_.empty(); } );
+    if ( pending_.empty() )
+    {
+      // stop_ is set and all blocks have been written
+      return;
+    }
+
+    std::unique_ptr< Block > block = std::move( pending_.front() );
+    pending_.pop_front();
+    writing_ = true;
+    lock.unlock();
+
+    write_block_( *block );
+    const bool failed = block->file->fail();
+
+    lock.lock();
+    if ( failed )
+    {
+      writer_error_ = "I/O error while writing recorded data.";
+    }
+    free_.push_back( std::move( block ) );
+    writing_ = false;
+    if ( pending_.empty() )
+    {
+      blocks_written_.notify_all();
+    }
+  }
+}
+
+void
+nest::RecordingBackendBinary::write_block_( const Block& block )
+{
+  std::ofstream& file = *block.file;
+
+  write_raw( file, static_cast< uint64_t >( block.size() ) );
+  write_raw( file, block.senders );
+  write_raw( file, block.steps );
+  write_raw( file, block.offsets );
+  for ( const auto& column : block.double_values )
+  {
+    write_raw( file, column );
+  }
+  for ( const auto& column : block.long_values )
+  {
+    write_raw( file, column );
+  }
+}
+
+void
+nest::RecordingBackendBinary::set_status( const Dictionary& d )
+{
+  long buffer_size = buffer_size_;
+  if ( d.update_integer_value( names::buffer_size, buffer_size ) )
+  {
+    if ( buffer_size < 1 )
+    {
+      throw BadProperty( "buffer_size > 0 required." );
+    }
+    if ( writer_.joinable() )
+    {
+      throw BadProperty( "buffer_size cannot be changed between Prepare and Cleanup." );
+    }
+    buffer_size_ = buffer_size;
+  }
+}
+
+void
+nest::RecordingBackendBinary::get_status( Dictionary& d ) const
+{
+  d[ names::buffer_size ] = static_cast< long >( buffer_size_ );
+}
+
+void
+nest::RecordingBackendBinary::check_device_status( const Dictionary& params ) const
+{
+  DeviceData dd( "", "", 0 );
+  dd.set_status( params );  // throws if params contains invalid entries
+}
+
+void
+nest::RecordingBackendBinary::get_device_defaults( Dictionary& params ) const
+{
+  DeviceData dd( "", "", 0 );
+  dd.get_status( params );
+}
+
+void
+nest::RecordingBackendBinary::get_device_status( const nest::RecordingDevice& device, Dictionary& d ) const
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::const_iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data->second.get_status( d );
+  }
+}
+
+size_t
+nest::RecordingBackendBinary::get_memory_size() const
+{
+  size_t bytes = 0;
+  for ( const auto& thread_data : device_data_ )
+  {
+    for ( const auto& device_data : thread_data )
+    {
+      if ( device_data.second.block_ )
+      {
+        bytes += device_data.second.block_->get_memory_size();
+      }
+    }
+  }
+
+  std::lock_guard< std::mutex > lock( mutex_ );
+  for ( const auto& block : pending_ )
+  {
+    bytes += block->get_memory_size();
+  }
+  for ( const auto& block : free_ )
+  {
+    bytes += block->get_memory_size();
+  }
+  return bytes;
+}
+
+/* ******************* Memory block for records ******************* */
+
+void
+nest::RecordingBackendBinary::Block::reset( std::ofstream* file,
+  size_t num_double_values,
+  size_t num_long_values,
+  size_t capacity )
+{
+  this->file = file;
+
+  senders.clear();
+  steps.clear();
+  offsets.clear();
+  senders.reserve( capacity );
+  steps.reserve( capacity );
+  offsets.reserve( capacity );
+
+  double_values.resize( num_double_values );
+  for ( auto& column : double_values )
+  {
+    column.clear();
+    column.reserve( capacity );
+  }
+  long_values.resize( num_long_values );
+  for ( auto& column : long_values )
+  {
+    column.clear();
+    column.reserve( capacity );
+  }
+}
+
+size_t
+nest::RecordingBackendBinary::Block::get_memory_size() const
+{
+  return sizeof( Block ) + vector_util::memory_size( senders ) + vector_util::memory_size( steps )
+    + vector_util::memory_size( offsets ) + vector_util::memory_size( double_values )
+    + vector_util::memory_size( long_values );
+}
+
+/* ******************* Device meta data class DeviceData ******************* */
+
+nest::RecordingBackendBinary::DeviceData::DeviceData( std::string modelname,
+  std::string vp_node_id_string,
+  size_t node_id )
+  : node_id_( node_id )
+  , modelname_( modelname )
+  , vp_node_id_string_( vp_node_id_string )
+  , file_extension_( "bin" )
+  , label_( "" )
+{
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::set_value_names( const std::vector< std::string >& double_value_names,
+  const std::vector< std::string >& long_value_names )
+{
+  double_value_names_ = double_value_names;
+  long_value_names_ = long_value_names;
+}
+
+size_t
+nest::RecordingBackendBinary::DeviceData::num_double_values() const
+{
+  return double_value_names_.size();
+}
+
+size_t
+nest::RecordingBackendBinary::DeviceData::num_long_values() const
+{
+  return long_value_names_.size();
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::flush_file()
+{
+  file_.flush();
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::open_file()
+{
+  std::string filename = compute_filename_();
+
+  std::ifstream test( filename.c_str() );
+  if ( test.good() and not kernel().io_manager.overwrite_files() )
+  {
+    std::string msg = String::compose(
+      "The file '%1' already exists and overwriting files is disabled. To overwrite files, set "
+      "the kernel property overwrite_files to true. To change the name or location of the file, "
+      "change the kernel properties data_path or data_prefix, or the device property label.",
+      filename );
+    LOG( VerbosityLevel::ERROR, "RecordingBackendBinary::prepare()", msg );
+    throw IOError();
+  }
+  test.close();
+
+  file_ = std::ofstream( filename.c_str(), std::ios::binary );
+
+  if ( not file_.good() )
+  {
+    std::string msg = String::compose( "I/O error while opening file '%1'.", filename );
+    LOG( VerbosityLevel::ERROR, "RecordingBackendBinary::prepare()", msg );
+    throw IOError();
+  }
+
+  const char magic[ 8 ] = { 'N', 'E', 'S', 'T', 'B', 'I', 'N', '\0' };
+  file_.write( magic, sizeof( magic ) );
+  write_raw( file_, static_cast< uint32_t >( BINARY_REC_BACKEND_VERSION ) );
+  write_raw( file_, static_cast< uint32_t >( 0x01020304 ) );
+  write_raw( file_, Time::get_resolution().get_ms() );
+  write_raw( file_, static_cast< int64_t >( Time::get_tics_per_step() ) );
+  write_raw( file_, Time::get_ms_per_tic() );
+  write_raw( file_, static_cast< uint64_t >( node_id_ ) );
+  write_raw( file_, static_cast< uint32_t >( double_value_names_.size() ) );
+  write_raw( file_, static_cast< uint32_t >( long_value_names_.size() ) );
+  for ( const auto& name : double_value_names_ )
+  {
+    write_raw( file_, name );
+  }
+  for ( const auto& name : long_value_names_ )
+  {
+    write_raw( file_, name );
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::close_file()
+{
+  file_.close();
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::write( const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  block_->senders.push_back( event.get_sender_node_id() );
+  block_->steps.push_back( event.get_stamp().get_steps() );
+  block_->offsets.push_back( event.get_offset() );
+
+  for ( size_t i = 0; i < double_values.size(); ++i )
+  {
+    block_->double_values[ i ].push_back( double_values[ i ] );
+  }
+  for ( size_t i = 0; i < long_values.size(); ++i )
+  {
+    block_->long_values[ i ].push_back( long_values[ i ] );
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::get_status( Dictionary& d ) const
+{
+  d[ names::file_extension ] = file_extension_;
+
+  // devices on other threads append their files, see spike_recorder::get_status()
+  auto& filenames = d.get_or_create_vector< std::string >( names::filenames );
+  filenames.push_back( compute_filename_() );
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::set_status( const Dictionary& d )
+{
+  d.update_value( names::file_extension, file_extension_ );
+  d.update_value( names::label, label_ );
+}
+
+std::string
+nest::RecordingBackendBinary::DeviceData::compute_filename_() const
+{
+  std::string data_path = kernel().io_manager.get_data_path();
+  if ( not data_path.empty() and not( data_path[ data_path.size() - 1 ] == '/' ) )
+  {
+    data_path += '/';
+  }
+
+  std::string label = label_;
+  if ( label.empty() )
+  {
+    label = modelname_;
+  }
+
+  std::string data_prefix = kernel().io_manager.get_data_prefix();
+
+  return data_path + data_prefix + label + vp_node_id_string_ + "." + file_extension_;
+}
@@ -0,0 +1,293 @@
+/*
+ *  recording_backend_binary.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RECORDING_BACKEND_BINARY_H
+#define RECORDING_BACKEND_BINARY_H
+
+// C++ includes:
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "recording_backend.h"
+
+/* BeginUserDocs: NOINDEX
+
+Short description
++++++++++++++++++
+
+Recording backend `binary` - Write data to binary files in a columnar format
+
+Description
+~~~~~~~~~~~
+
+The `binary` recording backend writes collected data persistently to
+binary files. It is an alternative to the :doc:`ascii
+</models/recording_backend_ascii>` backend for simulations in which
+formatting the recorded data as text takes a noticeable share of the
+simulation time or the files become too large.
+
+During the simulation, records are appended to per-device memory
+blocks without any formatting. Full blocks are written to the files by
+a separate I/O thread, so writing overlaps with the simulation. At the
+end of each call to ``Run``, all pending data is written and the files
+are flushed, so they are available for immediate inspection.
+
+Filenames are determined as for the `ascii` backend, i.e., one file is
+written per recording device per virtual process:
+
+::
+
+   data_path/data_prefix(label|model_name)-node_id-vp.file_extension
+
+If a file already exists, ``Prepare`` fails with an ``IOError``
+unless the kernel property ``overwrite_files`` is set to ``True``.
+
+The files can be read with ``nest.read_binary_recording()``, which
+returns the recorded data as NumPy arrays.
+
+Data format
+~~~~~~~~~~~
+
+All numbers are stored in the native byte order of the machine that
+wrote the file. A file starts with a header:
+
+==========================  ==============================================
+Field                       Content
+==========================  ==============================================
+magic                       8 bytes ``NESTBIN`` followed by a zero byte
+version                     uint32, version of the format (currently 2)
+byte order mark             uint32, ``0x01020304`` in the writer's order
+resolution                  float64, simulation resolution in ms
+tics per step               int64, number of tics per time step
+ms per tic                  float64, duration of a tic in ms
+node ID                     uint64, node ID of the recording device
+number of double columns    uint32, :math:`n_d`
+number of integer columns   uint32, :math:`n_l`
+column names                for each of the :math:`n_d + n_l` value
+                            columns, the length of the name as uint32
+                            followed by the name in UTF-8
+==========================  ==============================================
+
+The header is followed by any number of blocks. Each block holds the
+number :math:`n` of records as uint64, followed by the columns of the
+block, each stored as an array of :math:`n` values:
+
+==========================  ==============================================
+Column                      Type
+==========================  ==============================================
+senders                     uint64
+time steps                  int64
+time offsets                float64
+double value columns        float64, one column per double value
+integer value columns       int64, one column per integer value
+==========================  ==============================================
+
+The time of a record in ms is given by the time step multiplied by the
+tics per step and the ms per tic, minus the offset. This is the time
+the kernel reports, which may differ in the last digit from the time step
+multiplied by the resolution.
+
+Parameter summary
+~~~~~~~~~~~~~~~~~
+
+buffer_size
+    Global parameter of the backend. The number of records (default:
+    *4096*) collected per device before a block is handed to the I/O
+    thread.
+
+file_extension
+    A string (default: *"bin"*) that specifies the file name extension,
+    without leading dot.
+
+filenames
+    A list of the filenames where data is recorded to. This list has one
+    entry per local thread and is a read-only property.
+
+label
+    A string (default: *""*) that replaces the model name component in
+    the filename if it is set.
+
+EndUserDocs */
+
+namespace nest
+{
+
+/**
+ * Binary specialization of the RecordingBackend interface.
+ *
+ * RecordingBackendBinary maintains one file and one memory block per
+ * recording device instance on every thread. Calls to write() append the
+ * record to the columns of the block of the device. Full blocks are
+ * queued for a writer thread, which writes them to the file of the
+ * device and returns them for reuse. The writer thread is started in
+ * prepare() and stopped in cleanup(). Between calls to Run, the
+ * post_run_hook() hands all partially filled blocks to the writer and
+ * waits until they have been written.
+ */
+class RecordingBackendBinary : public RecordingBackend
+{
+public:
+  const static unsigned int BINARY_REC_BACKEND_VERSION;
+
+  RecordingBackendBinary();
+
+  ~RecordingBackendBinary() throw() override;
+
+  void initialize() override;
+
+  void finalize() override;
+
+  void enroll( const RecordingDevice& device, const Dictionary& params ) override;
+
+  void disenroll( const RecordingDevice& device ) override;
+
+  void set_value_names( const RecordingDevice& device,
+    const std::vector< std::string >& double_value_names,
+    const std::vector< std::string >& long_value_names ) override;
+
+  void prepare() override;
+
+  void cleanup() override;
+
+  void pre_run_hook() override;
+
+  /**
+   * Write all pending records and flush files after a single call to Run
+   */
+  void post_run_hook() override;
+
+  void post_step_hook() override;
+
+  void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+
+  void write_batch( const RecordingDevice&, const std::vector< SpikeEvent >& ) override;
+
+  void set_status( const Dictionary& ) override;
+  void get_status( Dictionary& ) const override;
+
+  void check_device_status( const Dictionary& ) const override;
+  void get_device_defaults( Dictionary& ) const override;
+  void get_device_status( const RecordingDevice& device, Dictionary& ) const override;
+
+  size_t get_memory_size() const override;
+
+private:
+  /**
+   * Records of one device, stored column by column.
+   */
+  struct Block
+  {
+    std::ofstream* file;  //!< file to which the block is written
+    std::vector< uint64_t > senders;
+    std::vector< int64_t > steps;
+    std::vector< double > offsets;
+    std::vector< std::vector< double > > double_values;
+    std::vector< std::vector< int64_t > > long_values;
+
+    void reset( std::ofstream* file, size_t num_double_values, size_t num_long_values, size_t capacity );
+    size_t get_memory_size() const;
+    size_t
+    size() const
+    {
+      return senders.size();
+    }
+  };
+
+  struct DeviceData
+  {
+    DeviceData() = delete;
+    DeviceData( std::string, std::string, size_t );
+    void set_value_names( const std::vector< std::string >&, const std::vector< std::string >& );
+    void open_file();
+    void write( const Event&, const std::vector< double >&, const std::vector< long >& );
+    void flush_file();
+    void close_file();
+    void get_status( Dictionary& ) const;
+    void set_status( const Dictionary& );
+
+    std::unique_ptr< Block > block_;  //!< block to which records are appended
+    std::ofstream file_;              //!< File stream to use for the device
+
+    size_t num_double_values() const;
+    size_t num_long_values() const;
+
+  private:
+    size_t node_id_;                                 //!< node ID of the device
+    std::string modelname_;                          //!< File name up to but not including the "."
+    std::string vp_node_id_string_;                  //!< The vp and node ID component of the filename
+    std::string file_extension_;                     //!< File name extension without leading "."
+    std::string label_;                              //!< The label of the device.
+    std::vector< std::string > double_value_names_;  //!< names for values of type double
+    std::vector< std::string > long_value_names_;    //!< names for values of type long
+
+    std::string compute_filename_() const;  //!< Compose and return the filename
+  };
+
+  const std::string compute_vp_node_id_string_( const RecordingDevice& device ) const;
+
+  //! Hand the block of the device to the writer thread and provide an empty block for further records
+  void submit_block_( DeviceData& device_data );
+
+  //! Hand all non-empty blocks to the writer thread
+  void submit_all_blocks_();
+
+  //! Return an empty block for the given device, reusing written blocks if possible
+  std::unique_ptr< Block > acquire_block_( DeviceData& device_data );
+
+  void start_writer_();
+  void stop_writer_();
+
+  //! Block until all submitted blocks have been written
+  void wait_for_writer_();
+
+  //! Throw IOError if the writer thread failed to write a block
+  void check_writer_error_();
+
+  //! Main loop of the writer thread
+  void write_blocks_();
+
+  static void write_block_( const Block& block );
+
+  typedef std::vector< std::map< size_t, DeviceData > > data_map;
+  data_map device_data_;
+
+  size_t buffer_size_;  //!< Number of records per block
+
+  std::thread writer_;
+  mutable std::mutex mutex_;                        //!< Protects the members below
+  std::condition_variable blocks_submitted_;        //!< Signals new blocks or stopping to the writer
+  std::condition_variable blocks_written_;          //!< Signals that the writer has become idle
+  std::deque< std::unique_ptr< Block > > pending_;  //!< Blocks waiting to be written
+  std::vector< std::unique_ptr< Block > > free_;    //!< Written blocks available for reuse
+  bool writing_;                                    //!< True while the writer writes a block
+  bool stop_;                                       //!< Tells the writer to finish
+  std::string writer_error_;                        //!< Message of last write error, empty if none
+};
+
+}  // namespace
+
+#endif /* #ifndef RECORDING_BACKEND_BINARY_H */
@@ -20,6 +20,9 @@
  *
  */
 
+// Includes from libnestutil:
+#include "vector_util.h"
+
 // Includes from nestkernel:
 #include "recording_device.h"
 #include "vp_manager_impl.h"
@@ -112,6 +115,19 @@ nest::RecordingBackendMemory::write( const RecordingDevice& device,
   device_data_[ t ][ node_id ].push_back( event, double_values, long_values );
 }
 
+void
+nest::RecordingBackendMemory::write_batch( const RecordingDevice& device, const std::vector< SpikeEvent >& events )
+{
+  size_t t = device.get_thread();
+  size_t node_id = device.get_node_id();
+
+  DeviceData& device_data = device_data_[ t ][ node_id ];
+  for ( const auto& event : events )
+  {
+    device_data.push_back( event, NO_DOUBLE_VALUES, NO_LONG_VALUES );
+  }
+}
+
 void
 nest::RecordingBackendMemory::check_device_status( const Dictionary& params ) const
 {
@@ -139,6 +155,33 @@ nest::RecordingBackendMemory::get_device_status( const RecordingDevice& device,
   }
 }
 
+size_t
+nest::RecordingBackendMemory::get_memory_size() const
+{
+  size_t bytes = 0;
+  for ( const auto& thread_data : device_data_ )
+  {
+    for ( const auto& device_data : thread_data )
+    {
+      bytes += device_data.second.get_memory_size();
+    }
+  }
+  return bytes;
+}
+
+void
+nest::RecordingBackendMemory::drain_device_events( const RecordingDevice& device, RecordedEvents& events )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  const auto device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data->second.drain( events );
+  }
+}
+
 void
 nest::RecordingBackendMemory::post_run_hook()
 {
@@ -277,6 +320,41 @@ nest::RecordingBackendMemory::DeviceData::set_status( const Dictionary& d )
   }
 }
 
+void
+nest::RecordingBackendMemory::DeviceData::drain( RecordedEvents& events )
+{
+  events.time_in_steps = time_in_steps_;
+
+  events.senders.clear();
+  events.senders.swap( senders_ );
+  events.times_ms.clear();
+  events.times_ms.swap( times_ms_ );
+  events.times_steps.clear();
+  events.times_steps.swap( times_steps_ );
+  events.times_offset.clear();
+  events.times_offset.swap( times_offset_ );
+
+  events.double_value_names = double_value_names_;
+  events.long_value_names = long_value_names_;
+
+  // swap the outer vectors and re-create empty value vectors, as only the
+  // number of recorded quantities needs to be retained for further recording
+  events.double_values.clear();
+  events.double_values.swap( double_values_ );
+  double_values_.resize( events.double_values.size() );
+  events.long_values.clear();
+  events.long_values.swap( long_values_ );
+  long_values_.resize( events.long_values.size() );
+}
+
+size_t
+nest::RecordingBackendMemory::DeviceData::get_memory_size() const
+{
+  return vector_util::memory_size( senders_ ) + vector_util::memory_size( times_ms_ )
+    + vector_util::memory_size( times_steps_ ) + vector_util::memory_size( times_offset_ )
+    + vector_util::memory_size( double_values_ ) + vector_util::memory_size( long_values_ );
+}
+
 void
 nest::RecordingBackendMemory::DeviceData::clear()
 {
@@ -67,6 +67,13 @@ be read out of the `n_events` entry in the status dictionary of the
 recording device. To delete data from memory, `n_events` can be set to
 0. Other values cannot be set.
 
+Reading the ``events`` dictionary copies the recorded data. For large
+amounts of data, the events can instead be drained from the backend
+using the ``drain_events()`` method of the recorder's NodeCollection.
+This hands the recorded data over to Python without copying, one
+dictionary of read-only NumPy arrays per thread, and removes the data
+from the backend. Afterwards, ``n_events`` is 0.
+
 Parameter summary
 ~~~~~~~~~~~~~~~~~
 
@@ -96,6 +103,25 @@ EndUserDocs */
 namespace nest
 {
 
+/**
+ * Events recorded by one recording device on one thread.
+ *
+ * Filled by RecordingBackendMemory::drain_device_events(), which moves
+ * the recorded data out of the backend without copying it.
+ */
+struct RecordedEvents
+{
+  bool time_in_steps = false;                          //!< If true, times_steps and times_offset are filled
+  std::vector< long > senders;                         //!< sender node IDs of the events
+  std::vector< double > times_ms;                      //!< times of registered events in ms
+  std::vector< long > times_steps;                     //!< times of registered events in steps
+  std::vector< double > times_offset;                  //!< offsets of registered events if time_in_steps
+  std::vector< std::string > double_value_names;       //!< names for values of type double
+  std::vector< std::string > long_value_names;         //!< names for values of type long
+  std::vector< std::vector< double > > double_values;  //!< recorded values of type double, one vector per value
+  std::vector< std::vector< long > > long_values;      //!< recorded values of type long, one vector per value
+};
+
 /**
  * Memory specialization of the RecordingBackend interface.
  *
@@ -134,6 +160,8 @@ public:
 
   void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
 
+  void write_batch( const RecordingDevice&, const std::vector< SpikeEvent >& ) override;
+
   void pre_run_hook() override;
 
   void post_run_hook() override;
@@ -148,6 +176,17 @@ public:
   void get_device_defaults( Dictionary& ) const override;
   void get_device_status( const RecordingDevice& device, Dictionary& ) const override;
 
+  size_t get_memory_size() const override;
+
+  /**
+   * Move the events recorded by the given device out of the backend.
+   *
+   * The data buffers of the device are swapped with those of events,
+   * so this takes constant time independent of the number of events.
+   * Afterwards, no events are stored for the device.
+   */
+  void drain_device_events( const RecordingDevice& device, RecordedEvents& events );
+
 private:
   struct DeviceData
   {
@@ -156,6 +195,8 @@ private:
     void push_back( const Event&, const std::vector< double >&, const std::vector< long >& );
     void get_status( Dictionary& ) const;
     void set_status( const Dictionary& );
+    void drain( RecordedEvents& );
+    size_t get_memory_size() const;
 
   private:
     void clear();
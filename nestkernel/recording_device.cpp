@@ -31,6 +31,7 @@ nest::RecordingDevice::RecordingDevice()
   , Device()
   , P_()
   , backend_params_()
+  , backend_( nullptr )
 {
 }
 
@@ -39,6 +40,7 @@ nest::RecordingDevice::RecordingDevice( const RecordingDevice& rd )
   , Device( rd )
   , P_( rd.P_ )
   , backend_params_( rd.backend_params_ )
+  , backend_( nullptr )
 {
 }
 
@@ -53,7 +55,8 @@ nest::RecordingDevice::pre_run_hook( const std::vector< std::string >& double_va
   const std::vector< std::string >& long_value_names )
 {
   Device::pre_run_hook();
-  kernel().io_manager.set_recording_value_names( P_.record_to_, *this, double_value_names, long_value_names );
+  backend_ = kernel().io_manager.get_recording_backend( P_.record_to_ );
+  backend_->set_value_names( *this, double_value_names, long_value_names );
 }
 
 const std::string&
@@ -210,11 +213,27 @@ nest::RecordingDevice::is_active( Time const& T ) const
   return get_t_min_() < stamp and stamp <= get_t_max_();
 }
 
+void
+nest::RecordingDevice::drain_events( RecordedEvents& events )
+{
+  kernel().io_manager.drain_recording_backend_device_events( P_.record_to_, *this, events );
+  S_.n_events_ = 0;
+}
+
 void
 nest::RecordingDevice::write( const Event& event,
   const std::vector< double >& double_values,
   const std::vector< long >& long_values )
 {
-  kernel().io_manager.write( P_.record_to_, *this, event, double_values, long_values );
+  assert( backend_ );
+  backend_->write( *this, event, double_values, long_values );
   S_.n_events_++;
 }
+
+void
+nest::RecordingDevice::write_batch( const std::vector< SpikeEvent >& events )
+{
+  assert( backend_ );
+  backend_->write_batch( *this, events );
+  S_.n_events_ += events.size();
+}
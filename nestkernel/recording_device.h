@@ -39,6 +39,8 @@
 namespace nest
 {
 
+struct RecordedEvents;
+
 /* BeginUserDocs: NOINDEX
 
 Short description
@@ -180,8 +182,35 @@ public:
   void set_status( const Dictionary& ) override;
   void get_status( Dictionary& ) const override;
 
+  /**
+   * Move the events recorded by this device out of its recording backend.
+   *
+   * Only supported by the memory backend. Resets the number of recorded
+   * events to zero.
+   */
+  void drain_events( RecordedEvents& events );
+
+  /**
+   * Hand events buffered by the device to its recording backend.
+   *
+   * Called at the end of each run for devices that registered with
+   * IOManager::register_buffering_device().
+   */
+  virtual void
+  flush_buffered_events()
+  {
+  }
+
 protected:
   void write( const Event&, const std::vector< double >&, const std::vector< long >& );
+
+  /**
+   * Write a batch of spike events without additional values.
+   *
+   * Equivalent to calling write() for each of the events, but hands them
+   * to the backend in a single call.
+   */
+  void write_batch( const std::vector< SpikeEvent >& );
   void set_initialized_() override;
 
 private:
@@ -207,6 +236,9 @@ private:
   } S_;
 
   Dictionary backend_params_;
+
+  //! Backend the device is enrolled with, resolved from record_to in pre_run_hook()
+  RecordingBackend* backend_;
 };
 
 }  // namespace
@@ -26,6 +26,7 @@
 // C++ includes:
 #include <array>
 #include <list>
+#include <tuple>
 #include <vector>
 
 // Includes from nestkernel:
@@ -140,6 +141,15 @@ public:
     return buffer_.size();
   }
 
+  /**
+   * Returns number of bytes held by the buffer, for memory measurement.
+   */
+  size_t
+  memory() const
+  {
+    return buffer_.capacity() * sizeof( double );
+  }
+
 private:
   //! Buffered data
   std::vector< double > buffer_;
@@ -241,6 +251,15 @@ public:
     return buffer_.size();
   }
 
+  /**
+   * Returns number of bytes held by the buffer, for memory measurement.
+   */
+  size_t
+  memory() const
+  {
+    return buffer_.capacity() * sizeof( double );
+  }
+
 private:
   //! Buffered data
   std::vector< double > buffer_;
@@ -323,6 +342,15 @@ public:
     return buffer_.size();
   }
 
+  /**
+   * Returns number of bytes held by the buffer, for memory measurement.
+   */
+  size_t
+  memory() const
+  {
+    return buffer_.capacity() * sizeof( std::list< double > );
+  }
+
 private:
   //! Buffered data
   std::vector< std::list< double > > buffer_;
@@ -382,6 +410,8 @@ public:
 
   size_t size() const;
 
+  size_t memory() const;
+
 private:
   /**
    * Buffered data stored in a vector of arrays of double values
@@ -422,6 +452,48 @@ MultiChannelInputBuffer< num_channels >::size() const
   return buffer_.size();
 }
 
+template < unsigned int num_channels >
+inline size_t
+MultiChannelInputBuffer< num_channels >::memory() const
+{
+  return buffer_.capacity() * sizeof( std::array< double, num_channels > );
+}
+
+/**
+ * Return the number of bytes held by the given buffers.
+ *
+ * Buffers may be passed individually or as vectors of buffers. Any type with
+ * a member function memory() counts as a buffer. GenericModel applies this to
+ * the tuple returned by ring_buffers() to implement
+ * Model::get_ring_buffer_memory(), so models list their buffers with
+ * std::tie().
+ */
+template < typename Buffer >
+inline size_t
+ring_buffer_memory( const Buffer& buffer )
+{
+  return buffer.memory();
+}
+
+template < typename Buffer >
+inline size_t
+ring_buffer_memory( const std::vector< Buffer >& buffers )
+{
+  size_t bytes = buffers.capacity() * sizeof( Buffer );
+  for ( const auto& buffer : buffers )
+  {
+    bytes += buffer.memory();
+  }
+  return bytes;
+}
+
+template < typename Buffer, typename... Buffers >
+inline size_t
+ring_buffer_memory( const Buffer& buffer, const Buffers&... buffers )
+{
+  return ring_buffer_memory( buffer ) + ring_buffer_memory( buffers... );
+}
+
 }  // namespace nest
 
 
@@ -28,6 +28,7 @@
 // C++ includes:
 #include <iomanip>
 #include <limits>
+#include <memory>
 #include <vector>
 
 // Includes from libnestutil:
@@ -59,6 +60,8 @@ nest::SimulationManager::SimulationManager()
   , wfr_tol_( 0.0001 )
   , wfr_max_iterations_( 15 )
   , wfr_interpolation_order_( 3 )
+  , wfr_incremental_exchange_( false )
+  , update_nodes_in_batches_( false )
   , update_time_limit_( std::numeric_limits< double >::infinity() )
   , min_update_time_( std::numeric_limits< double >::infinity() )
   , max_update_time_( -std::numeric_limits< double >::infinity() )
@@ -100,6 +103,8 @@ nest::SimulationManager::initialize( const bool adjust_number_of_threads_or_rng_
   wfr_tol_ = 0.0001;
   wfr_max_iterations_ = 15;
   wfr_interpolation_order_ = 3;
+  wfr_incremental_exchange_ = false;
+  update_nodes_in_batches_ = false;
   update_time_limit_ = std::numeric_limits< double >::infinity();
   min_update_time_ = std::numeric_limits< double >::infinity();
   max_update_time_ = -std::numeric_limits< double >::infinity();
@@ -175,6 +180,7 @@ nest::SimulationManager::set_status( const Dictionary& d )
   }
 
   d.update_value( names::print_time, print_time_ );
+  d.update_value( names::update_nodes_in_batches, update_nodes_in_batches_ );
 
   // tics_per_ms and resolution must come after local_num_thread /
   // total_num_threads because they might reset the network and the time
@@ -405,6 +411,9 @@ nest::SimulationManager::set_status( const Dictionary& d )
     }
   }
 
+  // exchange only changed coefficients in waveform relaxation iterations
+  d.update_value( names::wfr_incremental_exchange, wfr_incremental_exchange_ );
+
   // update time limit
   double t_new = 0.0;
   if ( d.update_value( names::update_time_limit, t_new ) )
@@ -477,7 +486,9 @@ nest::SimulationManager::get_status( Dictionary& d )
   d[ names::wfr_tol ] = wfr_tol_;
   d[ names::wfr_max_iterations ] = wfr_max_iterations_;
   d[ names::wfr_interpolation_order ] = static_cast< long >( wfr_interpolation_order_ );
+  d[ names::wfr_incremental_exchange ] = wfr_incremental_exchange_;
 
+  d[ names::update_nodes_in_batches ] = update_nodes_in_batches_;
   d[ names::update_time_limit ] = update_time_limit_;
   d[ names::min_update_time ] = min_update_time_;
   d[ names::max_update_time ] = max_update_time_;
@@ -867,6 +878,17 @@ nest::SimulationManager::update_()
     // exceptions here and then handle them after the parallel region.
     try
     {
+      // Batches of models that hold node state in arrays during a run load it here and store it after the run
+      std::vector< std::unique_ptr< NodeBatchState > > batch_states;
+      if ( update_nodes_in_batches_ )
+      {
+        for ( const NodeUpdateBatch& batch : kernel().node_manager.get_update_batches_on_thread( tid ) )
+        {
+          Node* const* first = batch.nodes.data();
+          batch_states.push_back( batch.model->create_batch_state( first, first + batch.nodes.size() ) );
+        }
+      }
+
       do
       {
         if ( print_time_ )
@@ -893,6 +915,21 @@ nest::SimulationManager::update_()
 
           if ( kernel().connection_manager.has_primary_connections() )
           {
+            if ( kernel().event_delivery_manager.get_overlap_spike_communication() )
+            {
+              // Spike exchange started at the end of the previous slice ran concurrently
+              // with the delivery of secondary events; finish it before delivering spikes.
+#pragma omp master
+              {
+                sw_gather_spike_data_.start();
+                kernel().event_delivery_manager.complete_gather_spike_data();
+                sw_gather_spike_data_.stop();
+              }
+              kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+              kernel().get_omp_synchronization_simulation_stopwatch().stop();
+            }
+
             sw_deliver_spike_data_.start();
             // Deliver spikes from receive buffer to ring buffers.
             kernel().event_delivery_manager.deliver_events( tid );
@@ -986,8 +1023,16 @@ nest::SimulationManager::update_()
                 done_all = done[ i ] and done_all;
               }
 
-              // gather SecondaryEvents (e.g. GapJunctionEvents)
-              kernel().event_delivery_manager.gather_secondary_events( done_all );
+              // gather SecondaryEvents (e.g. GapJunctionEvents); in incremental
+              // mode, only the first iteration exchanges all coefficients
+              if ( wfr_incremental_exchange_ )
+              {
+                kernel().event_delivery_manager.gather_changed_secondary_events( done_all, n == 0 );
+              }
+              else
+              {
+                kernel().event_delivery_manager.gather_secondary_events( done_all );
+              }
 
               // reset done and done_all
               //(needs to be in the single threaded part)
@@ -1059,14 +1104,36 @@ nest::SimulationManager::update_()
         }  // of structural plasticity
 
         sw_update_.start();
-        const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
 
-        for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
+        // Nodes are updated in order of increasing node ID, either one call per run of nodes of the same model or
+        // one virtual call per node
+        if ( update_nodes_in_batches_ )
         {
-          Node* node = n->get_node();
-          if ( not( node )->is_frozen() )
+          const std::vector< NodeUpdateBatch >& batches = kernel().node_manager.get_update_batches_on_thread( tid );
+          for ( size_t b = 0; b < batches.size(); ++b )
           {
-            ( node )->update( clock_, from_step_, to_step_ );
+            if ( batch_states[ b ] )
+            {
+              batch_states[ b ]->update( clock_, from_step_, to_step_ );
+            }
+            else
+            {
+              const NodeUpdateBatch& batch = batches[ b ];
+              Node* const* first = batch.nodes.data();
+              batch.model->update_nodes( first, first + batch.nodes.size(), clock_, from_step_, to_step_ );
+            }
+          }
+        }
+        else
+        {
+          const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
+          for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
+          {
+            Node* node = n->get_node();
+            if ( not node->is_frozen() )
+            {
+              node->update( clock_, from_step_, to_step_ );
+            }
           }
         }
 
@@ -1154,6 +1221,21 @@ nest::SimulationManager::update_()
 
       } while ( to_do_ > 0 );
 
+      for ( const auto& batch_state : batch_states )
+      {
+        if ( batch_state )
+        {
+          batch_state->store();
+        }
+      }
+
+      // Do not leave a non-blocking spike exchange pending between calls to Run(),
+      // the master thread is the one which started it
+#pragma omp master
+      {
+        kernel().event_delivery_manager.complete_gather_spike_data();
+      }
+
       // End of the slice, we update the number of synaptic elements
       for ( SparseNodeArray::const_iterator i = kernel().node_manager.get_local_nodes( tid ).begin();
         i != kernel().node_manager.get_local_nodes( tid ).end();
@@ -1172,6 +1254,7 @@ nest::SimulationManager::update_()
 
   if ( update_time_limit_exceeded )
   {
+    kernel().event_delivery_manager.discard_gather_spike_data();
     LOG( VerbosityLevel::ERROR, "SimulationManager::update", "Update time limit exceeded." );
     throw KernelException();
   }
@@ -1181,6 +1264,9 @@ nest::SimulationManager::update_()
   {
     if ( eptr )
     {
+      // a spike exchange may have been started before the exception was raised
+      kernel().event_delivery_manager.discard_gather_spike_data();
+
       simulating_ = false;  // must mark this here, see #311
       inconsistent_state_ = true;
       std::rethrow_exception( eptr );
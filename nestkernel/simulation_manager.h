@@ -221,6 +221,9 @@ private:
                                     //!< relaxation
   size_t wfr_interpolation_order_;  //!< interpolation order for waveform
                                     //!< relaxation method
+  bool wfr_incremental_exchange_;   //!< if true, waveform relaxation iterations after the first
+                                    //!< only exchange coefficients that changed
+  bool update_nodes_in_batches_;    //!< if true, nodes are updated in per-model batches, see Model::update_nodes()
   double update_time_limit_;        //!< throw exception if single update cycle takes longer
                                     //!< than update_time_limit_ (seconds, default inf)
   double min_update_time_;          //!< shortest update time seen so far (seconds)
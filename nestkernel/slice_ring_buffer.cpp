@@ -64,6 +64,17 @@ nest::SliceRingBuffer::clear()
   }
 }
 
+size_t
+nest::SliceRingBuffer::memory() const
+{
+  size_t bytes = queue_.capacity() * sizeof( std::vector< SpikeInfo > );
+  for ( const auto& slot : queue_ )
+  {
+    bytes += slot.capacity() * sizeof( SpikeInfo );
+  }
+  return bytes;
+}
+
 void
 nest::SliceRingBuffer::prepare_delivery()
 {
@@ -127,6 +127,11 @@ public:
    */
   void resize();
 
+  /**
+   * Returns number of bytes held by the buffer, for memory measurement.
+   */
+  size_t memory() const;
+
 private:
   /**
    * Information about spike.
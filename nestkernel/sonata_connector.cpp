@@ -26,6 +26,7 @@
 #ifdef HAVE_HDF5
 
 // C++ includes:
+#include <algorithm>
 #include <cstdlib>  // for div()
 #include <string>
 #include <vector>
@@ -49,6 +50,8 @@ SonataConnector::SonataConnector( const Dictionary& graph_specs, const long hype
   , hyperslab_size_( hyperslab_size )
   , weight_dataset_exist_( false )
   , delay_dataset_exist_( false )
+  , use_target_index_( kernel().mpi_manager.get_num_processes() > 1 )
+  , target_index_required_( false )
 {
 }
 
@@ -100,6 +103,14 @@ SonataConnector::connect()
     names::weight, names::delay, names::min_delay, names::max_delay, names::num_connections, names::synapse_model
   };
 
+  // Reading only edges with rank-local targets pays off only with more than one MPI process,
+  // but can be enforced or switched off by the user
+  if ( graph_specs_.known( "use_target_index" ) )
+  {
+    use_target_index_ = graph_specs_.get< bool >( "use_target_index" );
+    target_index_required_ = use_target_index_;
+  }
+
   // Iterate edge files
   for ( const auto& edge_dict : edges_container )
   {
@@ -112,6 +123,7 @@ SonataConnector::connect()
     edge_dict.update_value( "syn_specs", cur_edge_params_ );
 
     create_edge_type_id_2_syn_spec_( cur_edge_params_ );
+    create_edge_type_table_();
 
     // Get names of population groups (usually just one population group)
     std::vector< std::string > pop_names;
@@ -148,8 +160,23 @@ SonataConnector::connect()
       get_attribute_( source_attribute_value_, src_node_id_dset_, "node_population" );
       get_attribute_( target_attribute_value_, tgt_node_id_dset_, "node_population" );
 
-      // Read datasets sequentially in chunks and connect
-      sequential_chunkwise_connector_();
+      const bool has_index = has_target_index_( pop_grp );
+      if ( target_index_required_ and not has_index )
+      {
+        throw KernelException( "use_target_index requires the indices/target_to_source group, which is missing in "
+          + cur_fname_ + " for population " + pop_name );
+      }
+
+      if ( use_target_index_ and has_index )
+      {
+        // Read only edges with rank-local targets and connect
+        target_indexed_connector_( pop_grp );
+      }
+      else
+      {
+        // Read datasets sequentially in chunks and connect
+        sequential_chunkwise_connector_();
+      }
 
       close_dsets_();
 
@@ -367,45 +394,162 @@ SonataConnector::sequential_chunkwise_connector_()
   hsize_t offset = 0;  // start coordinates of data selection
   for ( long long i = 0; i < dv.quot; i++ )
   {
-    connect_chunk_( hyperslab_size_, offset );
+    connect_chunk_( { { offset, hyperslab_size_ } }, hyperslab_size_ );
     offset += hyperslab_size_;
   }
 
   // Handle remainder
   if ( dv.rem > 0 )
   {
-    connect_chunk_( dv.rem, offset );
+    connect_chunk_( { { offset, static_cast< hsize_t >( dv.rem ) } }, dv.rem );
+  }
+}
+
+bool
+SonataConnector::has_target_index_( const H5::Group* pop_grp )
+{
+  // H5Lexists must be checked level by level, it fails if an intermediate group is missing
+  if ( H5Lexists( pop_grp->getId(), "indices", H5P_DEFAULT ) <= 0
+    or H5Lexists( pop_grp->getId(), "indices/target_to_source", H5P_DEFAULT ) <= 0 )
+  {
+    return false;
+  }
+  return H5Lexists( pop_grp->getId(), "indices/target_to_source/node_id_to_range", H5P_DEFAULT ) > 0
+    and H5Lexists( pop_grp->getId(), "indices/target_to_source/range_to_edge_id", H5P_DEFAULT ) > 0;
+}
+
+void
+SonataConnector::target_indexed_connector_( const H5::Group* pop_grp )
+{
+  // node_id_to_range maps each SONATA target id to a range of rows in range_to_edge_id,
+  // each of which again is a range of edge ids [start, end)
+  std::vector< long > node_id_to_range;
+  std::vector< long > range_to_edge_id;
+
+  const auto index_grp = open_group_( pop_grp, "indices/target_to_source" );
+  try
+  {
+    read_index_( index_grp->openDataSet( "node_id_to_range" ), node_id_to_range );
+    read_index_( index_grp->openDataSet( "range_to_edge_id" ), range_to_edge_id );
+  }
+  catch ( const H5::Exception& e )
+  {
+    throw KernelException( "Could not open target_to_source index in " + cur_fname_ + ": " + e.getDetailMsg() );
+  }
+  index_grp->close();
+  delete index_grp;
+
+  const auto num_index_targets = node_id_to_range.size() / 2;
+  const auto num_ranges = range_to_edge_id.size() / 2;
+  const auto num_edges = get_nrows_( tgt_node_id_dset_ );
+
+  const auto nest_nodes = graph_specs_.get< Dictionary >( "nodes" );
+  const auto tgt_nc = nest_nodes.get< NodeCollectionPTR >( target_attribute_value_ );
+
+  // Collect edge ranges of all targets on this rank
+  std::vector< std::pair< hsize_t, hsize_t > > edge_ranges;  // offset, count
+  size_t sonata_tgt_id = 0;
+  for ( auto it = tgt_nc->begin(); it < tgt_nc->end() and sonata_tgt_id < num_index_targets; ++it, ++sonata_tgt_id )
+  {
+    // Check the rank: outside a parallel region, is_node_id_vp_local() only accepts the VP of thread 0
+    if ( not kernel().vp_manager.is_local_vp( kernel().vp_manager.node_id_to_vp( ( *it ).node_id ) ) )
+    {
+      continue;
+    }
+
+    const long range_begin = node_id_to_range[ 2 * sonata_tgt_id ];
+    const long range_end = node_id_to_range[ 2 * sonata_tgt_id + 1 ];
+    for ( long r = std::max( range_begin, 0L ); r < range_end; ++r )
+    {
+      if ( static_cast< size_t >( r ) >= num_ranges )
+      {
+        throw KernelException( "node_id_to_range in " + cur_fname_ + " refers to non-existing range" );
+      }
+      const long edge_begin = range_to_edge_id[ 2 * r ];
+      const long edge_end = range_to_edge_id[ 2 * r + 1 ];
+      if ( edge_begin < 0 or edge_end <= edge_begin )
+      {
+        continue;
+      }
+      if ( static_cast< hsize_t >( edge_end ) > num_edges )
+      {
+        throw KernelException( "range_to_edge_id in " + cur_fname_ + " refers to non-existing edges" );
+      }
+      edge_ranges.emplace_back( edge_begin, edge_end - edge_begin );
+    }
+  }
+
+  // Read edges in file order, merging adjacent ranges to reduce the number of blocks
+  std::sort( edge_ranges.begin(), edge_ranges.end() );
+  std::vector< std::pair< hsize_t, hsize_t > > merged_ranges;
+  for ( const auto& range : edge_ranges )
+  {
+    if ( not merged_ranges.empty() and merged_ranges.back().first + merged_ranges.back().second == range.first )
+    {
+      merged_ranges.back().second += range.second;
+    }
+    else
+    {
+      merged_ranges.push_back( range );
+    }
+  }
+
+  // Connect in chunks of at most hyperslab_size_ edges
+  std::vector< std::pair< hsize_t, hsize_t > > blocks;
+  hsize_t chunk_size = 0;
+  for ( auto [ offset, count ] : merged_ranges )
+  {
+    while ( count > 0 )
+    {
+      const hsize_t n = std::min( count, hyperslab_size_ - chunk_size );
+      blocks.emplace_back( offset, n );
+      chunk_size += n;
+      offset += n;
+      count -= n;
+
+      if ( chunk_size == hyperslab_size_ )
+      {
+        connect_chunk_( blocks, chunk_size );
+        blocks.clear();
+        chunk_size = 0;
+      }
+    }
+  }
+
+  if ( chunk_size > 0 )
+  {
+    connect_chunk_( blocks, chunk_size );
   }
 }
 
-///*
 void
-SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t offset )
+SonataConnector::connect_chunk_( const std::vector< std::pair< hsize_t, hsize_t > >& blocks, const hsize_t chunk_size )
 {
 
   // Read subsets
-  std::vector< unsigned long > src_node_id_data_subset( hyperslab_size );
-  std::vector< unsigned long > tgt_node_id_data_subset( hyperslab_size );
-  std::vector< unsigned long > edge_type_id_data_subset( hyperslab_size );
+  std::vector< unsigned long > src_node_id_data_subset( chunk_size );
+  std::vector< unsigned long > tgt_node_id_data_subset( chunk_size );
+  std::vector< unsigned long > edge_type_id_data_subset( chunk_size );
   std::vector< double > syn_weight_data_subset;
   std::vector< double > delay_data_subset;
 
-  read_subset_( src_node_id_dset_, src_node_id_data_subset, H5::PredType::NATIVE_LONG, hyperslab_size, offset );
-  read_subset_( tgt_node_id_dset_, tgt_node_id_data_subset, H5::PredType::NATIVE_LONG, hyperslab_size, offset );
-  read_subset_( edge_type_id_dset_, edge_type_id_data_subset, H5::PredType::NATIVE_LONG, hyperslab_size, offset );
+  read_subset_( src_node_id_dset_, src_node_id_data_subset, H5::PredType::NATIVE_LONG, blocks );
+  read_subset_( tgt_node_id_dset_, tgt_node_id_data_subset, H5::PredType::NATIVE_LONG, blocks );
+  read_subset_( edge_type_id_dset_, edge_type_id_data_subset, H5::PredType::NATIVE_LONG, blocks );
 
   if ( weight_dataset_exist_ )
   {
-    syn_weight_data_subset.resize( hyperslab_size );
-    read_subset_( syn_weight_dset_, syn_weight_data_subset, H5::PredType::NATIVE_DOUBLE, hyperslab_size, offset );
+    syn_weight_data_subset.resize( chunk_size );
+    read_subset_( syn_weight_dset_, syn_weight_data_subset, H5::PredType::NATIVE_DOUBLE, blocks );
   }
   if ( delay_dataset_exist_ )
   {
-    delay_data_subset.resize( hyperslab_size );
-    read_subset_( delay_dset_, delay_data_subset, H5::PredType::NATIVE_DOUBLE, hyperslab_size, offset );
+    delay_data_subset.resize( chunk_size );
+    read_subset_( delay_dset_, delay_data_subset, H5::PredType::NATIVE_DOUBLE, blocks );
   }
 
-  std::vector< std::exception_ptr > exceptions_raised_( kernel().vp_manager.get_num_threads() );
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< std::exception_ptr > exceptions_raised_( num_threads );
 
   // Retrieve the correct NodeCollections
   const auto nest_nodes = graph_specs_.get< Dictionary >( "nodes" );
@@ -415,6 +559,25 @@ SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t off
   const auto snode_begin = src_nc->begin();
   const auto tnode_begin = tgt_nc->begin();
 
+  // Partition edges by thread of their target, so that each thread only visits its own edges.
+  // Edges keep their file order within each thread, thus connections are created as before.
+  std::vector< std::vector< hsize_t > > thread_edges( num_threads );
+  std::vector< size_t > tnode_ids( chunk_size );
+  for ( hsize_t i = 0; i < chunk_size; ++i )
+  {
+    const auto sonata_tgt_id = tgt_node_id_data_subset[ i ];
+    const size_t tnode_id = ( *( tnode_begin + sonata_tgt_id ) ).node_id;
+
+    const size_t tnode_vp = kernel().vp_manager.node_id_to_vp( tnode_id );
+    if ( not kernel().vp_manager.is_local_vp( tnode_vp ) )
+    {
+      continue;
+    }
+
+    tnode_ids[ i ] = tnode_id;
+    thread_edges[ kernel().vp_manager.vp_to_thread( tnode_vp ) ].push_back( i );
+  }
+
 #pragma omp parallel
   {
     const auto tid = kernel().vp_manager.get_thread_id();
@@ -422,17 +585,10 @@ SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t off
 
     try
     {
-      // Iterate the datasets and create the connections
-      for ( hsize_t i = 0; i < hyperslab_size; ++i )
+      // Iterate the edges of this thread and create the connections
+      for ( const auto i : thread_edges[ tid ] )
       {
-
-        const auto sonata_tgt_id = tgt_node_id_data_subset[ i ];
-        const size_t tnode_id = ( *( tnode_begin + sonata_tgt_id ) ).node_id;
-
-        if ( not kernel().vp_manager.is_node_id_vp_local( tnode_id ) )
-        {
-          continue;
-        }
+        const size_t tnode_id = tnode_ids[ i ];
 
         const auto sonata_src_id = src_node_id_data_subset[ i ];
         const size_t snode_id = ( *( snode_begin + sonata_src_id ) ).node_id;
@@ -440,20 +596,18 @@ SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t off
         Node* target = kernel().node_manager.get_node_or_proxy( tnode_id, tid );
         const size_t target_thread = target->get_thread();
 
-        const auto edge_type_id = edge_type_id_data_subset[ i ];
-        const auto syn_spec = cur_edge_params_.get< Dictionary >( std::to_string( edge_type_id ) );
+        auto& edge_type = get_edge_type_params_( edge_type_id_data_subset[ i ] );
 
-        const double weight =
-          get_syn_property_( syn_spec, i, weight_dataset_exist_, syn_weight_data_subset, names::weight );
-        const double delay = get_syn_property_( syn_spec, i, delay_dataset_exist_, delay_data_subset, names::delay );
+        const double weight = weight_dataset_exist_ ? syn_weight_data_subset[ i ] : edge_type.weight;
+        const double delay = delay_dataset_exist_ ? delay_data_subset[ i ] : edge_type.delay;
 
-        get_synapse_params_( snode_id, *target, target_thread, rng, edge_type_id );
+        get_synapse_params_( snode_id, *target, target_thread, rng, edge_type );
 
         kernel().connection_manager.connect( snode_id,
           target,
           target_thread,
-          edge_type_id_2_syn_model_.at( edge_type_id ),
-          edge_type_id_2_param_dicts_.at( edge_type_id ).at( tid ),
+          edge_type.synapse_model_id,
+          edge_type.param_dicts->at( tid ),
           delay,
           weight );
 
@@ -522,15 +676,19 @@ void
 SonataConnector::read_subset_( const H5::DataSet& dataset,
   std::vector< T >& data_buf,
   H5::PredType datatype,
-  hsize_t hyperslab_size,
-  hsize_t offset )
+  const std::vector< std::pair< hsize_t, hsize_t > >& blocks )
 {
   try
   {
-    H5::DataSpace mspace( 1, &hyperslab_size, NULL );
+    hsize_t num_rows = data_buf.size();
+    H5::DataSpace mspace( 1, &num_rows, NULL );
     H5::DataSpace dspace = dataset.getSpace();
-    // Select hyperslab. H5S_SELECT_SET replaces any existing selection with this call
-    dspace.selectHyperslab( H5S_SELECT_SET, &hyperslab_size, &offset );
+    // Select union of hyperslabs. H5S_SELECT_SET replaces any existing selection, H5S_SELECT_OR adds to it.
+    // Rows are read into the contiguous memory space in file order.
+    for ( size_t b = 0; b < blocks.size(); ++b )
+    {
+      dspace.selectHyperslab( b == 0 ? H5S_SELECT_SET : H5S_SELECT_OR, &blocks[ b ].second, &blocks[ b ].first );
+    }
     dataset.read( data_buf.data(), datatype, mspace, dspace );
     mspace.close();
     dspace.close();
@@ -541,12 +699,41 @@ SonataConnector::read_subset_( const H5::DataSet& dataset,
   }
 }
 
+void
+SonataConnector::read_index_( const H5::DataSet& dataset, std::vector< long >& data_buf )
+{
+  try
+  {
+    H5::DataSpace dspace = dataset.getSpace();
+    hsize_t dims_out[ 2 ] = { 0, 0 };
+    if ( dspace.getSimpleExtentNdims() == 2 )
+    {
+      dspace.getSimpleExtentDims( dims_out, NULL );
+    }
+    if ( dims_out[ 1 ] != 2 )
+    {
+      throw KernelException( "Index datasets in " + cur_fname_ + " must have two columns" );
+    }
+    data_buf.resize( 2 * dims_out[ 0 ] );
+    dataset.read( data_buf.data(), H5::PredType::NATIVE_LONG );
+    dspace.close();
+  }
+  catch ( const H5::Exception& e )
+  {
+    throw KernelException( "Unable to read index datasets in " + cur_fname_ + ": " + e.getDetailMsg() );
+  }
+}
+
 void
 SonataConnector::create_edge_type_id_2_syn_spec_( Dictionary edge_params )
 {
   for ( const auto& [ syn_k, syn_v ] : edge_params )
   {
     const int type_id = std::stoi( syn_k );
+    if ( type_id < 0 )
+    {
+      throw BadProperty( "SONATA edge type ids must be non-negative, got " + syn_k );
+    }
     const auto& d = std::get< Dictionary >( syn_v.item );
 
     const auto& syn_name = d.get< std::string >( "synapse_model" );
@@ -605,47 +792,69 @@ SonataConnector::set_synapse_params_( Dictionary syn_dict, size_t synapse_model_
 }
 
 void
-SonataConnector::get_synapse_params_( size_t snode_id,
-  Node& target,
-  size_t target_thread,
-  RngPtr rng,
-  int edge_type_id )
+SonataConnector::create_edge_type_table_()
 {
-  for ( auto const& syn_param : edge_type_id_2_syn_spec_.at( edge_type_id ) )
+  edge_type_params_.clear();
+  if ( edge_type_id_2_syn_model_.empty() )
   {
-    const auto param_name = syn_param.first;
-    const auto param = syn_param.second;
+    return;
+  }
 
-    if ( param->provides_long() )
+  // Map keys are sorted, so the last key is the largest edge type id
+  edge_type_params_.resize( edge_type_id_2_syn_model_.rbegin()->first + 1 );
+
+  for ( const auto& [ type_id, synapse_model_id ] : edge_type_id_2_syn_model_ )
+  {
+    const auto syn_spec = cur_edge_params_.get< Dictionary >( std::to_string( type_id ) );
+    auto& edge_type = edge_type_params_[ type_id ];
+
+    edge_type.is_defined = true;
+    edge_type.synapse_model_id = synapse_model_id;
+    // default value is NaN
+    if ( syn_spec.known( names::weight ) )
     {
-      edge_type_id_2_param_dicts_.at( edge_type_id ).at( target_thread ).at( param_name ) =
-        param->value_int( target_thread, rng, snode_id, &target );
+      edge_type.weight = syn_spec.get< double >( names::weight );
     }
-    else
+    if ( syn_spec.known( names::delay ) )
     {
-      edge_type_id_2_param_dicts_.at( edge_type_id ).at( target_thread ).at( param_name ) =
-        param->value_double( target_thread, rng, snode_id, &target );
+      edge_type.delay = syn_spec.get< double >( names::delay );
     }
+    // Map elements are never moved, so pointers remain valid until reset_params_()
+    edge_type.syn_params = &edge_type_id_2_syn_spec_.at( type_id );
+    edge_type.param_dicts = &edge_type_id_2_param_dicts_.at( type_id );
   }
 }
 
-double
-SonataConnector::get_syn_property_( const Dictionary& syn_spec,
-  hsize_t index,
-  const bool dataset_exists,
-  std::vector< double >& data,
-  const std::string& name )
+SonataConnector::EdgeTypeParams_&
+SonataConnector::get_edge_type_params_( unsigned long edge_type_id )
 {
-  if ( dataset_exists )
+  if ( edge_type_id >= edge_type_params_.size() or not edge_type_params_[ edge_type_id ].is_defined )
   {
-    return data[ index ];
+    throw KernelException(
+      "No synapse specification given for edge type id " + std::to_string( edge_type_id ) + " in " + cur_fname_ );
   }
-  else if ( syn_spec.known( name ) )
+  return edge_type_params_[ edge_type_id ];
+}
+
+void
+SonataConnector::get_synapse_params_( size_t snode_id,
+  Node& target,
+  size_t target_thread,
+  RngPtr rng,
+  EdgeTypeParams_& edge_type )
+{
+  auto& param_dict = edge_type.param_dicts->at( target_thread );
+  for ( auto const& [ param_name, param ] : *edge_type.syn_params )
   {
-    return syn_spec.get< double >( name );
+    if ( param->provides_long() )
+    {
+      param_dict.at( param_name ) = param->value_int( target_thread, rng, snode_id, &target );
+    }
+    else
+    {
+      param_dict.at( param_name ) = param->value_double( target_thread, rng, snode_id, &target );
+    }
   }
-  // default value is NaN
-  return numerics::nan;
 }
 
 void
@@ -661,6 +870,7 @@ SonataConnector::reset_params_()
   }
   edge_type_id_2_syn_spec_.clear();
   edge_type_id_2_param_dicts_.clear();
+  edge_type_params_.clear();
 }
 
 }  // end namespace nest
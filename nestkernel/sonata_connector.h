@@ -30,10 +30,12 @@
 // C++ includes:
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 // Includes from libnestutil
 #include "dict_util.h"
+#include "numerics.h"
 
 // Includes from nestkernel:
 #include "conn_parameter.h"
@@ -64,7 +66,14 @@ namespace nest
  * thread-safety, it is not thread-efficient as the usage of locks effectively
  * serialize function calls. Since HDF5 does not provide support for
  * thread-parallel reading, only one thread per MPI process reads connectivity
- * data, before all threads create connections in parallel.
+ * data, before all threads create connections in parallel. Each thread
+ * only handles the edges whose targets it owns.
+ *
+ * @note If the edge population provides the optional
+ * `indices/target_to_source` index, each MPI process can read only the edges
+ * whose targets are local to it instead of all edges. This is done by default
+ * when running with more than one MPI process, and can be controlled with the
+ * `use_target_index` entry of `graph_specs`.
  */
 class SonataConnector
 {
@@ -85,6 +94,19 @@ public:
   void connect();
 
 private:
+  typedef std::map< std::string, std::shared_ptr< ConnParameter > > ConnParameterMap;
+
+  //! Parameters of one edge type, resolved once per edge file
+  struct EdgeTypeParams_
+  {
+    bool is_defined = false;                           //!< true if edge type is specified in the edge types file
+    size_t synapse_model_id = 0;                       //!< NEST synapse model
+    double weight = numerics::nan;                     //!< weight used if there is no syn_weight dataset
+    double delay = numerics::nan;                      //!< delay used if there is no delay dataset
+    ConnParameterMap* syn_params = nullptr;            //!< further synapse parameters
+    std::vector< Dictionary >* param_dicts = nullptr;  //!< param dictionaries, one per thread
+  };
+
   /**
    * @brief Open an HDF5 edge file.
    *
@@ -171,6 +193,15 @@ private:
    */
   void set_synapse_params_( Dictionary syn_dict, size_t synapse_model_id, int type_id );
 
+  /**
+   * @brief Create dense table of edge type parameters.
+   *
+   * Resolves the synapse model, weight, delay and synapse parameters of each
+   * edge type once, so that no Dictionary or map lookups are needed per edge.
+   * Must be called after create_edge_type_id_2_syn_spec_().
+   */
+  void create_edge_type_table_();
+
   /**
    * @brief Get synapse parameters.
    *
@@ -180,56 +211,70 @@ private:
    * @param target target node
    * @param target_thread thread of target
    * @param rng rng pointer of target thread
-   * @param edge_type_id type id of current edge to be connected
+   * @param edge_type parameters of the type of the current edge to be connected
    */
-  void get_synapse_params_( size_t snode_id, Node& target, size_t target_thread, RngPtr rng, int edge_type_id );
+  void get_synapse_params_( size_t snode_id,
+    Node& target,
+    size_t target_thread,
+    RngPtr rng,
+    EdgeTypeParams_& edge_type );
 
   /**
-   * @brief Get synapse property.
-   *
-   * The synapse property, i.e., synaptic weight or delay, is either set
-   * from a HDF5 dataset or CSV entry. Default value is NaN.
-   *
-   * @param syn_spec synapse specification Dictionary
-   * @param index the index to access in data
-   * @param dataset_exists bool indicating whether dataset exists
-   * @param data data from synaptic property HDF5 dataset
-   * @param name name of the synaptic property
-   * @return double
+   * @brief Get parameters of an edge type.
+   * @param edge_type_id SONATA edge type id
+   * @throws KernelException if no parameters are given for the edge type
    */
-  double get_syn_property_( const Dictionary& syn_spec,
-    hsize_t index,
-    const bool dataset_exists,
-    std::vector< double >& data,
-    const std::string& name );
+  EdgeTypeParams_& get_edge_type_params_( unsigned long edge_type_id );
 
   /**
    * @brief Manage the sequential chunkwise connections to be created.
    */
   void sequential_chunkwise_connector_();
 
+  /**
+   * @brief Check whether the population group provides the target-to-source index.
+   * @param pop_grp Population group pointer.
+   */
+  bool has_target_index_( const H5::Group* pop_grp );
+
+  /**
+   * @brief Connect only edges with rank-local targets.
+   *
+   * Uses the `indices/target_to_source` index to find the edge ranges of the
+   * targets local to this MPI process and reads only these, in chunks of at
+   * most hyperslab_size_ edges.
+   *
+   * @param pop_grp Population group pointer.
+   */
+  void target_indexed_connector_( const H5::Group* pop_grp );
+
   /**
    * @brief Create connections in chunks.
-   * @param hyperslab_size Size of hyperslab (chunk) to be read from datasets
-   * @param offset Offset from start coordinate of data selection
+   * @param blocks Contiguous blocks of edges to be read from datasets, given by offset and count
+   * @param chunk_size Total number of edges in blocks
    */
-  void connect_chunk_( const hsize_t hyperslab_size, const hsize_t offset );
+  void connect_chunk_( const std::vector< std::pair< hsize_t, hsize_t > >& blocks, const hsize_t chunk_size );
 
   /**
    * @brief Read subset of dataset into memory.
    * @tparam T
    * @param dataset HDF5 dataset to read.
-   * @param data_buf Buffer to store data in memory.
+   * @param data_buf Buffer to store data in memory, must hold all selected rows.
    * @param datatype Type of data in dataset.
-   * @param hyperslab_size Size of hyperslab to be read from dataset.
-   * @param offset Offset from start coordinate of data selection.
+   * @param blocks Contiguous blocks of rows to read, given by offset and count.
    */
   template < typename T >
   void read_subset_( const H5::DataSet& dataset,
     std::vector< T >& data_buf,
     H5::PredType datatype,
-    hsize_t hyperslab_size,
-    hsize_t offset );
+    const std::vector< std::pair< hsize_t, hsize_t > >& blocks );
+
+  /**
+   * @brief Read two-dimensional index dataset with two columns into memory.
+   * @param dataset HDF5 dataset to read.
+   * @param data_buf Buffer to store data in, row by row.
+   */
+  void read_index_( const H5::DataSet& dataset, std::vector< long >& data_buf );
 
   /**
    * @brief Find the number and names of edge groups.
@@ -264,8 +309,6 @@ private:
    */
   void reset_params_();
 
-  typedef std::map< std::string, std::shared_ptr< ConnParameter > > ConnParameterMap;
-
   //! synapse-specific parameters that should be skipped when we set default synapse parameters
   std::set< std::string > skip_syn_params_;
 
@@ -299,6 +342,15 @@ private:
   //! Map from edge type id (SONATA specification) to param dictionaries (one per thread) used when creating connections
   std::map< int, std::vector< Dictionary > > edge_type_id_2_param_dicts_;
 
+  //! Parameters of edge types, indexed by edge type id (SONATA specification)
+  std::vector< EdgeTypeParams_ > edge_type_params_;
+
+  //! If true, read only edges with rank-local targets using the target-to-source index
+  bool use_target_index_;
+
+  //! If true, the user explicitly requested use of the target-to-source index
+  bool target_index_required_;
+
   //! Datasets
   std::string cur_fname_;
   H5::DataSet src_node_id_dset_;
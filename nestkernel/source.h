@@ -142,6 +142,20 @@ Source::is_disabled() const
   return disabled_;
 }
 
+/**
+ * Returns the key by which nest::sort() orders sources.
+ *
+ * Disabled sources get keys larger than all enabled ones, so that sorting
+ * moves them to the end, where SourceTable::remove_disabled_sources()
+ * expects them.
+ */
+inline uint64_t
+sort_key( const Source& source )
+{
+  return static_cast< uint64_t >( source.get_node_id() )
+    | ( static_cast< uint64_t >( source.is_disabled() ) << NUM_BITS_NODE_ID );
+}
+
 inline bool
 operator<( const Source& lhs, const Source& rhs )
 {
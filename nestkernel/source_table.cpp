@@ -80,6 +80,39 @@ nest::SourceTable::finalize()
   compressed_spike_data_map_.clear();
 }
 
+size_t
+nest::SourceTable::get_memory_size() const
+{
+  // each node of a std::map holds, besides its value, three pointers and a color
+  const size_t map_node_overhead = 4 * sizeof( void* );
+
+  size_t bytes = sources_.capacity() * sizeof( std::vector< BlockVector< Source > > );
+  for ( const auto& thread_sources : sources_ )
+  {
+    bytes += thread_sources.capacity() * sizeof( BlockVector< Source > );
+    for ( const auto& syn_sources : thread_sources )
+    {
+      bytes += syn_sources.capacity() * sizeof( Source );
+    }
+  }
+
+  for ( const auto& thread_compressible_sources : compressible_sources_ )
+  {
+    bytes += thread_compressible_sources.capacity() * sizeof( std::map< size_t, SpikeData > );
+    for ( const auto& syn_map : thread_compressible_sources )
+    {
+      bytes += syn_map.size() * ( sizeof( std::pair< const size_t, SpikeData > ) + map_node_overhead );
+    }
+  }
+
+  for ( const auto& syn_map : compressed_spike_data_map_ )
+  {
+    bytes += syn_map.size() * ( sizeof( std::pair< const size_t, CSDMapEntry > ) + map_node_overhead );
+  }
+
+  return bytes;
+}
+
 bool
 nest::SourceTable::is_cleared() const
 {
@@ -208,6 +208,11 @@ public:
    */
   void finalize();
 
+  /**
+   * Returns an estimate of the number of bytes allocated by this table.
+   */
+  size_t get_memory_size() const;
+
   /**
    * Adds a source to sources_.
    */
@@ -22,6 +22,9 @@
 
 #include "sparse_node_array.h"
 
+// C++ includes:
+#include <algorithm>
+
 // Includes from nestkernel:
 #include "exceptions.h"
 #include "kernel_manager.h"
@@ -148,6 +151,16 @@ nest::SparseNodeArray::get_node_by_node_id( size_t node_id ) const
   const size_t base_idx = left_side ? 0 : split_idx_;
   const size_t base_id = left_side ? local_min_node_id_ : split_node_id_;
 
+  // Scaled estimates are only reliable if nodes are placed round robin, otherwise search the sorted array.
+  if ( not kernel().vp_manager.has_round_robin_placement() )
+  {
+    const auto it = std::lower_bound( nodes_.begin(),
+      nodes_.end(),
+      node_id,
+      []( const NodeEntry& entry, const size_t id ) { return entry.node_id_ < id; } );
+    return it != nodes_.end() and it->node_id_ == node_id ? it->node_ : nullptr;
+  }
+
   // estimate index, limit to array size for safety size
   auto idx =
     std::min( static_cast< size_t >( base_idx + std::floor( scale * ( node_id - base_id ) ) ), nodes_.size() - 1 );
@@ -102,17 +102,25 @@ class SpikeData
 protected:
   static constexpr int MAX_LAG = generate_max_value( NUM_BITS_LAG );
 
-  size_t lcid_ : NUM_BITS_LCID;                       //!< local connection index
-  unsigned int marker_ : NUM_BITS_MARKER_SPIKE_DATA;  //!< status flag
-  unsigned int flush_event_ : NUM_BITS_FLUSH_EVENT;   //!< flush event flag
-  unsigned int lag_ : NUM_BITS_LAG;                   //!< lag in this min-delay interval
-  unsigned int tid_ : NUM_BITS_TID;                   //!< thread index
-  synindex syn_id_ : NUM_BITS_SYN_ID;                 //!< synapse-type index
+  size_t lcid_ : NUM_BITS_LCID;                        //!< local connection index
+  unsigned int marker_ : NUM_BITS_MARKER_SPIKE_DATA;   //!< status flag
+  unsigned int flush_event_ : NUM_BITS_FLUSH_EVENT;    //!< flush event flag
+  unsigned int multiplicity_ : NUM_BITS_MULTIPLICITY;  //!< multiplicity of spike minus one
+  unsigned int lag_ : NUM_BITS_LAG;                    //!< lag in this min-delay interval
+  unsigned int tid_ : NUM_BITS_TID;                    //!< thread index
+  synindex syn_id_ : NUM_BITS_SYN_ID;                  //!< synapse-type index
 
 public:
+  /**
+   * Largest multiplicity a single entry can carry.
+   *
+   * Spikes with larger multiplicity are split over several entries, see EventDeliveryManager::send_remote().
+   */
+  static constexpr size_t MAX_MULTIPLICITY = generate_max_value( NUM_BITS_MULTIPLICITY ) + 1;
+
   SpikeData();
   SpikeData( const SpikeData& rhs );
-  SpikeData( const Target& target, const size_t lag, const bool is_flush_event );
+  SpikeData( const Target& target, const size_t lag, const bool is_flush_event, const size_t multiplicity = 1 );
   SpikeData( const size_t tid, const synindex syn_id, const size_t lcid, const unsigned int lag );
 
   SpikeData& operator=( const SpikeData& rhs );
@@ -145,6 +153,16 @@ public:
    */
   size_t get_tid() const;
 
+  /**
+   * Returns multiplicity of spike.
+   */
+  size_t get_multiplicity() const;
+
+  /**
+   * Sets multiplicity of spike, must be in [1, MAX_MULTIPLICITY].
+   */
+  void set_multiplicity( const size_t multiplicity );
+
   /**
    * Returns synapse-type index.
    */
@@ -213,6 +231,7 @@ inline SpikeData::SpikeData()
   : lcid_( 0 )
   , marker_( SPIKE_DATA_ID_DEFAULT )
   , flush_event_( FLUSH_EVENT_FALSE )
+  , multiplicity_( 0 )
   , lag_( 0 )
   , tid_( 0 )
   , syn_id_( 0 )
@@ -223,16 +242,21 @@ inline SpikeData::SpikeData( const SpikeData& rhs )
   : lcid_( rhs.lcid_ )
   , marker_( rhs.marker_ )
   , flush_event_( rhs.flush_event_ )
+  , multiplicity_( rhs.multiplicity_ )
   , lag_( rhs.lag_ )
   , tid_( rhs.tid_ )
   , syn_id_( rhs.syn_id_ )
 {
 }
 
-inline SpikeData::SpikeData( const Target& target, const size_t lag, const bool is_flush_event )
+inline SpikeData::SpikeData( const Target& target,
+  const size_t lag,
+  const bool is_flush_event,
+  const size_t multiplicity )
   : lcid_( target.get_lcid() )
   , marker_( SPIKE_DATA_ID_DEFAULT )
   , flush_event_( FLUSH_EVENT_FALSE )
+  , multiplicity_( multiplicity - 1 )
   , lag_( lag )
   , tid_( target.get_tid() )
   , syn_id_( target.get_syn_id() )
@@ -247,6 +271,7 @@ inline SpikeData::SpikeData( const size_t tid, const synindex syn_id, const size
   : lcid_( lcid )
   , marker_( SPIKE_DATA_ID_DEFAULT )
   , flush_event_( FLUSH_EVENT_FALSE )
+  , multiplicity_( 0 )
   , lag_( lag )
   , tid_( tid )
   , syn_id_( syn_id )
@@ -259,6 +284,7 @@ SpikeData::operator=( const SpikeData& rhs )
   lcid_ = rhs.lcid_;
   marker_ = rhs.marker_;
   flush_event_ = rhs.flush_event_;
+  multiplicity_ = rhs.multiplicity_;
   lag_ = rhs.lag_;
   tid_ = rhs.tid_;
   syn_id_ = rhs.syn_id_;
@@ -275,6 +301,7 @@ SpikeData::set( const size_t tid, const synindex syn_id, const size_t lcid, cons
 
   lcid_ = lcid;
   marker_ = SPIKE_DATA_ID_DEFAULT;
+  multiplicity_ = 0;
   lag_ = lag;
   tid_ = tid;
   syn_id_ = syn_id;
@@ -289,6 +316,7 @@ SpikeData::set( const TargetT& target, const unsigned int lag )
   assert( lag < MAX_LAG );
   lcid_ = target.get_lcid();
   marker_ = SPIKE_DATA_ID_DEFAULT;
+  multiplicity_ = 0;
   lag_ = lag;
   tid_ = target.get_tid();
   syn_id_ = target.get_syn_id();
@@ -319,6 +347,19 @@ SpikeData::get_tid() const
   return tid_;
 }
 
+inline size_t
+SpikeData::get_multiplicity() const
+{
+  return multiplicity_ + 1;
+}
+
+inline void
+SpikeData::set_multiplicity( const size_t multiplicity )
+{
+  assert( 1 <= multiplicity and multiplicity <= MAX_MULTIPLICITY );
+  multiplicity_ = multiplicity - 1;
+}
+
 inline synindex
 SpikeData::get_syn_id() const
 {
@@ -398,7 +439,7 @@ private:
 
 public:
   OffGridSpikeData();
-  OffGridSpikeData( const Target& target, const size_t lag, const double offset );
+  OffGridSpikeData( const Target& target, const size_t lag, const double offset, const size_t multiplicity = 1 );
   OffGridSpikeData( const size_t tid,
     const synindex syn_id,
     const size_t lcid,
@@ -423,8 +464,11 @@ inline OffGridSpikeData::OffGridSpikeData()
 {
 }
 
-inline OffGridSpikeData::OffGridSpikeData( const Target& target, const size_t lag, const double offset )
-  : SpikeData( target, lag, false )
+inline OffGridSpikeData::OffGridSpikeData( const Target& target,
+  const size_t lag,
+  const double offset,
+  const size_t multiplicity )
+  : SpikeData( target, lag, false, multiplicity )
   , offset_( offset )
 {
 }
@@ -450,6 +494,7 @@ OffGridSpikeData::operator=( const OffGridSpikeData& rhs )
 {
   lcid_ = rhs.lcid_;
   marker_ = rhs.marker_;
+  multiplicity_ = rhs.multiplicity_;
   lag_ = rhs.lag_;
   tid_ = rhs.tid_;
   syn_id_ = rhs.syn_id_;
@@ -464,6 +509,7 @@ OffGridSpikeData::operator=( const SpikeData& rhs )
   // see example in https://en.cppreference.com/w/cpp/language/access.
   lcid_ = rhs.get_lcid();
   marker_ = rhs.get_marker();
+  multiplicity_ = rhs.get_multiplicity() - 1;
   lag_ = rhs.get_lag();
   tid_ = rhs.get_tid();
   syn_id_ = rhs.get_syn_id();
@@ -485,6 +531,7 @@ OffGridSpikeData::set( const size_t tid,
 
   lcid_ = lcid;
   marker_ = SPIKE_DATA_ID_DEFAULT;
+  multiplicity_ = 0;
   lag_ = lag;
   tid_ = tid;
   syn_id_ = syn_id;
@@ -514,15 +561,18 @@ OffGridSpikeData::get_offset() const
  */
 struct SpikeDataWithRank
 {
-  SpikeDataWithRank( const Target& target, const size_t lag, const bool is_flush_event );
+  SpikeDataWithRank( const Target& target, const size_t lag, const bool is_flush_event, const size_t multiplicity );
 
   const size_t rank;           //!< rank of target neuron
   const SpikeData spike_data;  //! data on spike transmitted
 };
 
-inline SpikeDataWithRank::SpikeDataWithRank( const Target& target, const size_t lag, const bool is_flush_event )
+inline SpikeDataWithRank::SpikeDataWithRank( const Target& target,
+  const size_t lag,
+  const bool is_flush_event,
+  const size_t multiplicity )
   : rank( target.get_rank() )
-  , spike_data( target, lag, is_flush_event )
+  , spike_data( target, lag, is_flush_event, multiplicity )
 {
 }
 
@@ -533,15 +583,18 @@ inline SpikeDataWithRank::SpikeDataWithRank( const Target& target, const size_t
  */
 struct OffGridSpikeDataWithRank
 {
-  OffGridSpikeDataWithRank( const Target& target, const size_t lag, const double offset );
+  OffGridSpikeDataWithRank( const Target& target, const size_t lag, const double offset, const size_t multiplicity );
 
   const size_t rank;                  //!< rank of target neuron
   const OffGridSpikeData spike_data;  //! data on spike transmitted
 };
 
-inline OffGridSpikeDataWithRank::OffGridSpikeDataWithRank( const Target& target, const size_t lag, const double offset )
+inline OffGridSpikeDataWithRank::OffGridSpikeDataWithRank( const Target& target,
+  const size_t lag,
+  const double offset,
+  const size_t multiplicity )
   : rank( target.get_rank() )
-  , spike_data( target, lag, offset )
+  , spike_data( target, lag, offset, multiplicity )
 {
 }
 
@@ -0,0 +1,195 @@
+/*
+ *  spike_train_file.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "spike_train_file.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <iterator>
+
+// C includes:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "exceptions.h"
+
+const uint32_t nest::SpikeTrainFile::SPIKE_TRAIN_FILE_VERSION = 1;
+
+std::map< nest::SpikeTrainFile::FileId, std::weak_ptr< const nest::SpikeTrainFile > > nest::SpikeTrainFile::open_files_;
+
+namespace
+{
+const char SPIKE_TRAIN_FILE_MAGIC[ 8 ] = { 'N', 'E', 'S', 'T', 'S', 'P', 'K', '\0' };
+const uint32_t SPIKE_TRAIN_FILE_BOM = 0x01020304;
+
+//! Size of the header, which keeps the records aligned to 8 bytes
+const size_t SPIKE_TRAIN_FILE_HEADER_SIZE = 8 + 2 * sizeof( uint32_t ) + sizeof( uint64_t );
+}
+
+std::shared_ptr< const nest::SpikeTrainFile >
+nest::SpikeTrainFile::open( const std::string& filename )
+{
+  const int fd = ::open( filename.c_str(), O_RDONLY );
+  if ( fd < 0 )
+  {
+    throw BadProperty( String::compose( "Cannot open spike train file '%1': %2", filename, std::strerror( errno ) ) );
+  }
+
+  struct stat file_stat;
+  if ( fstat( fd, &file_stat ) != 0 or static_cast< size_t >( file_stat.st_size ) < SPIKE_TRAIN_FILE_HEADER_SIZE )
+  {
+    ::close( fd );
+    throw BadProperty( String::compose( "'%1' is not a spike train file.", filename ) );
+  }
+
+  // a file replaced under the same name gets a new entry, while devices keep using the mapping of the old file
+  const FileId file_id( file_stat.st_dev, file_stat.st_ino, file_stat.st_mtime, file_stat.st_size );
+
+  std::shared_ptr< const SpikeTrainFile > file;
+  std::exception_ptr error;
+
+  // devices on all threads may open files at the same time
+#pragma omp critical( spike_train_file_open )
+  {
+    file = open_files_[ file_id ].lock();
+    if ( not file )
+    {
+      try
+      {
+        file.reset( new SpikeTrainFile( filename, fd, file_stat.st_size ) );
+        open_files_[ file_id ] = file;
+      }
+      catch ( ... )
+      {
+        open_files_.erase( file_id );
+        error = std::current_exception();
+      }
+    }
+
+    // forget files that are no longer in use
+    for ( auto it = open_files_.begin(); it != open_files_.end(); )
+    {
+      it = it->second.expired() ? open_files_.erase( it ) : std::next( it );
+    }
+  }
+
+  // the mapping remains valid after closing the file
+  ::close( fd );
+
+  if ( error )
+  {
+    std::rethrow_exception( error );
+  }
+
+  return file;
+}
+
+nest::SpikeTrainFile::SpikeTrainFile( const std::string& filename, const int fd, const size_t size )
+  : filename_( filename )
+  , data_( nullptr )
+  , mapped_size_( size )
+  , spikes_( nullptr )
+  , num_spikes_( 0 )
+{
+  data_ = mmap( nullptr, mapped_size_, PROT_READ, MAP_SHARED, fd, 0 );
+  if ( data_ == MAP_FAILED )
+  {
+    data_ = nullptr;
+    throw BadProperty( String::compose( "Cannot map spike train file '%1': %2", filename, std::strerror( errno ) ) );
+  }
+
+  const char* header = static_cast< const char* >( data_ );
+  uint32_t version;
+  uint32_t bom;
+  uint64_t num_spikes;
+  std::memcpy( &version, header + 8, sizeof( version ) );
+  std::memcpy( &bom, header + 12, sizeof( bom ) );
+  std::memcpy( &num_spikes, header + 16, sizeof( num_spikes ) );
+
+  std::string error;
+  if ( std::memcmp( header, SPIKE_TRAIN_FILE_MAGIC, sizeof( SPIKE_TRAIN_FILE_MAGIC ) ) != 0 )
+  {
+    error = String::compose( "'%1' is not a spike train file.", filename );
+  }
+  else if ( bom != SPIKE_TRAIN_FILE_BOM )
+  {
+    error = String::compose( "Spike train file '%1' was written with a different byte order.", filename );
+  }
+  else if ( version != SPIKE_TRAIN_FILE_VERSION )
+  {
+    error = String::compose( "Spike train file '%1' has unsupported format version %2.", filename, version );
+  }
+  // compare the number of spikes first, so that the size computed from it cannot overflow
+  else if ( num_spikes > ( mapped_size_ - SPIKE_TRAIN_FILE_HEADER_SIZE ) / sizeof( Spike )
+    or mapped_size_ != SPIKE_TRAIN_FILE_HEADER_SIZE + num_spikes * sizeof( Spike ) )
+  {
+    error = String::compose( "Size of spike train file '%1' does not match its number of spikes.", filename );
+  }
+  else
+  {
+    // devices look up the spikes of their sender by bisection
+    const Spike* spikes = reinterpret_cast< const Spike* >( header + SPIKE_TRAIN_FILE_HEADER_SIZE );
+    const auto unsorted = std::adjacent_find( spikes,
+      spikes + num_spikes,
+      []( const Spike& lhs, const Spike& rhs )
+      { return lhs.sender > rhs.sender or ( lhs.sender == rhs.sender and lhs.time > rhs.time ); } );
+    if ( unsorted != spikes + num_spikes )
+    {
+      error = String::compose( "Records in spike train file '%1' must be sorted by sender and time.", filename );
+    }
+  }
+  if ( not error.empty() )
+  {
+    munmap( data_, mapped_size_ );
+    throw BadProperty( error );
+  }
+
+  spikes_ = reinterpret_cast< const Spike* >( header + SPIKE_TRAIN_FILE_HEADER_SIZE );
+  num_spikes_ = num_spikes;
+}
+
+nest::SpikeTrainFile::~SpikeTrainFile()
+{
+  if ( data_ )
+  {
+    munmap( data_, mapped_size_ );
+  }
+}
+
+void
+nest::SpikeTrainFile::get_spikes( const uint64_t sender, const Spike*& begin, const Spike*& end ) const
+{
+  begin = std::lower_bound(
+    spikes_, spikes_ + num_spikes_, sender, []( const Spike& spike, const uint64_t s ) { return spike.sender < s; } );
+  end = std::upper_bound(
+    begin, spikes_ + num_spikes_, sender, []( const uint64_t s, const Spike& spike ) { return s < spike.sender; } );
+}
@@ -0,0 +1,131 @@
+/*
+ *  spike_train_file.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef SPIKE_TRAIN_FILE_H
+#define SPIKE_TRAIN_FILE_H
+
+// C++ includes:
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+
+namespace nest
+{
+
+/**
+ * Read-only view of a binary file of spike trains, mapped into memory.
+ *
+ * Spike generators reading their spike times from a file do not keep
+ * copies of the spike times. Instead, all devices reading from the same
+ * file share one mapping, and the operating system loads the parts of
+ * the file that are needed. Files are written with
+ * ``nest.write_spike_train_file()``.
+ *
+ * All numbers are stored in the native byte order of the machine. A file
+ * starts with a header:
+ *
+ * ==========================  ==============================================
+ * Field                       Content
+ * ==========================  ==============================================
+ * magic                       8 bytes ``NESTSPK`` followed by a zero byte
+ * version                     uint32, version of the format (currently 1)
+ * byte order mark             uint32, ``0x01020304`` in the writer's order
+ * number of spikes            uint64, :math:`n`
+ * ==========================  ==============================================
+ *
+ * The header is followed by :math:`n` records, each consisting of the
+ * sender as uint64 and the spike time in ms as float64. Records are
+ * sorted by sender and, for each sender, by time.
+ */
+class SpikeTrainFile
+{
+public:
+  //! Record of one spike in the file
+  struct Spike
+  {
+    uint64_t sender;
+    double time;  //!< in ms
+  };
+
+  /**
+   * Return the mapping of the given file, mapping it if it is not yet in use.
+   *
+   * Mappings are shared as long as the file is not replaced or modified.
+   * Files should be replaced by renaming a new file into place, as
+   * ``nest.write_spike_train_file()`` does, so that existing mappings
+   * remain valid.
+   *
+   * @throws BadProperty if the file cannot be mapped, is not a spike train
+   *         file or its records are not sorted by sender and time
+   */
+  static std::shared_ptr< const SpikeTrainFile > open( const std::string& filename );
+
+  SpikeTrainFile( const SpikeTrainFile& ) = delete;
+  SpikeTrainFile& operator=( const SpikeTrainFile& ) = delete;
+  ~SpikeTrainFile();
+
+  const std::string&
+  get_filename() const
+  {
+    return filename_;
+  }
+
+  //! Return number of spikes in the file
+  size_t
+  size() const
+  {
+    return num_spikes_;
+  }
+
+  /**
+   * Find the spikes of one sender.
+   *
+   * Sets begin and end to the range of records of the sender, which is
+   * empty if the file contains no spikes of the sender.
+   */
+  void get_spikes( const uint64_t sender, const Spike*& begin, const Spike*& end ) const;
+
+  const static uint32_t SPIKE_TRAIN_FILE_VERSION;
+
+private:
+  SpikeTrainFile( const std::string& filename, const int fd, const size_t size );
+
+  //! Identifies a version of a file by device, inode, modification time and size
+  typedef std::tuple< uint64_t, uint64_t, int64_t, uint64_t > FileId;
+
+  std::string filename_;
+  void* data_;          //!< start of the mapping
+  size_t mapped_size_;  //!< size of the mapping in bytes
+  const Spike* spikes_;
+  size_t num_spikes_;
+
+  //! All files currently mapped, shared by all devices reading from them
+  static std::map< FileId, std::weak_ptr< const SpikeTrainFile > > open_files_;
+};
+
+}  // namespace nest
+
+#endif /* SPIKE_TRAIN_FILE_H */
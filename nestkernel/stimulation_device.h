@@ -180,6 +180,12 @@ public:
   //! Throws IllegalConnection if synapse id differs from initial synapse id
   void enforce_single_syn_type( synindex );
 
+  /**
+   * Connection checks of stimulation devices register the synapse type of each instance with
+   * enforce_single_syn_type(). They must run for every device, including those with proxies.
+   */
+  static constexpr bool has_cacheable_connection_checks = false;
+
   /**
    * Device type.
    */
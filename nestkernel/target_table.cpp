@@ -49,6 +49,12 @@ nest::TargetTable::finalize()
   std::vector< std::vector< std::vector< std::vector< size_t > > > >().swap( secondary_send_buffer_pos_ );
 }
 
+size_t
+nest::TargetTable::get_memory_size() const
+{
+  return vector_util::memory_size( targets_ ) + vector_util::memory_size( secondary_send_buffer_pos_ );
+}
+
 void
 nest::TargetTable::prepare( const size_t tid )
 {
@@ -79,6 +79,11 @@ public:
    */
   void finalize();
 
+  /**
+   * Returns an estimate of the number of bytes allocated by this table.
+   */
+  size_t get_memory_size() const;
+
   /**
    * Adjusts targets_ to number of local nodes.
    */
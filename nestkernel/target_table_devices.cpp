@@ -20,6 +20,9 @@
  *
  */
 
+// Includes from libnestutil:
+#include "vector_util.h"
+
 // Includes from nestkernel:
 #include "connector_base.h"
 #include "kernel_manager.h"
@@ -73,6 +76,43 @@ nest::TargetTableDevices::finalize()
   std::vector< std::vector< size_t > >().swap( sending_devices_node_ids_ );
 }
 
+size_t
+nest::TargetTableDevices::get_memory_size() const
+{
+  size_t bytes = vector_util::memory_size( target_to_devices_ ) + vector_util::memory_size( target_from_devices_ )
+    + vector_util::memory_size( sending_devices_node_ids_ );
+
+  for ( const auto& thread_connectors : target_to_devices_ )
+  {
+    for ( const auto& node_connectors : thread_connectors )
+    {
+      for ( const ConnectorBase* connector : node_connectors )
+      {
+        if ( connector )
+        {
+          bytes += connector->get_memory_size();
+        }
+      }
+    }
+  }
+
+  for ( const auto& thread_connectors : target_from_devices_ )
+  {
+    for ( const auto& node_connectors : thread_connectors )
+    {
+      for ( const ConnectorBase* connector : node_connectors )
+      {
+        if ( connector )
+        {
+          bytes += connector->get_memory_size();
+        }
+      }
+    }
+  }
+
+  return bytes;
+}
+
 void
 nest::TargetTableDevices::resize_to_number_of_neurons()
 {
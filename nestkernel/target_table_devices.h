@@ -74,6 +74,11 @@ public:
    */
   void finalize();
 
+  /**
+   * Returns an estimate of the number of bytes allocated by this table.
+   */
+  size_t get_memory_size() const;
+
   /**
    * Adds a connection from the neuron source to the device target.
    */
@@ -156,6 +156,9 @@ public:
    */
   void record_data( long );
 
+  //! Return true if at least one multimeter is connected to the logger
+  bool has_logging_devices() const;
+
   //! Erase all existing data
   void reset();
 
@@ -23,9 +23,13 @@
 #include "vp_manager.h"
 
 // C++ includes:
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <string>
 
 // Includes from libnestutil:
+#include "compose.hpp"
 #include "logging.h"
 
 // Includes from nestkernel:
@@ -42,6 +46,7 @@ nest::VPManager::VPManager()
   : force_singlethreading_( true )
 #endif
   , n_threads_( 1 )
+  , node_placement_( NodePlacement::ROUND_ROBIN )
 {
 }
 
@@ -53,6 +58,9 @@ nest::VPManager::initialize( const bool adjust_number_of_threads_or_rng_only )
     return;
   }
 
+  node_placement_ = NodePlacement::ROUND_ROBIN;
+  placement_ranges_.clear();
+
 // When the VPManager is initialized, you will have 1 thread again.
 // Setting more threads will be done via nest::set_kernel_status
 #ifdef _OPENMP
@@ -97,6 +105,24 @@ nest::VPManager::get_OMP_NUM_THREADS() const
 void
 nest::VPManager::set_status( const Dictionary& d )
 {
+  std::string node_placement;
+  if ( d.update_value( names::node_placement, node_placement ) )
+  {
+    if ( node_placement == "round_robin" )
+    {
+      node_placement_ = NodePlacement::ROUND_ROBIN;
+    }
+    else if ( node_placement == "block" )
+    {
+      node_placement_ = NodePlacement::BLOCK;
+    }
+    else
+    {
+      throw BadProperty(
+        String::compose( "'%1' is not a known node placement, use 'round_robin' or 'block'.", node_placement ) );
+    }
+  }
+
   size_t n_threads = get_num_threads();
   size_t n_vps = get_num_virtual_processes();
 
@@ -179,6 +205,92 @@ nest::VPManager::get_status( Dictionary& d )
 {
   d[ names::local_num_threads ] = static_cast< long >( get_num_threads() );
   d[ names::total_num_virtual_procs ] = static_cast< long >( get_num_virtual_processes() );
+  d[ names::node_placement ] = std::string( node_placement_ == NodePlacement::BLOCK ? "block" : "round_robin" );
+}
+
+void
+nest::VPManager::add_node_range( const size_t first_node_id, const size_t last_node_id, const bool has_proxies )
+{
+  const size_t num_vps = get_num_virtual_processes();
+  const bool block = has_proxies and node_placement_ == NodePlacement::BLOCK and num_vps > 1;
+
+  // As long as all nodes are placed round robin, no table is needed
+  if ( placement_ranges_.empty() and not block )
+  {
+    return;
+  }
+
+  // Nodes created before the first block placement are covered by a round-robin range starting at node ID 1
+  if ( placement_ranges_.empty() and first_node_id > 1 )
+  {
+    placement_ranges_.push_back(
+      { 1, first_node_id - 1, NodePlacement::ROUND_ROBIN, std::vector< size_t >( num_vps, 0 ) } );
+  }
+
+  if ( not block and not placement_ranges_.empty()
+    and placement_ranges_.back().placement == NodePlacement::ROUND_ROBIN )
+  {
+    assert( placement_ranges_.back().last_node_id + 1 == first_node_id );
+    placement_ranges_.back().last_node_id = last_node_id;
+    return;
+  }
+
+  NodePlacementRange range { first_node_id,
+    last_node_id,
+    block ? NodePlacement::BLOCK : NodePlacement::ROUND_ROBIN,
+    std::vector< size_t >( num_vps, 0 ) };
+  if ( not placement_ranges_.empty() )
+  {
+    const NodePlacementRange& previous = placement_ranges_.back();
+    assert( previous.last_node_id + 1 == first_node_id );
+    for ( size_t vp = 0; vp < num_vps; ++vp )
+    {
+      range.lid_offsets[ vp ] = previous.lid_offsets[ vp ] + previous.num_nodes_on_vp( vp );
+    }
+  }
+  placement_ranges_.push_back( std::move( range ) );
+}
+
+bool
+nest::VPManager::is_block_placed( const size_t node_id ) const
+{
+  return not placement_ranges_.empty() and node_id >= placement_ranges_.front().first_node_id
+    and find_placement_range_( node_id ).placement == NodePlacement::BLOCK;
+}
+
+nest::VPNodeIDs
+nest::VPManager::get_node_ids_on_vp( const size_t first_node_id, const size_t last_node_id, const size_t vp ) const
+{
+  if ( is_block_placed( first_node_id ) )
+  {
+    const NodePlacementRange& range = find_placement_range_( first_node_id );
+    assert( range.first_node_id == first_node_id and range.last_node_id == last_node_id );
+
+    const size_t block_first = range.block_begin( range.vp_to_block( vp ) );
+    return { block_first, block_first + range.num_nodes_on_vp( vp ) - 1, 1 };
+  }
+
+  const size_t num_vps = get_num_virtual_processes();
+  return { first_node_id + ( num_vps + vp - first_node_id % num_vps ) % num_vps, last_node_id, num_vps };
+}
+
+size_t
+nest::VPManager::get_max_num_nodes_per_vp( const size_t max_node_id ) const
+{
+  if ( placement_ranges_.empty() )
+  {
+    return std::ceil( static_cast< double >( max_node_id ) / get_num_virtual_processes() );
+  }
+
+  const NodePlacementRange& last_range = placement_ranges_.back();
+  assert( last_range.last_node_id == max_node_id );
+
+  size_t max_num_nodes = 0;
+  for ( size_t vp = 0; vp < get_num_virtual_processes(); ++vp )
+  {
+    max_num_nodes = std::max( max_num_nodes, last_range.lid_offsets[ vp ] + last_range.num_nodes_on_vp( vp ) );
+  }
+  return max_num_nodes;
 }
 
 void
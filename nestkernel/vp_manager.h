@@ -23,6 +23,9 @@
 #ifndef VP_MANAGER_H
 #define VP_MANAGER_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from libnestutil:
 #include "manager_interface.h"
 
@@ -46,6 +49,60 @@ struct AssignedRanks
   size_t max_size;
 };
 
+/**
+ * Policy for distributing newly created nodes with proxies over virtual processes.
+ *
+ * - ROUND_ROBIN: node with ID `node_id` is placed on VP `node_id % num_vps`
+ * - BLOCK: the nodes of one call to Create are split into contiguous blocks of (almost) equal size,
+ *          consecutive blocks are placed on the threads of one rank before moving on to the next rank
+ */
+enum class NodePlacement
+{
+  ROUND_ROBIN,
+  BLOCK
+};
+
+/**
+ * Node IDs placed on a given VP: first, first + step, ..., last.
+ *
+ * The set is empty if first > last.
+ */
+struct VPNodeIDs
+{
+  size_t first;
+  size_t last;
+  size_t step;
+};
+
+/**
+ * Contiguous range of node IDs sharing the same placement policy.
+ *
+ * Used by VPManager to map node IDs to VPs and local indices once nodes have been placed by
+ * a policy other than round robin.
+ */
+struct NodePlacementRange
+{
+  size_t first_node_id;
+  size_t last_node_id;
+  NodePlacement placement;
+  std::vector< size_t > lid_offsets;  //!< for each VP, number of nodes placed on VP in preceding ranges
+
+  //! Number of nodes of this range placed on given VP
+  size_t num_nodes_on_vp( const size_t vp ) const;
+
+  //! Index of block on given VP for block placement
+  size_t vp_to_block( const size_t vp ) const;
+
+  //! VP for block with given index for block placement
+  size_t block_to_vp( const size_t block ) const;
+
+  //! Index of block containing node for block placement
+  size_t node_id_to_block( const size_t node_id ) const;
+
+  //! Node ID of first node in block for block placement
+  size_t block_begin( const size_t block ) const;
+};
+
 class VPManager : public ManagerInterface
 {
 public:
@@ -60,6 +117,36 @@ public:
   virtual void set_status( const Dictionary& ) override;
   virtual void get_status( Dictionary& ) override;
 
+  /**
+   * Record placement of a new range of nodes created by a single call to Create.
+   *
+   * Nodes with proxies are placed according to the current node placement policy, all other nodes round robin.
+   * Must be called before any node of the range is created.
+   */
+  void add_node_range( const size_t first_node_id, const size_t last_node_id, const bool has_proxies );
+
+  /**
+   * Returns true if all nodes are placed round robin.
+   *
+   * In this case, node IDs can be mapped to VPs and local indices by simple modular arithmetic.
+   */
+  bool has_round_robin_placement() const;
+
+  /**
+   * Returns true if the given node has been placed by block placement.
+   */
+  bool is_block_placed( const size_t node_id ) const;
+
+  /**
+   * Returns node IDs placed on a VP from a range created by a single call to Create.
+   */
+  VPNodeIDs get_node_ids_on_vp( const size_t first_node_id, const size_t last_node_id, const size_t vp ) const;
+
+  /**
+   * Returns the largest number of nodes placed on any VP.
+   */
+  size_t get_max_num_nodes_per_vp( const size_t max_node_id ) const;
+
   /**
    * Gets ID of local thread.
    * Returns thread ID if OpenMP is installed
@@ -109,13 +196,11 @@ public:
   size_t get_vp() const;
 
   /**
-   * Return a thread number for a given global node id.
+   * Return a virtual process for a given global node id.
    *
-   * Each node has a default thread on which it will run.
-   * The thread is defined by the relation:
-   * t = (node_id div P) mod T, where P is the number of simulation processes and
-   * T the number of threads. This may be used by Network::add_node()
-   * if the user has not specified anything.
+   * Nodes placed round robin are on VP `node_id % num_vps`. For other
+   * placement policies, the VP is looked up in the range table set up
+   * by add_node_range().
    */
   size_t node_id_to_vp( const size_t node_id ) const;
 
@@ -168,8 +253,21 @@ public:
   AssignedRanks get_assigned_ranks( const size_t tid );
 
 private:
+  //! Returns range containing node ID, requires that placement_ranges_ is not empty
+  const NodePlacementRange& find_placement_range_( const size_t node_id ) const;
+
   const bool force_singlethreading_;
   size_t n_threads_;  //!< Number of threads per process.
+
+  NodePlacement node_placement_;  //!< Placement policy applied to nodes created next
+
+  /**
+   * Placement of all nodes, sorted by node ID.
+   *
+   * Empty as long as all nodes are placed round robin, so that lookups in this case
+   * need no table.
+   */
+  std::vector< NodePlacementRange > placement_ranges_;
 };
 }
 
@@ -189,6 +287,12 @@ nest::VPManager::get_num_threads() const
   return n_threads_;
 }
 
+inline bool
+nest::VPManager::has_round_robin_placement() const
+{
+  return placement_ranges_.empty();
+}
+
 inline void
 nest::VPManager::assert_single_threaded() const
 {
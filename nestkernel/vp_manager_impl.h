@@ -25,6 +25,10 @@
 
 #include "vp_manager.h"
 
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+
 // Includes from nestkernel:
 #include "kernel_manager.h"
 #include "mpi_manager.h"
@@ -39,10 +43,91 @@ VPManager::get_vp() const
   return kernel().mpi_manager.get_rank() + get_thread_id() * kernel().mpi_manager.get_num_processes();
 }
 
+inline size_t
+NodePlacementRange::num_nodes_on_vp( const size_t vp ) const
+{
+  const size_t num_vps = lid_offsets.size();
+  if ( placement == NodePlacement::ROUND_ROBIN )
+  {
+    // Number of node IDs in [1, n] on vp, n may be zero
+    const auto count_up_to = [ num_vps, vp ]( const size_t n )
+    { return n < vp ? 0 : ( n - vp ) / num_vps + static_cast< size_t >( vp > 0 ); };
+    return count_up_to( last_node_id ) - count_up_to( first_node_id - 1 );
+  }
+
+  const size_t num_nodes = last_node_id - first_node_id + 1;
+  const size_t block = vp_to_block( vp );
+  return num_nodes / num_vps + static_cast< size_t >( block < num_nodes % num_vps );
+}
+
+inline size_t
+NodePlacementRange::vp_to_block( const size_t vp ) const
+{
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  const size_t num_threads = lid_offsets.size() / num_processes;
+  return ( vp % num_processes ) * num_threads + vp / num_processes;
+}
+
+inline size_t
+NodePlacementRange::block_to_vp( const size_t block ) const
+{
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  const size_t num_threads = lid_offsets.size() / num_processes;
+  return ( block % num_threads ) * num_processes + block / num_threads;
+}
+
+inline size_t
+NodePlacementRange::node_id_to_block( const size_t node_id ) const
+{
+  const size_t num_vps = lid_offsets.size();
+  const size_t num_nodes = last_node_id - first_node_id + 1;
+  const size_t small_block_size = num_nodes / num_vps;
+  const size_t num_large_blocks = num_nodes % num_vps;  // large blocks contain one more node and come first
+
+  const size_t idx = node_id - first_node_id;
+  if ( idx < num_large_blocks * ( small_block_size + 1 ) )
+  {
+    return idx / ( small_block_size + 1 );
+  }
+  return num_large_blocks + ( idx - num_large_blocks * ( small_block_size + 1 ) ) / small_block_size;
+}
+
+inline size_t
+NodePlacementRange::block_begin( const size_t block ) const
+{
+  const size_t num_vps = lid_offsets.size();
+  const size_t num_nodes = last_node_id - first_node_id + 1;
+  return first_node_id + block * ( num_nodes / num_vps ) + std::min( block, num_nodes % num_vps );
+}
+
+inline const NodePlacementRange&
+VPManager::find_placement_range_( const size_t node_id ) const
+{
+  assert( not placement_ranges_.empty() );
+
+  // first range starting beyond node_id, the range containing node_id precedes it
+  const auto it = std::upper_bound( placement_ranges_.begin(),
+    placement_ranges_.end(),
+    node_id,
+    []( const size_t id, const NodePlacementRange& range ) { return id < range.first_node_id; } );
+  assert( it != placement_ranges_.begin() );
+  return *( it - 1 );
+}
+
 inline size_t
 VPManager::node_id_to_vp( const size_t node_id ) const
 {
-  return node_id % get_num_virtual_processes();
+  if ( placement_ranges_.empty() or node_id < placement_ranges_.front().first_node_id )
+  {
+    return node_id % get_num_virtual_processes();
+  }
+
+  const NodePlacementRange& range = find_placement_range_( node_id );
+  if ( range.placement == NodePlacement::ROUND_ROBIN )
+  {
+    return node_id % get_num_virtual_processes();
+  }
+  return range.block_to_vp( range.node_id_to_block( node_id ) );
 }
 
 inline size_t
@@ -72,21 +157,58 @@ VPManager::thread_to_vp( const size_t tid ) const
 inline bool
 VPManager::is_node_id_vp_local( const size_t node_id ) const
 {
-  return ( node_id % get_num_virtual_processes() == static_cast< size_t >( get_vp() ) );
+  return node_id_to_vp( node_id ) == get_vp();
 }
 
 inline size_t
 VPManager::node_id_to_lid( const size_t node_id ) const
 {
-  // starts at lid 0 for node_ids >= 1 (expected value for neurons, excl. node ID 0)
-  return std::ceil( static_cast< double >( node_id ) / get_num_virtual_processes() ) - 1;
+  if ( placement_ranges_.empty() or node_id < placement_ranges_.front().first_node_id )
+  {
+    // starts at lid 0 for node_ids >= 1 (expected value for neurons, excl. node ID 0)
+    return std::ceil( static_cast< double >( node_id ) / get_num_virtual_processes() ) - 1;
+  }
+
+  const NodePlacementRange& range = find_placement_range_( node_id );
+  if ( range.placement == NodePlacement::ROUND_ROBIN )
+  {
+    const size_t num_vps = get_num_virtual_processes();
+    const size_t vp = node_id % num_vps;
+    const size_t first_on_vp = range.first_node_id + ( num_vps + vp - range.first_node_id % num_vps ) % num_vps;
+    return range.lid_offsets[ vp ] + ( node_id - first_on_vp ) / num_vps;
+  }
+
+  const size_t block = range.node_id_to_block( node_id );
+  return range.lid_offsets[ range.block_to_vp( block ) ] + node_id - range.block_begin( block );
 }
 
 inline size_t
 VPManager::lid_to_node_id( const size_t lid ) const
 {
   const size_t vp = get_vp();
-  return ( lid + static_cast< size_t >( vp == 0 ) ) * get_num_virtual_processes() + vp;
+  if ( placement_ranges_.empty() or lid < placement_ranges_.front().lid_offsets[ vp ] )
+  {
+    return ( lid + static_cast< size_t >( vp == 0 ) ) * get_num_virtual_processes() + vp;
+  }
+
+  // Ranges with equal offsets on this VP contain no node on this VP, except possibly the last of them
+  const auto it = std::upper_bound( placement_ranges_.begin(),
+    placement_ranges_.end(),
+    lid,
+    [ vp ]( const size_t l, const NodePlacementRange& range ) { return l < range.lid_offsets[ vp ]; } );
+  const NodePlacementRange& range = *( it - 1 );
+  const size_t idx = lid - range.lid_offsets[ vp ];
+  if ( idx >= range.num_nodes_on_vp( vp ) )
+  {
+    return 0;  // lid beyond last node on this VP
+  }
+
+  if ( range.placement == NodePlacement::ROUND_ROBIN )
+  {
+    const size_t num_vps = get_num_virtual_processes();
+    return range.first_node_id + ( num_vps + vp - range.first_node_id % num_vps ) % num_vps + idx * num_vps;
+  }
+  return range.block_begin( range.vp_to_block( vp ) ) + idx;
 }
 
 inline size_t
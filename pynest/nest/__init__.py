@@ -98,6 +98,7 @@ class NestModule(types.ModuleType):
         _rel_import_star(self, ".lib.hl_api_models")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_nodes")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_parallel_computing")  # noqa: F821
+        _rel_import_star(self, ".lib.hl_api_recording")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_simulation")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_sonata")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_spatial")  # noqa: F821
@@ -195,11 +196,28 @@ class NestModule(types.ModuleType):
     total_num_virtual_procs = KernelAttribute("int", "The total number of virtual processes", default=1)
     local_num_threads = KernelAttribute("int", "The local number of threads", default=1)
     num_processes = KernelAttribute("int", "The number of MPI processes", readonly=True)
+    node_placement = KernelAttribute(
+        "str",
+        (
+            "Policy for placing neurons created next on virtual processes, either "
+            + "'round_robin' or 'block'; the latter places contiguous blocks of each "
+            + "population on the same rank"
+        ),
+        default="round_robin",
+    )
     off_grid_spiking = KernelAttribute(
         "bool",
         "Whether to transmit precise spike times in MPI communication",
         readonly=True,
     )
+    overlap_spike_communication = KernelAttribute(
+        "bool",
+        (
+            "Whether to exchange spikes with non-blocking MPI, so that the exchange "
+            + "overlaps with the exchange and delivery of secondary events"
+        ),
+        default=False,
+    )
     adaptive_target_buffers = KernelAttribute(
         "bool",
         "Whether MPI buffers for communication of connections resize on the fly",
@@ -294,6 +312,15 @@ class NestModule(types.ModuleType):
     wfr_interpolation_order = KernelAttribute(
         "int", "Interpolation order of polynomial used in wfr iterations", default=3
     )
+    wfr_incremental_exchange = KernelAttribute(
+        "bool",
+        (
+            "Whether wfr iterations after the first exchange only coefficients that changed since "
+            + "they were last sent, using messages between ranks with gap junctions or rate "
+            + "connections instead of a collective exchange"
+        ),
+        default=False,
+    )
     max_num_syn_models = KernelAttribute("int", "Maximal number of synapse models supported", readonly=True)
     structural_plasticity_synapses = KernelAttribute(
         "dict",
@@ -328,6 +355,15 @@ class NestModule(types.ModuleType):
         ),
         default=True,
     )
+    sort_connections_by_target = KernelAttribute(
+        "bool",
+        (
+            "Whether to order the connections of each source by target when"
+            + " connections are sorted, so that spikes are delivered to targets"
+            + " in order of their node IDs; only used with spike compression"
+        ),
+        default=False,
+    )
     data_path = KernelAttribute(
         "str",
         "A path, where all data is written to, defaults to current directory",
@@ -391,6 +427,29 @@ class NestModule(types.ModuleType):
         "Whether to keep source table after connection setup is complete",
         default=True,
     )
+    spatial_index_cache_budget = KernelAttribute(
+        "float",
+        (
+            "Maximal memory used to cache global positions of spatial layers for "
+            + "connecting, in MB; least recently used positions are dropped first"
+        ),
+        default=1024.0,
+    )
+    spatial_index_cache_memory = KernelAttribute(
+        "float",
+        "Memory currently used to cache global positions of spatial layers, in MB",
+        readonly=True,
+    )
+    spatial_index_cache_hits = KernelAttribute(
+        "int",
+        "Number of times global positions of spatial layers were found in the cache",
+        readonly=True,
+    )
+    spatial_index_cache_misses = KernelAttribute(
+        "int",
+        "Number of times global positions of spatial layers had to be collected",
+        readonly=True,
+    )
     min_update_time = KernelAttribute(
         "float",
         "Shortest wall-clock time measured so far for a full update step [seconds]",
@@ -401,6 +460,15 @@ class NestModule(types.ModuleType):
         "Longest wall-clock time measured so far for a full update step [seconds]",
         readonly=True,
     )
+    update_nodes_in_batches = KernelAttribute(
+        "bool",
+        (
+            "Whether nodes on each thread are updated in runs of consecutive nodes of the same model,"
+            + " which avoids a virtual call per node for models supporting it and holds the state of"
+            + " iaf_psc_alpha, iaf_psc_exp and iaf_psc_delta in arrays during a run, or one by one"
+        ),
+        default=False,
+    )
     update_time_limit = KernelAttribute(
         "float",
         (
@@ -154,6 +154,8 @@ def _process_spatial_projections(conn_spec, syn_spec):
         "pairwise_avg_num_conns",
         "use_on_source",
         "allow_oversized_mask",
+        "kernel_cutoff",
+        "skip_sampling",
     ]
     allowed_syn_spec_keys = ["weight", "delay", "synapse_model", "synapse_label", "receptor_type"]
     for key in conn_spec.keys():
@@ -222,6 +224,8 @@ def _connect_layers_needed(conn_spec, syn_spec):
         rule_is_bernoulli = "pairwise_bernoulli" in str(conn_spec["rule"])
         if "mask" in conn_spec or ("p" in conn_spec and not rule_is_bernoulli) or "use_on_source" in conn_spec:
             return True
+        if "kernel_cutoff" in conn_spec or "skip_sampling" in conn_spec:
+            return True
         rule_is_poisson = "pairwise_poisson" in str(conn_spec["rule"])
         if "mask" in conn_spec or ("pairwise_avg_num_conns" in conn_spec and not rule_is_poisson):
             return True
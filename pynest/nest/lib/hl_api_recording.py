@@ -0,0 +1,197 @@
+# -*- coding: utf-8 -*-
+#
+# hl_api_recording.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Functions for reading data written by recording backends and for writing
+spike trains to be replayed by stimulating devices.
+"""
+
+import os
+import struct
+import tempfile
+
+import numpy as np
+
+__all__ = ["read_binary_recording", "write_spike_train_file"]
+
+
+_BINARY_MAGIC = b"NESTBIN\0"
+_BINARY_VERSION = 2
+_BINARY_BOM = 0x01020304
+
+_SPIKE_TRAIN_MAGIC = b"NESTSPK\0"
+_SPIKE_TRAIN_VERSION = 1
+
+
+def _read_exact(f, num_bytes, filename):
+    data = f.read(num_bytes)
+    if len(data) != num_bytes:
+        raise ValueError(f"Unexpected end of file in '{filename}'.")
+    return data
+
+
+def read_binary_recording(filenames):
+    """Read data written by the ``binary`` recording backend.
+
+    Parameters
+    ----------
+    filenames : str or list of str
+        Name of a file written by the ``binary`` recording backend, or a
+        list of such names, as given by the ``filenames`` property of the
+        recording device. Data from several files are concatenated.
+
+    Returns
+    -------
+    dict:
+        Dictionary with the entries ``senders``, ``times`` (in ms),
+        ``time_steps`` and ``time_offsets``, and one entry for each
+        recorded value, each holding a NumPy array with one element per
+        record.
+
+    Raises
+    ------
+    ValueError
+        If a file is not a valid binary recording, or if the files contain
+        different sets of recorded values.
+    """
+
+    if isinstance(filenames, str):
+        filenames = [filenames]
+
+    columns = None
+    for filename in filenames:
+        file_columns = _read_binary_file(filename)
+        if columns is None:
+            columns = file_columns
+        elif columns.keys() != file_columns.keys():
+            raise ValueError("All files must contain the same recorded values.")
+        else:
+            for name, values in file_columns.items():
+                columns[name].extend(values)
+
+    if columns is None:
+        return {}
+
+    return {name: np.concatenate(chunks) if chunks else np.array([]) for name, chunks in columns.items()}
+
+
+def _read_binary_file(filename):
+    with open(filename, "rb") as f:
+        if _read_exact(f, 8, filename) != _BINARY_MAGIC:
+            raise ValueError(f"'{filename}' is not a NEST binary recording.")
+
+        # The byte order mark tells whether the file was written on a little or big endian machine
+        version, bom = struct.unpack("<II", _read_exact(f, 8, filename))
+        endian = "<"
+        if bom != _BINARY_BOM:
+            version, bom = struct.unpack(">II", struct.pack("<II", version, bom))
+            endian = ">"
+        if bom != _BINARY_BOM:
+            raise ValueError(f"'{filename}' has an invalid byte order mark.")
+        if version != _BINARY_VERSION:
+            raise ValueError(f"'{filename}' has unsupported format version {version}.")
+
+        _, tics_per_step, ms_per_tic, _, n_double, n_long = struct.unpack(
+            endian + "dqdQII", _read_exact(f, 40, filename)
+        )
+
+        names = []
+        for _ in range(n_double + n_long):
+            (length,) = struct.unpack(endian + "I", _read_exact(f, 4, filename))
+            names.append(_read_exact(f, length, filename).decode("utf-8"))
+
+        dtypes = [("senders", "u8"), ("time_steps", "i8"), ("time_offsets", "f8")]
+        dtypes += [(name, "f8") for name in names[:n_double]]
+        dtypes += [(name, "i8") for name in names[n_double:]]
+
+        columns = {name: [] for name, _ in dtypes}
+        columns["times"] = []
+        while True:
+            header = f.read(8)
+            if not header:
+                break
+            if len(header) != 8:
+                raise ValueError(f"Unexpected end of file in '{filename}'.")
+            (n,) = struct.unpack(endian + "Q", header)
+            for name, dtype in dtypes:
+                data = _read_exact(f, 8 * n, filename)
+                columns[name].append(np.frombuffer(data, dtype=endian + dtype))
+            # same computation as Time::get_ms() in the kernel
+            tics = columns["time_steps"][-1] * tics_per_step
+            columns["times"].append(tics * ms_per_tic - columns["time_offsets"][-1])
+
+    return columns
+
+
+def write_spike_train_file(filename, senders, times):
+    """Write spike trains to a file for ``spike_generator`` and ``spike_train_injector``.
+
+    Devices read their spike times from the file if its name is given as
+    their ``spike_train_file`` property. Each device emits the spikes of
+    the sender given by its ``spike_train_sender`` property. The file is
+    written in the byte order of the machine and can only be read on
+    machines with the same byte order.
+
+    Parameters
+    ----------
+    filename : str
+        Name of the file to write.
+    senders : array_like of int
+        Sender of each spike, must be positive.
+    times : array_like of float
+        Time of each spike in ms.
+
+    Raises
+    ------
+    ValueError
+        If senders and times differ in length or senders are not positive.
+    """
+
+    senders = np.asarray(senders, dtype=np.int64).ravel()
+    times = np.asarray(times, dtype=np.float64).ravel()
+    if len(senders) != len(times):
+        raise ValueError("senders and times must have the same length.")
+    if np.any(senders < 1):
+        raise ValueError("senders must be positive.")
+
+    # Devices look up the spikes of their sender by bisection, so records are sorted by sender and time
+    order = np.lexsort((times, senders))
+    records = np.empty(len(senders), dtype=[("sender", "=u8"), ("time", "=f8")])
+    records["sender"] = senders[order]
+    records["time"] = times[order]
+
+    # Devices may still have the old file mapped into memory. Writing to a temporary file and renaming it
+    # leaves the old file intact for them, while rewriting it in place would make their mappings invalid.
+    directory = os.path.dirname(os.path.abspath(filename))
+    fd, tmp_filename = tempfile.mkstemp(dir=directory, prefix=".", suffix=".tmp")
+    try:
+        with os.fdopen(fd, "wb") as f:
+            # mkstemp creates the file accessible only to the owner, use the permissions of a regular new file
+            umask = os.umask(0)
+            os.umask(umask)
+            os.chmod(tmp_filename, 0o666 & ~umask)
+            f.write(_SPIKE_TRAIN_MAGIC)
+            f.write(struct.pack("=IIQ", _SPIKE_TRAIN_VERSION, _BINARY_BOM, len(records)))
+            f.write(records.tobytes())
+        os.replace(tmp_filename, filename)
+    except BaseException:
+        os.remove(tmp_filename)
+        raise
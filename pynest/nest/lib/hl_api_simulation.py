@@ -34,6 +34,7 @@ __all__ = [
     "DisableStructuralPlasticity",
     "EnableStructuralPlasticity",
     "GetKernelStatus",
+    "GetMemoryReport",
     "Install",
     "Prepare",
     "ResetKernel",
@@ -283,6 +284,35 @@ def GetKernelStatus(keys=None):
         raise TypeError("keys should be either a string or an iterable")
 
 
+def GetMemoryReport():
+    """Obtain the estimated memory held by the kernel data structures of this process.
+
+    The report is computed on each call and is not part of the kernel status,
+    as it requires iterating over all local nodes.
+
+    Returns
+    -------
+
+    dict:
+        Estimated memory in bytes, namely `connections` (per synapse model and
+        thread), `source_table`, `target_table`, `target_table_devices`,
+        `compressed_spike_data`, `mpi_buffers`, `nodes` (per model),
+        `ring_buffers` and `recording_backends`
+
+    Notes
+    -----
+    The values are derived from container capacities, so they include
+    reserved but unused space.
+
+    See Also
+    --------
+    GetKernelStatus
+
+    """
+
+    return nestkernel.llapi_get_memory_report()
+
+
 def Install(module_name):
     """Load a dynamically linked NEST module.
 
@@ -395,7 +395,7 @@ class SonataNetwork:
 
         return node_types_map
 
-    def Connect(self, hdf5_hyperslab_size=None):
+    def Connect(self, hdf5_hyperslab_size=None, use_target_index=None):
         """Connect the SONATA network nodes.
 
         The connections are created by first parsing the edge (synapse) CSV
@@ -409,12 +409,22 @@ class SonataNetwork:
         is modifiable so that the user is able to achieve a balance between
         the number of read operations and memory overhead.
 
+        If an edge population provides the optional ``indices/target_to_source``
+        index, each MPI process can instead read only the edges whose targets
+        it owns. By default, this is done when running with more than one MPI
+        process.
+
         Parameters
         ----------
         hdf5_hyperslab_size : int, optional
             Size of the hyperslab to read in one read operation. The hyperslab
             size is applied to all HDF5 datasets that need to be read in order
             to create the connections. Default: ``2**20``.
+        use_target_index : bool, optional
+            If ``True``, read only edges with local targets using the
+            ``indices/target_to_source`` index, which then must exist. If
+            ``False``, read all edges. Default: ``None``, use the index if it
+            exists and more than one MPI process is used.
         """
 
         if not self._are_nodes_created:
@@ -426,6 +436,8 @@ class SonataNetwork:
         self._verify_hyperslab_size(hdf5_hyperslab_size)
 
         graph_specs = self._create_graph_specs()
+        if use_target_index is not None:
+            graph_specs["use_target_index"] = bool(use_target_index)
 
         # Check whether HDF5 files exist and are not blocked.
         for d in graph_specs["edges"]:
@@ -590,7 +602,7 @@ class SonataNetwork:
             edges_map["edges_file"] = edges_conf["edges_file"]
             self._edges_maps.append(edges_map)
 
-    def BuildNetwork(self, hdf5_hyperslab_size=None):
+    def BuildNetwork(self, hdf5_hyperslab_size=None, use_target_index=None):
         """Build SONATA network.
 
         Convenience function for building the SONATA network. The function
@@ -606,6 +618,10 @@ class SonataNetwork:
             Size of hyperslab that is read into memory in one read operation.
             Applies to all HDF5 datasets relevant for creating the connections.
             Default: ``2**20``.
+        use_target_index : bool, optional
+            Whether to read only edges with local targets using the
+            ``indices/target_to_source`` index. Default: ``None``, decided
+            automatically. See :py:func:`Connect()`.
 
         Returns
         -------
@@ -620,7 +636,7 @@ class SonataNetwork:
             self._verify_hyperslab_size(hdf5_hyperslab_size)
 
         node_collections = self.Create()
-        self.Connect(hdf5_hyperslab_size=hdf5_hyperslab_size)
+        self.Connect(hdf5_hyperslab_size=hdf5_hyperslab_size, use_target_index=use_target_index)
 
         return node_collections
 
@@ -510,6 +510,58 @@ class NodeCollection:
 
         nestkernel.llapi_set_nc_status(self._datum, params)
 
+    def get_columns(self, keys):
+        """
+        Return properties of the nodes as NumPy arrays.
+
+        In contrast to :py:meth:`get`, only the requested properties are
+        obtained from the nodes, in parallel on all threads, and the values
+        are returned as arrays without creating a Python object per value.
+        This makes it suitable for reading, for instance, ``V_m`` of many
+        neurons between calls to :py:func:`.Run`. Only integer and floating
+        point properties are supported. In MPI-parallel simulations, the
+        arrays contain the values of the nodes local to this process.
+
+        Parameters
+        ----------
+        keys : str or list
+            Name or list of names of node properties.
+
+        Returns
+        -------
+        numpy.ndarray:
+            If `keys` is a string, the values of the property, one per node
+        dict:
+            If `keys` is a list, a dictionary with one array per key
+
+        Raises
+        ------
+        TypeError
+            If a property is not numeric.
+        KeyError
+            If the specified parameter does not exist for the nodes.
+
+        See Also
+        --------
+        :py:func:`get`
+
+        Examples
+        --------
+
+        >>>    nodes.get_columns('V_m')
+               array([-70., -70., -70.])
+
+        >>>    nodes.get_columns(['global_id', 'V_m'])
+               {'global_id': array([1, 2, 3]), 'V_m': array([-70., -70., -70.])}
+        """
+
+        if isinstance(keys, str):
+            return nestkernel.llapi_get_nc_status_columns(self._datum, [keys])[keys]
+        elif is_iterable(keys):
+            return nestkernel.llapi_get_nc_status_columns(self._datum, list(keys))
+        else:
+            raise TypeError("keys should be either a string or an iterable")
+
     def tolist(self):
         """
         Convert `NodeCollection` to list.
@@ -519,6 +571,31 @@ class NodeCollection:
 
         return list(self.get("global_id")) if len(self) > 1 else [self.get("global_id")]
 
+    def drain_events(self):
+        """
+        Take the recorded events out of the ``memory`` backend without copying them.
+
+        In contrast to reading the ``events`` property, the recorded data is not copied,
+        but handed over from the kernel to NumPy arrays. The data is removed from the
+        backend, so that ``n_events`` is 0 afterwards. This is useful to collect large
+        amounts of data between calls to ``Run()``.
+
+        Returns
+        -------
+        list:
+            One dictionary per local thread, with the same keys as the ``events``
+            dictionary. The values are read-only NumPy arrays.
+
+        Raises
+        ------
+        TypeError
+            If the `NodeCollection` does not contain exactly one node.
+        """
+        if len(self) != 1:
+            raise TypeError("drain_events() can only be called on a NodeCollection with a single recorder")
+
+        return nestkernel.llapi_drain_recorded_events(self.get("global_id"))
+
     def _to_array(self, selection="all"):
         """
         Debugging helper to extract GIDs from node collections.
@@ -973,6 +1050,114 @@ class SynapseCollection:
 
         nestkernel.llapi_set_connection_status(self._datum, params)
 
+    def _column_dtype(self, key):
+        """Return the NumPy dtype matching the type of property `key` of the connections."""
+
+        value = self[0].get(key)
+        if isinstance(value, bool):
+            raise TypeError(f"Property '{key}' is a boolean and cannot be accessed as column")
+        if isinstance(value, numbers.Integral):
+            return numpy.int64
+        if isinstance(value, numbers.Real):
+            return numpy.float64
+        raise TypeError(f"Property '{key}' is not numeric and cannot be accessed as column")
+
+    def get_columns(self, keys):
+        """
+        Return properties of all connections as NumPy arrays.
+
+        In contrast to :py:meth:`get`, the values are written directly into
+        arrays without creating a dictionary per connection, which is much
+        faster for large numbers of connections. Only numeric properties are
+        supported.
+
+        Parameters
+        ----------
+        keys : str or list
+            Name or list of names of synapse properties.
+
+        Returns
+        -------
+        numpy.ndarray:
+            If `keys` is a string, the values of the property, one per connection
+        dict:
+            If `keys` is a list, a dictionary with one array per key
+
+        Raises
+        ------
+        TypeError
+            If a property is not numeric.
+        KeyError
+            If the specified parameter does not exist for the connections.
+
+        See Also
+        --------
+        get, set_columns
+
+        Examples
+        --------
+
+        >>>    conns.get_columns('weight')
+               array([1., 1., 1., 1.])
+
+        >>>    conns.get_columns(['source', 'weight'])
+               {'source': array([1, 1, 2, 2]), 'weight': array([1., 1., 1., 1.])}
+        """
+
+        if isinstance(keys, str):
+            if self.__len__() == 0 or GetKernelStatus("network_size") == 0:
+                return numpy.empty(0)
+            return nestkernel.llapi_get_connection_status_column(self._datum, keys, self._column_dtype(keys))
+        elif is_iterable(keys):
+            return {key: self.get_columns(key) for key in keys}
+        else:
+            raise TypeError("keys should be either a string or an iterable")
+
+    def set_columns(self, params=None, **kwargs):
+        """
+        Set properties of all connections from arrays.
+
+        Each value must be an array with one entry per connection. In
+        contrast to :py:meth:`set`, no dictionary is created per connection.
+        Only numeric properties are supported.
+
+        Parameters
+        ----------
+        params : dict
+            Dictionary mapping property names to arrays of the same length as
+            the `SynapseCollection`.
+        kwargs : keyword argument pairs
+            Named arguments of properties and arrays of values.
+
+        Raises
+        ------
+        TypeError
+            If input params are of the wrong form or a property is not numeric.
+        ValueError
+            If an array does not have one entry per connection.
+
+        See Also
+        --------
+        set, get_columns
+        """
+
+        if kwargs and params is None:
+            params = kwargs
+        elif kwargs and params:
+            raise TypeError("must either provide params or kwargs, but not both.")
+
+        if not isinstance(params, dict):
+            raise TypeError("params must be a dict of arrays")
+
+        if self.__len__() == 0 or GetKernelStatus("network_size") == 0:
+            return
+
+        for key, values in params.items():
+            values = numpy.asarray(values, dtype=self._column_dtype(key))
+            if values.ndim != 1 or len(values) != self.__len__():
+                raise ValueError(f"Values of '{key}' must be a 1-dimensional array with one entry per connection")
+            nestkernel.llapi_set_connection_status_column(self._datum, key, values)
+
     def disconnect(self):
         """
         Disconnect the connections in the `SynapseCollection`.
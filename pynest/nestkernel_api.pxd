@@ -60,6 +60,7 @@ cdef extern from "dictionary.h":
 
 cdef extern from "dictionary.h" namespace "std":
     T get[T](any_type& operand)
+    const T* get_if[T](const any_type* operand)
     cbool holds_alternative[T](const any_type&)
     struct monostate
 
@@ -140,6 +141,19 @@ cdef extern from "mask.h" namespace "nest":
         MaskPTR()
 
 
+cdef extern from "recording_backend_memory.h" namespace "nest":
+    cppclass RecordedEvents:
+        cbool time_in_steps
+        vector[long] senders
+        vector[double] times_ms
+        vector[long] times_steps
+        vector[double] times_offset
+        vector[string] double_value_names
+        vector[string] long_value_names
+        vector[vector[double]] double_values
+        vector[vector[long]] long_values
+
+
 cdef extern from "nest.h" namespace "nest":
     void init_nest( int* argc, char** argv[] )
     void shutdown_nest( int exitcode )
@@ -180,16 +194,23 @@ cdef extern from "nest.h" namespace "nest":
     string pprint_to_string( NodeCollectionPTR nc ) except +custom_exception_handler
     size_t nc_size( NodeCollectionPTR nc ) except +custom_exception_handler
     Dictionary get_kernel_status() except +custom_exception_handler
+    Dictionary get_memory_report() except +custom_exception_handler
     Dictionary get_model_defaults( const string& ) except +custom_exception_handler
     void set_model_defaults( const string&, const Dictionary& ) except +custom_exception_handler
     NodeCollectionPTR get_nodes( const Dictionary& params, const cbool local_only ) except +custom_exception_handler
     deque[ConnectionID] get_connections( const Dictionary& dict ) except +custom_exception_handler
     void set_kernel_status( const Dictionary& ) except +custom_exception_handler
     Dictionary get_nc_status( NodeCollectionPTR nc ) except +custom_exception_handler
+    Dictionary get_nc_status_columns( NodeCollectionPTR nc, const vector[string]& keys ) except +custom_exception_handler
+    vector[shared_ptr[RecordedEvents]] drain_recorded_events( const size_t node_id ) except +custom_exception_handler
     void set_nc_status( NodeCollectionPTR nc, vector[Dictionary]& params ) except +custom_exception_handler
     vector[Dictionary] get_connection_status(const deque[ConnectionID]&) except +custom_exception_handler
     void set_connection_status(const deque[ConnectionID]&, const Dictionary&) except +custom_exception_handler
     void set_connection_status(const deque[ConnectionID]&, const vector[Dictionary]&) except +custom_exception_handler
+    void get_connection_status_column(const deque[ConnectionID]&, const string&, double*) except +custom_exception_handler
+    void get_connection_status_column(const deque[ConnectionID]&, const string&, long*) except +custom_exception_handler
+    void set_connection_status_column(const deque[ConnectionID]&, const string&, const double*) except +custom_exception_handler
+    void set_connection_status_column(const deque[ConnectionID]&, const string&, const long*) except +custom_exception_handler
     void simulate( const double& t ) except +custom_exception_handler
     void prepare() except +custom_exception_handler
     void run( const double& t ) except +custom_exception_handler
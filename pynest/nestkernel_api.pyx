@@ -24,10 +24,12 @@
 
 # import cython
 
+from cpython.buffer cimport PyBUF_WRITABLE
 from cython.operator cimport dereference as deref
 from cython.operator cimport preincrement as inc
 from libc.stdint cimport int64_t, uint64_t
 from libc.stdlib cimport free, malloc
+from libc.string cimport memcpy
 from libcpp.deque cimport deque as std_deque
 from libcpp.limits cimport numeric_limits
 from libcpp.map cimport map as std_map
@@ -108,6 +110,60 @@ cdef class MaskObject:
         self.thisptr = mask_ptr
 
 
+cdef class RecordedEventsBuffer:
+    """
+    Read-only buffer on one array of events drained from the memory recording backend.
+
+    The buffer shares ownership of the drained events, which thus stay alive as long as
+    any NumPy array created from the buffer exists.
+    """
+
+    cdef shared_ptr[RecordedEvents] events
+    cdef void* data
+    cdef Py_ssize_t shape[1]
+    cdef Py_ssize_t strides[1]
+    cdef bytes format
+
+    def __repr__(self):
+        return "<RecordedEventsBuffer>"
+
+    def __getbuffer__(self, Py_buffer* buffer, int flags):
+        if flags & PyBUF_WRITABLE:
+            raise BufferError("Drained events are read-only")
+
+        buffer.buf = self.data
+        buffer.format = self.format
+        buffer.internal = NULL
+        buffer.itemsize = self.strides[0]
+        buffer.len = self.shape[0] * self.strides[0]
+        buffer.ndim = 1
+        buffer.obj = self
+        buffer.readonly = 1
+        buffer.shape = self.shape
+        buffer.strides = self.strides
+        buffer.suboffsets = NULL
+
+    def __releasebuffer__(self, Py_buffer* buffer):
+        pass
+
+
+cdef object recorded_events_to_ndarray(shared_ptr[RecordedEvents] events, void* data, size_t size, Py_ssize_t itemsize, bytes format):
+    """Create a read-only NumPy array on the given data without copying."""
+
+    if size == 0:
+        array = numpy.empty(0, dtype=format.decode())
+        array.flags.writeable = False
+        return array
+
+    buf = RecordedEventsBuffer()
+    buf.events = events
+    buf.data = data
+    buf.shape[0] = size
+    buf.strides[0] = itemsize
+    buf.format = format
+    return numpy.asarray(buf)
+
+
 cdef object vec_of_dict_to_list(vector[Dictionary] cvec):
     cdef tmp = []
     cdef vector[Dictionary].iterator it = cvec.begin()
@@ -549,6 +605,11 @@ def llapi_get_kernel_status():
     return dictionary_to_pydict(cdict)
 
 
+def llapi_get_memory_report():
+    cdef Dictionary cdict = get_memory_report()
+    return dictionary_to_pydict(cdict)
+
+
 def llapi_get_defaults(object model_name):
     return dictionary_to_pydict(get_model_defaults(pystr_to_string(model_name)))
 
@@ -609,6 +670,73 @@ def llapi_get_nc_status(NodeCollectionObject nc, object key=None):
         raise TypeError(f'key must be a string, got {type(key)}')
 
 
+def llapi_get_nc_status_columns(NodeCollectionObject nc, object keys):
+    """Returns dictionary with one NumPy array per key, holding the values of the MPI-local nodes"""
+    cdef vector[string] keys_vec
+    for key in keys:
+        keys_vec.push_back(pystr_to_string(key))
+
+    cdef Dictionary columns = get_nc_status_columns(nc.thisptr, keys_vec)
+
+    # Copy the values from the dictionary directly into NumPy arrays instead of converting each value to a Python
+    # object; the columns are accessed in place, so each is copied only once
+    cdef const vector[double]* double_column
+    cdef const vector[long]* long_column
+    cdef double[::1] double_mv
+    cdef long[::1] long_mv
+    result = {}
+    cdef dictionary_.const_iterator it = columns.begin()
+    while it != columns.end():
+        key = string_to_pystr(deref(it).first)
+        double_column = get_if[vector[double]](&deref(it).second.item)
+        if double_column != NULL:
+            values = numpy.empty(double_column.size(), dtype=numpy.float64)
+            if double_column.size() > 0:
+                double_mv = values
+                memcpy(&double_mv[0], double_column.data(), double_column.size() * sizeof(double))
+        else:
+            long_column = get_if[vector[long]](&deref(it).second.item)
+            values = numpy.empty(long_column.size(), dtype=numpy.int64)
+            if long_column.size() > 0:
+                long_mv = values
+                memcpy(&long_mv[0], long_column.data(), long_column.size() * sizeof(long))
+        result[key] = values
+        inc(it)
+
+    return result
+
+
+def llapi_drain_recorded_events(long node_id):
+    cdef vector[shared_ptr[RecordedEvents]] drained = drain_recorded_events(node_id)
+    cdef shared_ptr[RecordedEvents] events
+    cdef RecordedEvents* ev
+    cdef size_t i
+
+    result = []
+    for events in drained:
+        ev = events.get()
+        thread_events = {
+            "senders": recorded_events_to_ndarray(events, ev.senders.data(), ev.senders.size(), sizeof(long), b"l")
+        }
+        if ev.time_in_steps:
+            thread_events["times"] = recorded_events_to_ndarray(
+                events, ev.times_steps.data(), ev.times_steps.size(), sizeof(long), b"l")
+            thread_events["offsets"] = recorded_events_to_ndarray(
+                events, ev.times_offset.data(), ev.times_offset.size(), sizeof(double), b"d")
+        else:
+            thread_events["times"] = recorded_events_to_ndarray(
+                events, ev.times_ms.data(), ev.times_ms.size(), sizeof(double), b"d")
+        for i in range(ev.double_values.size()):
+            thread_events[string_to_pystr(ev.double_value_names[i])] = recorded_events_to_ndarray(
+                events, ev.double_values[i].data(), ev.double_values[i].size(), sizeof(double), b"d")
+        for i in range(ev.long_values.size()):
+            thread_events[string_to_pystr(ev.long_value_names[i])] = recorded_events_to_ndarray(
+                events, ev.long_values[i].data(), ev.long_values[i].size(), sizeof(long), b"l")
+        result.append(thread_events)
+
+    return result
+
+
 def llapi_set_nc_status(NodeCollectionObject nc, object params_list):
     cdef vector[Dictionary] params = list_of_dict_to_vec(params_list)
     set_nc_status(nc.thisptr, params)
@@ -860,6 +988,53 @@ def llapi_set_connection_status(object conns, object params):
         raise TypeError('params must be a dict or a list of dicts')
 
 
+def llapi_get_connection_status_column(object conns, object key, object dtype):
+    """Returns one property of all connections as NumPy array of given dtype"""
+    cdef std_deque[ConnectionID] conn_deque
+    cdef ConnectionObject conn_object
+    for conn_object in conns:
+        conn_deque.push_back(conn_object.thisobj)
+
+    values = numpy.empty(len(conns), dtype=dtype)
+    if len(conns) == 0:
+        return values
+
+    cdef double[::1] double_mv
+    cdef long[::1] long_mv
+    if values.dtype == numpy.float64:
+        double_mv = values
+        get_connection_status_column(conn_deque, pystr_to_string(key), &double_mv[0])
+    elif values.dtype == numpy.int64:
+        long_mv = values
+        get_connection_status_column(conn_deque, pystr_to_string(key), &long_mv[0])
+    else:
+        raise TypeError('dtype must be float64 or int64')
+
+    return values
+
+
+def llapi_set_connection_status_column(object conns, object key, object values):
+    """Sets one property of all connections from a NumPy array"""
+    cdef std_deque[ConnectionID] conn_deque
+    cdef ConnectionObject conn_object
+    for conn_object in conns:
+        conn_deque.push_back(conn_object.thisobj)
+
+    if len(values) != len(conns):
+        raise ValueError('values must contain one entry per connection')
+    if len(conns) == 0:
+        return
+
+    cdef const double[::1] double_mv
+    cdef const long[::1] long_mv
+    if numpy.issubdtype(values.dtype, numpy.integer):
+        long_mv = numpy.ascontiguousarray(values, dtype=numpy.int64)
+        set_connection_status_column(conn_deque, pystr_to_string(key), &long_mv[0])
+    else:
+        double_mv = numpy.ascontiguousarray(values, dtype=numpy.float64)
+        set_connection_status_column(conn_deque, pystr_to_string(key), &double_mv[0])
+
+
 def llapi_connect_arrays(sources, targets, weights, delays, synapse_model, syn_param_keys, syn_param_values):
     """Calls connect_arrays function, passing pointers to the NumPy arrays"""
 
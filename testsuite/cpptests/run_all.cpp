@@ -27,6 +27,8 @@
 // Includes from cpptests
 #include "test_block_vector.h"
 #include "test_enum_bitfield.h"
+#include "test_history_buffer.h"
 #include "test_parameter.h"
+#include "test_rkf45_integrator.h"
 #include "test_sort.h"
 #include "test_target_fields.h"
@@ -0,0 +1,121 @@
+/*
+ *  test_history_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_HISTORY_BUFFER_H
+#define TEST_HISTORY_BUFFER_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <deque>
+
+// Includes from nestkernel:
+#include "history_buffer.h"
+
+BOOST_AUTO_TEST_SUITE( test_history_buffer )
+
+/**
+ * Push and pop entries such that the buffer wraps around and grows while
+ * wrapped, and compare against std::deque after every operation.
+ */
+BOOST_AUTO_TEST_CASE( test_matches_deque )
+{
+  nest::HistoryBuffer< int > buffer;
+  std::deque< int > reference;
+
+  int next = 0;
+  for ( int round = 0; round < 50; ++round )
+  {
+    // grow by two entries net per round
+    for ( int k = 0; k < 5; ++k )
+    {
+      buffer.push_back( next );
+      reference.push_back( next );
+      ++next;
+    }
+    for ( int k = 0; k < 3; ++k )
+    {
+      buffer.pop_front();
+      reference.pop_front();
+    }
+
+    BOOST_REQUIRE( buffer.size() == reference.size() );
+    BOOST_REQUIRE( buffer.front() == reference.front() );
+    BOOST_REQUIRE( buffer.back() == reference.back() );
+    for ( size_t i = 0; i < reference.size(); ++i )
+    {
+      BOOST_REQUIRE( buffer[ i ] == reference[ i ] );
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE( test_iterators )
+{
+  nest::HistoryBuffer< int > buffer;
+  for ( int i = 0; i < 20; ++i )
+  {
+    buffer.push_back( i );
+  }
+  for ( int i = 0; i < 15; ++i )
+  {
+    buffer.pop_front();
+  }
+  for ( int i = 20; i < 30; ++i )
+  {
+    buffer.push_back( i );
+  }
+
+  BOOST_REQUIRE( buffer.end() - buffer.begin() == 15 );
+
+  int expected = 15;
+  for ( auto it = buffer.begin(); it != buffer.end(); ++it )
+  {
+    BOOST_REQUIRE( *it == expected );
+    ++expected;
+  }
+
+  auto it = buffer.end();
+  --it;
+  BOOST_REQUIRE( *it == 29 );
+  BOOST_REQUIRE( *( it - 14 ) == 15 );
+}
+
+BOOST_AUTO_TEST_CASE( test_clear )
+{
+  nest::HistoryBuffer< int > buffer;
+  for ( int i = 0; i < 10; ++i )
+  {
+    buffer.push_back( i );
+  }
+  buffer.clear();
+  BOOST_REQUIRE( buffer.empty() );
+  BOOST_REQUIRE( buffer.begin() == buffer.end() );
+
+  buffer.push_back( 42 );
+  BOOST_REQUIRE( buffer.size() == 1 );
+  BOOST_REQUIRE( buffer.front() == 42 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* TEST_HISTORY_BUFFER_H */
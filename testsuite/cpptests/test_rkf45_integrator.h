@@ -0,0 +1,131 @@
+/*
+ *  test_rkf45_integrator.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_RKF45_INTEGRATOR_H
+#define TEST_RKF45_INTEGRATOR_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <cmath>
+
+// Includes from libnestutil:
+#include "rkf45_integrator.h"
+
+BOOST_AUTO_TEST_SUITE( test_rkf45_integrator )
+
+namespace
+{
+/**
+ * Harmonic oscillator with angular frequency omega and damping time constant tau.
+ */
+struct Oscillator
+{
+  double omega;
+  double tau;
+
+  void
+  operator()( const double y[], double f[] ) const
+  {
+    f[ 0 ] = y[ 1 ] - y[ 0 ] / tau;
+    f[ 1 ] = -omega * omega * y[ 0 ] - y[ 1 ] / tau;
+  }
+};
+
+//! Integrate over one interval of length step the way models do
+void
+integrate_interval( const nest::RKF45Integrator< 2 >& integrator,
+  const Oscillator& oscillator,
+  const double step,
+  double& h,
+  double y[] )
+{
+  double t = 0.0;
+  while ( t < step )
+  {
+    integrator.evolve( oscillator, t, step, h, y );
+  }
+}
+}
+
+/**
+ * Integrate an exponentially decaying system over many intervals and compare to the exact solution.
+ */
+BOOST_AUTO_TEST_CASE( test_exponential_decay )
+{
+  nest::RKF45Integrator< 2 > integrator;
+  integrator.set_error_control( 1e-9, 1e-9, 1.0, 0.0 );
+
+  const Oscillator decay = { 0.0, 5.0 };
+  const double step = 0.1;
+  double h = step;
+  double y[ 2 ] = { 1.0, 0.0 };
+
+  for ( int n = 1; n <= 200; ++n )
+  {
+    integrate_interval( integrator, decay, step, h, y );
+    BOOST_REQUIRE_SMALL( y[ 0 ] - std::exp( -n * step / decay.tau ), 1e-8 );
+  }
+}
+
+/**
+ * Start with a step size far too large, so that steps are rejected, and check accuracy and that the step size shrinks.
+ */
+BOOST_AUTO_TEST_CASE( test_step_rejection )
+{
+  nest::RKF45Integrator< 2 > integrator;
+  integrator.set_error_control( 1e-8, 0.0, 1.0, 0.0 );
+
+  const Oscillator oscillator = { 10.0, 1e10 };
+  double h = 10.0;
+  double y[ 2 ] = { 1.0, 0.0 };
+
+  integrate_interval( integrator, oscillator, 1.0, h, y );
+
+  BOOST_REQUIRE( h < 1.0 );
+  BOOST_REQUIRE_SMALL( y[ 0 ] - std::cos( oscillator.omega ), 1e-6 );
+}
+
+/**
+ * Control the error relative to the derivative only, as the ported models do, and compare to the exact solution.
+ */
+BOOST_AUTO_TEST_CASE( test_derivative_error_control )
+{
+  nest::RKF45Integrator< 2 > integrator;
+  integrator.set_error_control( 1e-6, 1e-6, 0.0, 1.0 );
+
+  const Oscillator oscillator = { 1.0, 1e10 };
+  const double step = 0.25;
+  double h = step;
+  double y[ 2 ] = { 1.0, 0.0 };
+
+  for ( int n = 1; n <= 40; ++n )
+  {
+    integrate_interval( integrator, oscillator, step, h, y );
+    BOOST_REQUIRE_SMALL( y[ 0 ] - std::cos( oscillator.omega * n * step ), 1e-4 );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* TEST_RKF45_INTEGRATOR_H */
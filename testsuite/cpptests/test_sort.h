@@ -33,21 +33,6 @@
 // Includes from libnestutil:
 #include "sort.h"
 
-/**
- * Wrapper for quicksort3way.
- *
- * When calling nest::sort() directly it is impossible to sort with the
- * built in quicksort3way from tests. This is because if NEST is compiled
- * with Boost support, nest::sort() sorts with Boost, and if NEST is not
- * compiled with Boost, nest::sort() calls quicksort3way, but the Boost
- * tests are not compiled.
- */
-void
-nest_quicksort( BlockVector< int >& bv0, BlockVector< int >& bv1 )
-{
-  nest::quicksort3way( bv0, bv1, 0, bv0.size() - 1 );
-}
-
 /**
  * Fixture filling two BlockVectors and a vector with linearly decreasing numbers.
  * The vector is then sorted.
@@ -56,7 +41,7 @@ struct fill_bv_vec_linear
 {
   fill_bv_vec_linear()
     : N( 20000 )
-    , N_small( boost::sort::spreadsort::detail::min_sort_size - 10 )
+    , N_small( RADIX_SORT_CUTOFF - 10 )
     , bv_sort( N )
     , bv_perm( N )
     , vec_sort( N )
@@ -102,7 +87,7 @@ struct fill_bv_vec_random
 {
   fill_bv_vec_random()
     : N( 20000 )
-    , N_small( boost::sort::spreadsort::detail::min_sort_size - 10 )
+    , N_small( RADIX_SORT_CUTOFF - 10 )
     , bv_sort( N )
     , bv_perm( N )
     , vec_sort( N )
@@ -144,49 +129,34 @@ BOOST_AUTO_TEST_SUITE( test_sort )
 
 /**
  * Tests whether two arrays with randomly generated numbers are sorted
- * correctly when sorting with NEST's own quicksort.
+ * correctly when sorting with the radix sort.
  */
-BOOST_FIXTURE_TEST_CASE( test_quicksort_random, fill_bv_vec_random )
+BOOST_FIXTURE_TEST_CASE( test_radix_random, fill_bv_vec_random )
 {
-  nest_quicksort( bv_sort, bv_perm );
-
-  // We test here that the BlockVectors bv_sort and bv_perm are both
-  // sorted here. However, if something goes wrong and they for example
-  // contain only zeros, is_sorted will also return true, but the test
-  // should not pass. Therefore, in addition to require the BlockVectors
-  // to be sorted, we also require them to be equal to the sorted
-  // reference vector, vec_sort.
+  nest::sort( bv_sort, bv_perm );
+
   BOOST_REQUIRE( std::is_sorted( bv_sort.begin(), bv_sort.end() ) );
   BOOST_REQUIRE( std::is_sorted( bv_perm.begin(), bv_perm.end() ) );
 
   BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_sort.begin() ) );
   BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_perm.begin() ) );
-}
 
-/**
- * Tests whether two arrays with linearly decreasing numbers are sorted
- * correctly when sorting with the built-in quicksort.
- */
-BOOST_FIXTURE_TEST_CASE( test_quicksort_linear, fill_bv_vec_linear )
-{
-  nest_quicksort( bv_sort, bv_perm );
+  // Using smaller data sets to sort with the fallback algorithm.
+  nest::sort( bv_sort_small, bv_perm_small );
 
-  BOOST_REQUIRE( std::is_sorted( bv_sort.begin(), bv_sort.end() ) );
-  BOOST_REQUIRE( std::is_sorted( bv_perm.begin(), bv_perm.end() ) );
+  BOOST_REQUIRE( std::is_sorted( bv_sort_small.begin(), bv_sort_small.end() ) );
+  BOOST_REQUIRE( std::is_sorted( bv_perm_small.begin(), bv_perm_small.end() ) );
 
-  BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_sort.begin() ) );
-  BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_perm.begin() ) );
+  BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_sort_small.begin() ) );
+  BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_perm_small.begin() ) );
 }
 
 /**
- * Tests whether two arrays with randomly generated numbers are sorted
- * correctly when sorting with Boost.
+ * Tests whether two arrays with linearly decreasing numbers are sorted
+ * correctly when sorting with the radix sort.
  */
-BOOST_FIXTURE_TEST_CASE( test_boost_random, fill_bv_vec_random )
+BOOST_FIXTURE_TEST_CASE( test_radix_linear, fill_bv_vec_linear )
 {
-  // Making sure we are sorting with boost
-  static_assert( HAVE_BOOST, "Compiling Boost tests, but HAVE_BOOST!=1." );
-
   nest::sort( bv_sort, bv_perm );
 
   BOOST_REQUIRE( std::is_sorted( bv_sort.begin(), bv_sort.end() ) );
@@ -206,30 +176,67 @@ BOOST_FIXTURE_TEST_CASE( test_boost_random, fill_bv_vec_random )
 }
 
 /**
- * Tests whether two arrays with linearly increasing numbers are sorted
- * correctly when sorting with Boost.
+ * Tests that the radix sort orders negative numbers correctly and is
+ * stable, i.e., keeps the order of entries with equal keys.
  */
-BOOST_FIXTURE_TEST_CASE( test_boost_linear, fill_bv_vec_linear )
+BOOST_AUTO_TEST_CASE( test_radix_negative_stable )
 {
-  // Making sure we are sorting with boost
-  static_assert( HAVE_BOOST, "Compiling Boost tests, but HAVE_BOOST!=1." );
+  const int N = 5000;
+  BlockVector< long > bv_sort;
+  BlockVector< int > bv_perm;
+  std::vector< std::pair< long, int > > reference;
+  for ( int i = 0; i < N; ++i )
+  {
+    const long k = static_cast< long >( std::rand() % 200 ) - 100;
+    bv_sort.push_back( k );
+    bv_perm.push_back( i );
+    reference.emplace_back( k, i );
+  }
+  std::stable_sort( reference.begin(),
+    reference.end(),
+    []( const std::pair< long, int >& a, const std::pair< long, int >& b ) { return a.first < b.first; } );
 
   nest::sort( bv_sort, bv_perm );
 
-  BOOST_REQUIRE( std::is_sorted( bv_sort.begin(), bv_sort.end() ) );
-  BOOST_REQUIRE( std::is_sorted( bv_perm.begin(), bv_perm.end() ) );
-
-  BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_sort.begin() ) );
-  BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_perm.begin() ) );
+  for ( int i = 0; i < N; ++i )
+  {
+    BOOST_REQUIRE_EQUAL( bv_sort[ i ], reference[ i ].first );
+    BOOST_REQUIRE_EQUAL( bv_perm[ i ], reference[ i ].second );
+  }
+}
 
-  // Using smaller data sets to sort with the fallback algorithm.
-  nest::sort( bv_sort_small, bv_perm_small );
+/**
+ * Tests that sorting with all threads of a parallel region gives the same
+ * order as the sequential radix sort, including the order of entries with
+ * equal keys, whichever thread applies the permutation.
+ */
+BOOST_AUTO_TEST_CASE( test_radix_in_team )
+{
+  const int N = 3 * RADIX_SORT_TEAM_CUTOFF;
+  BlockVector< long > bv_sort;
+  BlockVector< int > bv_perm;
+  for ( int i = 0; i < N; ++i )
+  {
+    bv_sort.push_back( static_cast< long >( std::rand() % 100000 ) - 50000 );
+    bv_perm.push_back( i );
+  }
+  BlockVector< long > reference_sort = bv_sort;
+  BlockVector< int > reference_perm = bv_perm;
+  nest::sort( reference_sort, reference_perm );
 
-  BOOST_REQUIRE( std::is_sorted( bv_sort_small.begin(), bv_sort_small.end() ) );
-  BOOST_REQUIRE( std::is_sorted( bv_perm_small.begin(), bv_perm_small.end() ) );
+  nest::RadixSortTeamBuffers team;
+#pragma omp parallel num_threads( 3 )
+  {
+#ifdef _OPENMP
+    const size_t owner = omp_get_num_threads() - 1;
+#else
+    const size_t owner = 0;
+#endif
+    nest::radix_sort_in_team( bv_sort, bv_perm, owner, team );
+  }
 
-  BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_sort_small.begin() ) );
-  BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_perm_small.begin() ) );
+  BOOST_REQUIRE( std::equal( reference_sort.begin(), reference_sort.end(), bv_sort.begin() ) );
+  BOOST_REQUIRE( std::equal( reference_perm.begin(), reference_perm.end(), bv_perm.begin() ) );
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -38,6 +38,14 @@ class ConnectArrayFixedOutdegreeTestCase(unittest.TestCase):
     def test_Connect_Array_Fixed_Outdegree(self):
         """Tests of connections with fixed outdegree and parameter arrays"""
 
+        self._check_connect_array_fixed_outdegree(num_threads=1)
+
+    def test_Connect_Array_Fixed_Outdegree_Threads(self):
+        """Tests of connections with fixed outdegree and parameter arrays on multiple threads"""
+
+        self._check_connect_array_fixed_outdegree(num_threads=4)
+
+    def _check_connect_array_fixed_outdegree(self, num_threads):
         N = 20  # number of neurons in each population
         K = 5  # number of connections per neuron
 
@@ -45,6 +53,7 @@ class ConnectArrayFixedOutdegreeTestCase(unittest.TestCase):
         # test with connection rule fixed_outdegree
         ############################################
         nest.ResetKernel()
+        nest.local_num_threads = num_threads
 
         net1 = nest.Create("iaf_psc_alpha", N)  # creates source population
         net2 = nest.Create("iaf_psc_alpha", N)  # creates target population
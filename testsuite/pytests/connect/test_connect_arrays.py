@@ -227,6 +227,31 @@ class TestConnectArrays(unittest.TestCase):
             self.assertEqual(c.delay, d)
             self.assertEqual(c.receptor, r)
 
+    def test_connect_arrays_rtype_threaded(self):
+        """Connecting NumPy arrays with varying receptor_type and a device target, threaded"""
+        nest.local_num_threads = 4
+        n = 10
+        nrns = nest.Create("iaf_psc_exp_multisynapse", n, params={"tau_syn": [0.5, 1.0, 2.0]})
+        srec = nest.Create("spike_recorder")
+        sources = np.arange(1, n + 1, dtype=np.uint64)
+        targets = np.append(self.non_unique[:-1], srec.global_id).astype(np.uint64)
+        weights = np.arange(1, n + 1, dtype=float)
+        receptor_type = np.append(np.arange(n - 1) % 3 + 1, 0).astype(np.uint64)
+
+        nest.Connect(
+            sources,
+            targets,
+            conn_spec="one_to_one",
+            syn_spec={"weight": weights, "receptor_type": receptor_type},
+        )
+
+        conns = nest.GetConnections(source=nrns)
+        self.assertEqual(len(conns), n)
+
+        conn_info = sorted(zip(conns.source, conns.target, conns.weight, conns.receptor))
+        for s, t, w, r, c in zip(sources, targets, weights, receptor_type, conn_info):
+            self.assertEqual(c, (s, t, w, r))
+
     def test_connect_arrays_additional_synspec_params(self):
         """Connecting NumPy arrays with additional syn_spec params"""
         n = 10
@@ -391,6 +416,90 @@ class TestConnectArrays(unittest.TestCase):
 
         self.assertEqual(src_alpha_ref, src_alpha)
 
+    @unittest.skipIf(not HAVE_THREADS, "NEST was compiled without multi-threading")
+    def test_connect_arrays_parameter_columns(self):
+        """Parameters set directly as columns match those set with dictionaries"""
+
+        nest.local_num_threads = 4
+
+        n = 10
+        nrns = nest.Create("iaf_psc_alpha", n)
+        sr = nest.Create("spike_recorder")
+        sources = np.arange(1, n + 1, dtype=np.uint64)
+        targets = np.append(self.non_unique, sr.global_id).astype(np.uint64)
+        sources = np.append(sources, nrns[0].global_id).astype(np.uint64)
+        U = np.linspace(0.1, 0.9, len(sources))
+        tau_rec = np.linspace(100.0, 900.0, len(sources))
+
+        nest.Connect(
+            sources,
+            targets,
+            conn_spec="one_to_one",
+            syn_spec={"synapse_model": "tsodyks2_synapse", "U": U, "tau_rec": tau_rec},
+        )
+
+        conns = nest.GetConnections()
+        self.assertEqual(len(conns), len(sources))
+        expected = sorted(zip(sources, targets, U, tau_rec))
+        actual = sorted(zip(conns.source, conns.target, conns.U, conns.tau_rec))
+        for (s, t, u, tr), (conn_s, conn_t, conn_u, conn_tr) in zip(expected, actual):
+            self.assertEqual((conn_s, conn_t), (s, t))
+            self.assertEqual(conn_u, u)
+            self.assertEqual(conn_tr, tr)
+
+    def test_connect_arrays_invalid_parameter_column(self):
+        """An invalid parameter value is rejected before any connection is created"""
+
+        n = 10
+        nest.Create("iaf_psc_alpha", n)
+        sources = np.arange(1, n + 1, dtype=np.uint64)
+        U = np.full(n, 0.5)
+        U[-1] = 1.5
+
+        with self.assertRaises(nest.NESTErrors.BadProperty):
+            nest.Connect(
+                sources,
+                self.non_unique,
+                conn_spec="one_to_one",
+                syn_spec={"synapse_model": "tsodyks2_synapse", "U": U},
+            )
+        self.assertEqual(nest.num_connections, 0)
+
+    def test_connect_arrays_stdp_parameter_columns(self):
+        """Parameters of STDP synapses set as columns are checked against the weight of each connection"""
+
+        n = 10
+        nest.Create("iaf_psc_alpha", n)
+        sources = np.arange(1, n + 1, dtype=np.uint64)
+        weights = np.linspace(-5.0, 5.0, n)
+        Wmax = 2.0 * weights
+        lam = np.linspace(0.01, 0.1, n)
+        mu_plus = np.linspace(0.0, 1.0, n)
+
+        nest.Connect(
+            sources,
+            self.non_unique,
+            conn_spec="one_to_one",
+            syn_spec={"synapse_model": "stdp_synapse", "weight": weights, "Wmax": Wmax, "lambda": lam, "mu_plus": mu_plus},
+        )
+
+        conns = nest.GetConnections()
+        expected = sorted(zip(sources, self.non_unique, weights, Wmax, lam, mu_plus))
+        actual = sorted(
+            zip(conns.source, conns.target, conns.weight, conns.Wmax, conns.get("lambda"), conns.mu_plus)
+        )
+        self.assertEqual(actual, expected)
+
+        # Wmax with the sign of the default weight is invalid for negative weights
+        with self.assertRaises(nest.NESTErrors.BadProperty):
+            nest.Connect(
+                sources,
+                self.non_unique,
+                conn_spec="one_to_one",
+                syn_spec={"synapse_model": "stdp_synapse", "weight": weights, "Wmax": np.full(n, 100.0)},
+            )
+        self.assertEqual(nest.num_connections, n)
+
     def test_connect_arrays_pandas(self):
         """
         Confirm that data from pandas data frames can be passed.
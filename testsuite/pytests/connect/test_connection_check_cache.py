@@ -0,0 +1,145 @@
+# -*- coding: utf-8 -*-
+#
+# test_connection_check_cache.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that connection checks reused for combinations of models, receptors and synapses give correct results.
+"""
+
+import nest
+import pytest
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def test_checks_repeated_for_other_receptor():
+    """
+    Ensure that a successful check does not make other receptors valid.
+    """
+
+    nrns = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(nrns[0], nrns[1])
+    nest.Connect(nrns[1], nrns[0])
+
+    with pytest.raises(nest.NESTErrors.UnknownReceptorType):
+        nest.Connect(nrns[0], nrns[1], syn_spec={"receptor_type": 1})
+
+
+def test_checks_repeated_for_other_synapse_model():
+    """
+    Ensure that a successful check does not make other synapse models valid.
+    """
+
+    nrns = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(nrns[0], nrns[1], syn_spec={"synapse_model": "static_synapse"})
+
+    with pytest.raises(nest.NESTErrors.IllegalConnection):
+        nest.Connect(
+            nrns[0],
+            nrns[1],
+            conn_spec={"rule": "one_to_one", "make_symmetric": True},
+            syn_spec={"synapse_model": "gap_junction"},
+        )
+
+
+def test_checks_depending_on_node_parameters():
+    """
+    Ensure that checks of models with node-specific receptors are not reused.
+    """
+
+    src = nest.Create("iaf_psc_alpha")
+    tgt_three = nest.Create("iaf_psc_alpha_multisynapse", params={"tau_syn": [1.0, 2.0, 3.0]})
+    tgt_one = nest.Create("iaf_psc_alpha_multisynapse", params={"tau_syn": [1.0]})
+
+    nest.Connect(src, tgt_three, syn_spec={"receptor_type": 3})
+
+    with pytest.raises(nest.NESTErrors.IncompatibleReceptorType):
+        nest.Connect(src, tgt_one, syn_spec={"receptor_type": 3})
+
+    # the connected node must still reject a reduction of its receptors
+    nest.Connect(src, tgt_one, syn_spec={"receptor_type": 1})
+    with pytest.raises(nest.NESTErrors.BadProperty):
+        tgt_one.tau_syn = [1.0, 2.0]
+
+
+def test_reused_checks_give_correct_ports():
+    """
+    Ensure that connections created with reused checks deliver to the port of their receptor.
+
+    Parrot neurons repeat spikes arriving at receptor 0 and ignore spikes arriving at receptor 1.
+    """
+
+    sg = nest.Create("spike_generator", params={"spike_times": [1.0, 2.0]})
+    srcs = nest.Create("parrot_neuron", 5)
+    repeating = nest.Create("parrot_neuron", 5)
+    ignoring = nest.Create("parrot_neuron", 5)
+    sr_repeating = nest.Create("spike_recorder")
+    sr_ignoring = nest.Create("spike_recorder")
+
+    nest.Connect(sg, srcs)
+    nest.Connect(srcs, repeating, "one_to_one", syn_spec={"receptor_type": 0})
+    nest.Connect(srcs, ignoring, "one_to_one", syn_spec={"receptor_type": 1})
+    nest.Connect(repeating, sr_repeating)
+    nest.Connect(ignoring, sr_ignoring)
+
+    nest.Simulate(10.0)
+
+    assert sr_repeating.n_events == 2 * len(repeating)
+    assert sr_ignoring.n_events == 0
+
+
+def test_multimeter_connections_not_cached():
+    """
+    Ensure that every neuron connected to a multimeter records, which requires a check per connection.
+    """
+
+    nrns = nest.Create("iaf_psc_alpha", 3)
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"], "interval": 1.0})
+    nest.Connect(mm, nrns)
+
+    nest.Simulate(5.0)
+
+    assert set(mm.events["senders"]) == set(nrns.tolist())
+
+
+@pytest.mark.parametrize(
+    "generator_model",
+    [
+        "sinusoidal_poisson_generator",
+        pytest.param("sinusoidal_gamma_generator", marks=pytest.mark.skipif_missing_gsl),
+    ],
+)
+def test_stimulation_devices_with_proxies_not_cached(generator_model):
+    """
+    Ensure that each stimulation device with proxies registers its synapse model and rejects a second one.
+    """
+
+    nest.SetDefaults(generator_model, {"individual_spike_trains": False})
+    gens = nest.Create(generator_model, 2)
+    nrn = nest.Create("iaf_psc_alpha")
+
+    nest.Connect(gens[0], nrn, syn_spec={"synapse_model": "static_synapse"})
+    nest.Connect(gens[1], nrn, syn_spec={"synapse_model": "static_synapse"})
+
+    with pytest.raises(nest.NESTErrors.IllegalConnection):
+        nest.Connect(gens[1], nrn, syn_spec={"synapse_model": "static_synapse_hom_w"})
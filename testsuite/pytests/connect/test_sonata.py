@@ -43,11 +43,13 @@ EXPECTED_NUM_SPIKES = 18828
 # 2**20=1048576 : Edge files read in their entirety (default hyperslab size value)
 HYPERSLAB_SIZES = [2**10, 2**20]
 NUM_THREADS = [1, 2, 4]
+USE_TARGET_INDEX = [None, True, False]
 
 
+@pytest.mark.parametrize("use_target_index", USE_TARGET_INDEX)
 @pytest.mark.parametrize("hyperslab_size", HYPERSLAB_SIZES)
 @pytest.mark.parametrize("num_threads", NUM_THREADS)
-def test_SonataNetwork(num_threads, hyperslab_size):
+def test_SonataNetwork(num_threads, hyperslab_size, use_target_index):
     # Tests must fail if input files not found, since that points to a
     # misconfiguration of the NEST installation.
     assert have_sonata_files, "SONATA files not found"
@@ -55,7 +57,7 @@ def test_SonataNetwork(num_threads, hyperslab_size):
     nest.ResetKernel()
     nest.set(total_num_virtual_procs=num_threads)
     sonata_net = nest.SonataNetwork(config, sim_config)
-    node_collections = sonata_net.BuildNetwork(hdf5_hyperslab_size=hyperslab_size)
+    node_collections = sonata_net.BuildNetwork(hdf5_hyperslab_size=hyperslab_size, use_target_index=use_target_index)
 
     # Verify network was built correctly
     kernel_status = nest.GetKernelStatus()
@@ -68,3 +70,28 @@ def test_SonataNetwork(num_threads, hyperslab_size):
     sonata_net.Simulate()
     post_times = srec.events["times"]
     assert post_times.size == EXPECTED_NUM_SPIKES
+
+
+def get_sorted_connections():
+    conns = nest.GetConnections().get(["source", "target", "weight", "delay"])
+    columns = np.array([conns["source"], conns["target"], conns["weight"], conns["delay"]])
+    return columns[:, np.lexsort(columns[::-1])]
+
+
+@pytest.mark.parametrize("use_target_index", USE_TARGET_INDEX)
+@pytest.mark.parametrize("num_threads", NUM_THREADS[1:])
+def test_SonataNetwork_connections_independent_of_threads(num_threads, use_target_index):
+    """Connections created with several threads must match those created with a single thread."""
+
+    assert have_sonata_files, "SONATA files not found"
+
+    nest.ResetKernel()
+    nest.SonataNetwork(config, sim_config).BuildNetwork(use_target_index=use_target_index)
+    expected = get_sorted_connections()
+
+    nest.ResetKernel()
+    nest.set(total_num_virtual_procs=num_threads)
+    nest.SonataNetwork(config, sim_config).BuildNetwork(use_target_index=use_target_index)
+
+    assert nest.num_connections == EXPECTED_NUM_CONNECTIONS
+    np.testing.assert_array_equal(get_sorted_connections(), expected)
@@ -0,0 +1,98 @@
+# -*- coding: utf-8 -*-
+#
+# test_sort_connections_by_target.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test ordering of the connections of each source by target.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+if nest.build_info["have_threads"]:
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+def simulate_network(sort_by_target, num_threads):
+    """
+    Simulate a randomly connected network and return connections and recorded spikes.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.rng_seed = 1234
+    nest.sort_connections_by_target = sort_by_target
+
+    nrns = nest.Create("iaf_psc_alpha", 200, params={"I_e": 400.0})
+    nrns.V_m = nest.random.uniform(-70.0, -55.0)
+    nest.Connect(
+        nrns,
+        nrns,
+        {"rule": "fixed_outdegree", "outdegree": 50},
+        {"weight": nest.random.uniform(-20.0, 20.0), "delay": nest.random.uniform(1.0, 2.0)},
+    )
+    sr = nest.Create("spike_recorder")
+    nest.Connect(nrns, sr)
+
+    nest.Simulate(200.0)
+
+    return nrns, nest.GetConnections(source=nrns, target=nrns), sr.events
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_connections_of_source_sorted_by_target(num_threads):
+    """
+    Ensure that the connections of each source on each thread are in order of target node IDs.
+    """
+
+    nrns, conns, _ = simulate_network(True, num_threads)
+
+    sources = np.array(conns.source)
+    targets = np.array(conns.target)
+    threads = np.array(conns.target_thread)
+    synapse_ids = np.array(conns.synapse_id)
+    for src in nrns.tolist():
+        for thread in range(num_threads):
+            selected = (sources == src) & (threads == thread) & (synapse_ids == synapse_ids[0])
+            assert np.all(np.diff(targets[selected]) >= 0)
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_sorting_by_target_does_not_change_dynamics(num_threads):
+    """
+    Ensure that delivering spikes in target order gives the same spikes as the default order.
+    """
+
+    _, conns_default, events_default = simulate_network(False, num_threads)
+    _, conns_sorted, events_sorted = simulate_network(True, num_threads)
+
+    assert len(events_default["times"]) > 0
+    nptest.assert_array_equal(events_default["times"], events_sorted["times"])
+    nptest.assert_array_equal(events_default["senders"], events_sorted["senders"])
+
+    # the same connections exist in both cases
+    def as_sorted_list(conns):
+        return sorted(zip(conns.source, conns.target, conns.weight, conns.delay))
+
+    assert as_sorted_list(conns_default) == as_sorted_list(conns_sorted)
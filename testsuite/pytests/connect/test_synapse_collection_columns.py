@@ -0,0 +1,209 @@
+# -*- coding: utf-8 -*-
+#
+# test_synapse_collection_columns.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test reading and writing synapse properties as arrays with ``get_columns`` and ``set_columns``.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+if nest.build_info["have_threads"]:
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+@pytest.fixture
+def conns(request):
+    nest.ResetKernel()
+    nest.local_num_threads = request.param
+    nest.rng_seed = 4321
+
+    nrns = nest.Create("iaf_psc_alpha", 20)
+    nest.Connect(
+        nrns,
+        nrns,
+        {"rule": "fixed_indegree", "indegree": 5},
+        {
+            "synapse_model": "stdp_synapse",
+            "weight": nest.random.uniform(1.0, 2.0),
+            "delay": nest.random.uniform(1.0, 3.0),
+        },
+    )
+    return nest.GetConnections()
+
+
+@pytest.mark.parametrize("conns", THREAD_NUMBERS, indirect=True)
+@pytest.mark.parametrize("key", ["source", "target", "target_thread", "port", "weight", "delay", "tau_plus"])
+def test_get_columns_matches_get(conns, key):
+    """
+    Ensure that a column contains the same values as obtained via ``get``.
+    """
+
+    column = conns.get_columns(key)
+
+    assert isinstance(column, np.ndarray)
+    assert len(column) == len(conns)
+    nptest.assert_array_equal(column, conns.get(key))
+
+
+@pytest.mark.parametrize("conns", THREAD_NUMBERS, indirect=True)
+def test_get_columns_types_and_multiple_keys(conns):
+    """
+    Ensure that integer properties give integer arrays and lists of keys give dictionaries.
+    """
+
+    columns = conns.get_columns(["source", "weight"])
+
+    assert set(columns.keys()) == {"source", "weight"}
+    assert np.issubdtype(columns["source"].dtype, np.integer)
+    assert np.issubdtype(columns["weight"].dtype, np.floating)
+
+
+@pytest.mark.parametrize("conns", THREAD_NUMBERS, indirect=True)
+def test_set_columns_round_trip(conns):
+    """
+    Ensure that values written with ``set_columns`` are set on the corresponding connections.
+    """
+
+    weights = np.linspace(0.5, 5.0, len(conns))
+    delays = np.linspace(1.0, 2.0, len(conns))
+    conns.set_columns(weight=weights, delay=delays)
+
+    nptest.assert_array_equal(conns.get_columns("weight"), weights)
+    nptest.assert_array_equal(conns.get("weight"), weights)
+    nptest.assert_allclose(conns.get_columns("delay"), delays, atol=nest.resolution / 2)
+
+
+@pytest.mark.parametrize("conns", THREAD_NUMBERS, indirect=True)
+def test_columns_errors(conns):
+    """
+    Ensure that unknown properties and arrays of wrong length are rejected.
+    """
+
+    with pytest.raises(KeyError):
+        conns.get_columns("no_such_property")
+
+    with pytest.raises(ValueError):
+        conns.set_columns(weight=np.ones(len(conns) + 1))
+
+    with pytest.raises(TypeError):
+        conns.get_columns("synapse_model")
+
+
+@pytest.mark.parametrize("n_threads", THREAD_NUMBERS)
+@pytest.mark.parametrize("syn_spec", [{"synapse_model": "static_synapse_hom_w", "delay": 1.5}, {"weight": 2.5}])
+def test_get_columns_weight_and_delay_for_all_connection_types(n_threads, syn_spec):
+    """
+    Ensure that weight and delay columns match ``get`` for connections with homogeneous weights and to devices.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = n_threads
+
+    nrns = nest.Create("iaf_psc_alpha", 4)
+    nest.Connect(nrns, nrns, syn_spec=syn_spec)
+    nest.Connect(nrns, nest.Create("spike_recorder"), syn_spec=syn_spec)
+    conns = nest.GetConnections()
+
+    nptest.assert_array_equal(conns.get_columns("delay"), conns.get("delay"))
+
+    if syn_spec.get("synapse_model") == "static_synapse_hom_w":
+        # the weight is a property of the synapse model, connections do not report it
+        with pytest.raises(KeyError):
+            conns.get_columns("weight")
+    else:
+        nptest.assert_array_equal(conns.get_columns("weight"), conns.get("weight"))
+
+
+@pytest.mark.parametrize("n_threads", THREAD_NUMBERS)
+def test_get_columns_mixed_synapse_models(n_threads):
+    """
+    Ensure that a property is read from each connection's own synapse model in mixed collections.
+
+    ``U`` exists for ``tsodyks_synapse`` and ``tsodyks2_synapse``, but not for ``static_synapse``. The
+    collection is read in both orders so that ``static_synapse`` connections follow others on a thread.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = n_threads
+
+    nrns = nest.Create("iaf_psc_alpha", 4)
+    nest.Connect(nrns, nrns, syn_spec={"synapse_model": "tsodyks_synapse", "U": 0.3})
+    nest.Connect(nrns, nrns, syn_spec={"synapse_model": "tsodyks2_synapse", "U": 0.7})
+    tsodyks_conns = nest.GetConnections()
+
+    for conns in [tsodyks_conns, tsodyks_conns[::-1]]:
+        nptest.assert_array_equal(conns.get_columns("U"), conns.get("U"))
+
+    nest.Connect(nrns, nrns, syn_spec={"synapse_model": "static_synapse"})
+    mixed_conns = nest.GetConnections()
+
+    # the error is raised by PyNEST if the first connection lacks the property, else by the kernel
+    for conns in [mixed_conns, mixed_conns[::-1]]:
+        with pytest.raises((KeyError, nest.NESTErrors.KeyError)):
+            conns.get_columns("U")
+
+
+@pytest.mark.parametrize("n_threads", THREAD_NUMBERS)
+def test_set_columns_checks_weight_and_delay(n_threads):
+    """
+    Ensure that writing weight and delay columns applies the same checks as ``set``.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = n_threads
+
+    nrns = nest.Create("iaf_psc_alpha", 4)
+    nest.Connect(nrns, nrns, syn_spec={"synapse_model": "stdp_synapse"})
+    nest.Connect(nrns, nrns, syn_spec={"synapse_model": "static_synapse"})
+    stdp_conns = nest.GetConnections(synapse_model="stdp_synapse")
+    static_conns = nest.GetConnections(synapse_model="static_synapse")
+
+    # weight and Wmax of stdp_synapse must have the same sign
+    with pytest.raises(nest.NESTErrors.BadProperty):
+        stdp_conns.set_columns(weight=-np.ones(len(stdp_conns)))
+
+    with pytest.raises(nest.NESTErrors.BadDelay):
+        static_conns.set_columns(delay=np.zeros(len(static_conns)))
+
+
+@pytest.mark.parametrize("n_threads", THREAD_NUMBERS)
+def test_delay_columns_of_cont_delay_synapse(n_threads):
+    """
+    Ensure that delay columns include the continuous part of the delay of ``cont_delay_synapse``.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = n_threads
+
+    nrns = nest.Create("iaf_psc_alpha", 4)
+    nest.Connect(nrns, nrns, syn_spec={"synapse_model": "cont_delay_synapse"})
+    conns = nest.GetConnections()
+
+    delays = np.linspace(1.05, 1.45, len(conns))
+    conns.set_columns(delay=delays)
+
+    nptest.assert_allclose(conns.get_columns("delay"), delays)
+    nptest.assert_array_equal(conns.get_columns("delay"), conns.get("delay"))
@@ -0,0 +1,72 @@
+# -*- coding: utf-8 -*-
+#
+# test_connect_device_targets.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that connections to devices are created on every rank.
+
+Devices exist on all ranks, but their home VP is on one rank only. Connections
+from neurons to a device are stored on the rank of the neuron, so they must be
+created also if the home VP of the device is on another rank. Rules that
+cannot connect to devices must reject them on every rank.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+pytestmark = pytest.mark.skipif_missing_threads
+
+NUM_SOURCES = 20
+NUM_RECORDERS = 4
+OUTDEGREE = 3
+
+
+@pytest.fixture(autouse=True)
+def prepare_kernel():
+    nest.ResetKernel()
+    nest.total_num_virtual_procs = 2 * nest.NumProcesses()
+
+
+def num_local(nodes):
+    """Return the number of nodes whose home VP is on this rank."""
+
+    return sum(1 for n in nodes if n.vp % nest.NumProcesses() == nest.Rank())
+
+
+def test_fixed_outdegree_to_recorders_rejected():
+    """fixed_outdegree does not connect to devices, which must be detected on every rank."""
+
+    sources = nest.Create("parrot_neuron", NUM_SOURCES)
+    recorders = nest.Create("spike_recorder", NUM_RECORDERS)
+
+    with pytest.raises(nest.NESTErrors.IllegalConnection):
+        nest.Connect(sources, recorders, {"rule": "fixed_outdegree", "outdegree": OUTDEGREE, "allow_multapses": True})
+
+
+def test_connect_arrays_to_recorders():
+    sources = nest.Create("parrot_neuron", NUM_SOURCES)
+    recorders = nest.Create("spike_recorder", NUM_RECORDERS)
+
+    source_ids = np.repeat(sources.global_id, NUM_RECORDERS)
+    target_ids = np.tile(recorders.global_id, NUM_SOURCES)
+    nest.Connect(source_ids, target_ids, "one_to_one", {"synapse_model": "static_synapse"})
+
+    assert len(nest.GetConnections(target=recorders)) == NUM_RECORDERS * num_local(sources)
@@ -0,0 +1 @@
+../../other/test_overlap_spike_communication.py
\ No newline at end of file
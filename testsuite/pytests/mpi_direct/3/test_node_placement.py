@@ -0,0 +1 @@
+../../other/test_node_placement.py
\ No newline at end of file
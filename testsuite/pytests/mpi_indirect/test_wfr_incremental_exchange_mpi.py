@@ -0,0 +1,132 @@
+# -*- coding: utf-8 -*-
+#
+# test_wfr_incremental_exchange_mpi.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+import pytest
+from mpi_test_wrapper import MPITestAssertEqual
+
+
+@pytest.mark.skipif_incompatible_mpi
+@pytest.mark.skipif_missing_gsl
+@MPITestAssertEqual([1, 2, 4], debug=False)
+def test_wfr_incremental_exchange_mpi():
+    """
+    Test that exchanging only changed secondary events works in parallel.
+
+    Neurons coupled by gap junctions are distributed over all ranks, so that
+    waveform relaxation iterations after the first send changed coefficients
+    to other ranks with point-to-point messages.
+
+    The test is performed on the spike data recorded to SPIKE_LABEL during the simulation.
+    """
+
+    import nest
+
+    total_vps = 4
+    h = 0.1
+
+    nest.SetKernelStatus(
+        {
+            "total_num_virtual_procs": total_vps,
+            "resolution": h,
+            "use_wfr": True,
+            "wfr_tol": 0.0001,
+            "wfr_interpolation_order": 3,
+            "wfr_max_iterations": 10,
+            "wfr_comm_interval": 1,
+            "wfr_incremental_exchange": True,
+        }
+    )
+    n = nest.Create("hh_psc_alpha_gap", n=8)
+    n[0].I_e = 400.0
+    n[5].I_e = 300.0
+
+    sr = nest.Create(
+        "spike_recorder",
+        params={
+            "record_to": "ascii",
+            "time_in_steps": True,
+            "label": SPIKE_LABEL.format(nest.num_processes),  # noqa: F821
+        },
+    )
+
+    # chain of gap junctions, so that each neuron is coupled to neurons on other virtual processes
+    for pre, post, w in zip(n[:-1], n[1:], [10, 8, 12, 9, 11, 10, 8]):
+        nest.Connect(
+            pre, post, {"rule": "one_to_one", "make_symmetric": True}, {"synapse_model": "gap_junction", "weight": w}
+        )
+
+    nest.Connect(n, sr)
+
+    nest.Simulate(50)
+
+
+@pytest.mark.skipif_incompatible_mpi
+@MPITestAssertEqual([1, 2, 4], debug=False)
+def test_wfr_incremental_exchange_rate_neurons_mpi():
+    """
+    Test that exchanging only changed secondary events works in parallel for rate neurons.
+
+    Unlike the gap junction models, rate neurons do not require GSL, so this test runs in every build with MPI.
+
+    The test is performed on the multimeter data recorded to MULTI_LABEL during the simulation.
+    """
+
+    import nest
+
+    total_vps = 4
+    h = 0.1
+
+    nest.SetKernelStatus(
+        {
+            "total_num_virtual_procs": total_vps,
+            "resolution": h,
+            "use_wfr": True,
+            "wfr_tol": 0.0001,
+            "wfr_interpolation_order": 3,
+            "wfr_max_iterations": 10,
+            "wfr_comm_interval": 1.0,
+            "wfr_incremental_exchange": True,
+        }
+    )
+
+    n = nest.Create("lin_rate_ipn", n=8, params={"mu": 0.0, "sigma": 0.0, "tau": 2.0})
+    n[0].rate = 20.0
+    n[3].mu = 5.0
+
+    mm = nest.Create(
+        "multimeter",
+        params={
+            "record_from": ["rate"],
+            "interval": 1,
+            "record_to": "ascii",
+            "precision": 8,
+            "time_in_steps": True,
+            "label": MULTI_LABEL.format(nest.num_processes),  # noqa: F821
+        },
+    )
+
+    # chain of instantaneous rate connections, so that each neuron receives rates from other virtual processes
+    for pre, post, w in zip(n[:-1], n[1:], [0.5, -0.3, 0.4, 0.6, -0.2, 0.5, 0.3]):
+        nest.Connect(pre, post, syn_spec={"synapse_model": "rate_connection_instantaneous", "weight": w})
+
+    nest.Connect(mm, n)
+
+    nest.Simulate(11)
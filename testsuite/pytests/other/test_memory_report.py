@@ -0,0 +1,150 @@
+# -*- coding: utf-8 -*-
+#
+# test_memory_report.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test the memory report of the kernel.
+"""
+
+import nest
+import pytest
+
+pytestmark = pytest.mark.skipif_missing_threads
+
+
+@pytest.fixture(autouse=True)
+def reset_kernel():
+    nest.ResetKernel()
+
+
+def build_network():
+    nest.total_num_virtual_procs = 2
+    nrns = nest.Create("iaf_psc_alpha", 50, params={"I_e": 400.0})
+    nest.Connect(nrns, nrns, {"rule": "fixed_indegree", "indegree": 10}, {"synapse_model": "static_synapse"})
+    nest.Connect(nrns, nest.Create("spike_recorder"))
+    return nrns
+
+
+def test_memory_report_entries():
+    """
+    Verify that the memory report has an entry for each subsystem and only non-negative values.
+    """
+
+    build_network()
+    report = nest.GetMemoryReport()
+
+    for key in [
+        "connections",
+        "source_table",
+        "target_table",
+        "target_table_devices",
+        "compressed_spike_data",
+        "mpi_buffers",
+        "nodes",
+        "ring_buffers",
+        "recording_backends",
+    ]:
+        assert key in report
+
+    assert set(report["mpi_buffers"]) == {"spike_data", "off_grid_spike_data", "target_data", "secondary_events"}
+    assert "memory" in report["recording_backends"]
+
+    assert report["nodes"]["iaf_psc_alpha"] > 0
+    assert report["ring_buffers"] > 0
+    for key in ["source_table", "target_table", "target_table_devices", "compressed_spike_data", "ring_buffers"]:
+        assert report[key] >= 0
+    for value in report["mpi_buffers"].values():
+        assert value >= 0
+
+
+def test_memory_report_after_prepare_and_simulate():
+    """
+    Verify that connections are reported per thread and that recorded data show up after simulation.
+    """
+
+    build_network()
+
+    nest.Prepare()
+    report = nest.GetMemoryReport()
+    connection_bytes = report["connections"]["static_synapse"]
+    assert len(connection_bytes) == 2
+    assert all(b > 0 for b in connection_bytes)
+    assert report["target_table"] > 0
+    assert report["mpi_buffers"]["spike_data"] > 0
+    nest.Cleanup()
+
+    nest.Simulate(100.0)
+    assert nest.GetMemoryReport()["recording_backends"]["memory"] > 0
+
+
+def test_memory_report_not_in_kernel_status():
+    """
+    Verify that the memory report is only computed on request.
+    """
+
+    build_network()
+    assert "memory_report" not in nest.GetKernelStatus()
+
+
+def test_ring_buffers_grow_with_nodes():
+    """
+    Verify that ring buffer memory is computed from the nodes that currently exist.
+    """
+
+    build_network()
+    ring_buffers = nest.GetMemoryReport()["ring_buffers"]
+
+    nest.Create("parrot_neuron", 10)
+    assert nest.GetMemoryReport()["ring_buffers"] > ring_buffers
+
+
+@pytest.mark.parametrize(
+    "model",
+    [
+        "iaf_psc_exp",
+        "iaf_cond_alpha",
+        "glif_psc",
+        "ignore_and_fire",
+        "lin_rate_ipn",
+        "parrot_neuron_ps",
+        "spike_dilutor",
+        "volume_transmitter",
+    ],
+)
+def test_ring_buffers_of_model(model):
+    """
+    Verify that ring buffer memory is reported for the nodes of models with ring buffers.
+
+    Some buffers are only sized when the network is calibrated, so the test simulates briefly.
+    """
+
+    nest.Create(model, 5)
+    nest.Simulate(1.0)
+    assert nest.GetMemoryReport()["ring_buffers"] > 0
+
+
+def test_no_ring_buffers_without_buffered_nodes():
+    """
+    Verify that nodes without ring buffers do not add to the ring buffer memory.
+    """
+
+    nest.Create("spike_recorder")
+    nest.Create("poisson_generator")
+    assert nest.GetMemoryReport()["ring_buffers"] == 0
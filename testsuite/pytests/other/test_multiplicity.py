@@ -54,3 +54,35 @@ def test_multiplicity():
     # only on the rank responsible for the neuron recorded by the recorder.
     assert not p_source.local or np.array_equal(sr_source.events["times"], [2, 2])
     assert not p_target.local or np.array_equal(sr_target.events["times"], [3, 3])
+
+
+@pytest.mark.skipif_missing_threads
+@pytest.mark.parametrize("multiplicity", [1, 3, 4, 5, 11])
+@pytest.mark.parametrize("synapse_model", ["static_synapse", "stdp_synapse"])
+@pytest.mark.parametrize("compressed_spikes", [True, False])
+def test_multiplicity_transmitted_between_neurons(multiplicity, synapse_model, compressed_spikes):
+    """
+    Confirm that spikes with large multiplicity arrive complete for all synapse types.
+
+    Spikes exchanged between neurons carry their multiplicity, with large multiplicities
+    split over several entries of the spike exchange buffer. Synapse types that only handle
+    individual spikes receive the spike unrolled into several events.
+    """
+
+    import nest
+
+    nest.ResetKernel()
+    nest.total_num_virtual_procs = 2
+    nest.use_compressed_spikes = compressed_spikes
+
+    sg = nest.Create("spike_generator", params={"spike_times": [1.0], "spike_multiplicities": [multiplicity]})
+    p_source, p_target = nest.Create("parrot_neuron", 2)
+    sr_target = nest.Create("spike_recorder")
+
+    nest.Connect(sg, p_source)
+    nest.Connect(p_source, p_target, syn_spec={"synapse_model": synapse_model})
+    nest.Connect(p_target, sr_target)
+
+    nest.Simulate(10)
+
+    assert not p_target.local or np.array_equal(sr_target.events["times"], [3] * multiplicity)
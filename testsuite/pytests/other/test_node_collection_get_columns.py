@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+#
+# test_node_collection_get_columns.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test reading node properties as arrays with ``NodeCollection.get_columns``.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+if nest.build_info["have_threads"]:
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+@pytest.fixture(params=THREAD_NUMBERS)
+def nodes(request):
+    nest.ResetKernel()
+    nest.local_num_threads = request.param
+    nest.rng_seed = 2345
+
+    nrns = nest.Create("iaf_psc_alpha", 10) + nest.Create("iaf_psc_exp", 7)
+    nrns.V_m = nest.random.uniform(-70.0, -60.0)
+    nrns.I_e = 400.0
+    return nrns
+
+
+@pytest.mark.parametrize("key", ["V_m", "C_m", "global_id", "vp", "thread", "thread_local_id", "model_id"])
+def test_get_columns_matches_get(nodes, key):
+    """
+    Ensure that a column contains the same values as obtained via ``get``.
+    """
+
+    column = nodes.get_columns(key)
+
+    assert isinstance(column, np.ndarray)
+    assert len(column) == len(nodes)
+    nptest.assert_array_equal(column, nodes.get(key))
+
+
+def test_get_columns_after_run(nodes):
+    """
+    Ensure that state variables are read correctly between calls to ``Run``.
+    """
+
+    with nest.RunManager():
+        for _ in range(3):
+            nest.Run(5.0)
+            nptest.assert_array_equal(nodes.get_columns("V_m"), nodes.get("V_m"))
+
+
+def test_get_columns_multiple_keys_and_types(nodes):
+    """
+    Ensure that lists of keys give dictionaries of arrays with matching types.
+    """
+
+    columns = nodes.get_columns(["global_id", "V_m"])
+
+    assert set(columns.keys()) == {"global_id", "V_m"}
+    assert np.issubdtype(columns["global_id"].dtype, np.integer)
+    assert np.issubdtype(columns["V_m"].dtype, np.floating)
+    nptest.assert_array_equal(columns["global_id"], nodes.tolist())
+
+
+def test_get_columns_mixed_readers(nodes):
+    """
+    Ensure that recordables and parameters can be read together, also for models with different recordables.
+    """
+
+    nodes = nodes + nest.Create("iaf_psc_delta", 3)
+    columns = nodes.get_columns(["V_m", "C_m", "global_id"])
+
+    for key, column in columns.items():
+        nptest.assert_array_equal(column, nodes.get(key))
+
+
+def test_get_columns_errors(nodes):
+    """
+    Ensure that unknown and non-numeric properties are rejected.
+    """
+
+    with pytest.raises(nest.NESTErrors.KeyError):
+        nodes.get_columns("no_such_property")
+
+    with pytest.raises(nest.NESTErrors.TypeMismatch):
+        nodes.get_columns("model")
+
+
+def test_get_columns_rejects_recordables_not_in_status():
+    """
+    Ensure that only properties available via ``get`` can be read, not every recordable.
+    """
+
+    nest.ResetKernel()
+    nrns = nest.Create("iaf_psc_exp", 3)
+
+    assert "I_syn_ex" in nrns[0].recordables
+    with pytest.raises(KeyError):
+        nrns.get("I_syn_ex")
+    with pytest.raises(nest.NESTErrors.KeyError):
+        nrns.get_columns("I_syn_ex")
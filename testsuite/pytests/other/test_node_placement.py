@@ -0,0 +1,113 @@
+# -*- coding: utf-8 -*-
+#
+# test_node_placement.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test placement of neurons on virtual processes with the round-robin and block policies.
+
+This test should be run for 1, 2, and 3 MPI processes.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+pytestmark = pytest.mark.skipif_missing_threads
+
+
+def _expected_block_vps(num_nodes, num_vps):
+    """Return VPs of nodes placed as contiguous blocks, consecutive blocks filling the threads of one rank."""
+
+    num_procs = nest.NumProcesses()
+    num_threads = num_vps // num_procs
+    block_sizes = [num_nodes // num_vps + (b < num_nodes % num_vps) for b in range(num_vps)]
+    block_vps = [(b % num_threads) * num_procs + b // num_threads for b in range(num_vps)]
+    return np.repeat(block_vps, block_sizes)
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+    nest.total_num_virtual_procs = 6
+
+
+def test_default_is_round_robin():
+    assert nest.node_placement == "round_robin"
+
+
+def test_invalid_placement_raises():
+    with pytest.raises(nest.NESTErrors.BadProperty):
+        nest.node_placement = "no_such_placement"
+
+
+@pytest.mark.parametrize("num_nodes", [3, 6, 17])
+def test_block_placement(num_nodes):
+    """Confirm VPs and locality of block-placed neurons, also when mixed with round-robin populations."""
+
+    first = nest.Create("parrot_neuron", 5)
+    nest.node_placement = "block"
+    blocked = nest.Create("parrot_neuron", num_nodes)
+    nest.node_placement = "round_robin"
+    last = nest.Create("parrot_neuron", 4)
+
+    assert np.array_equal(first.vp, np.array(first.global_id) % 6)
+    assert np.array_equal(blocked.vp, _expected_block_vps(num_nodes, 6))
+    assert np.array_equal(last.vp, np.array(last.global_id) % 6)
+
+    all_nodes = first + blocked + last
+    assert np.array_equal(all_nodes.local, np.array(all_nodes.vp) % nest.NumProcesses() == nest.Rank())
+
+
+def test_block_placement_does_not_place_devices():
+    """Devices exist on all threads irrespective of placement."""
+
+    nest.node_placement = "block"
+    nodes = nest.Create("parrot_neuron", 12)
+    sr = nest.Create("spike_recorder")
+
+    assert np.array_equal(nodes.vp, _expected_block_vps(12, 6))
+    assert sr.local
+
+
+def test_block_placement_connect_and_simulate():
+    """Confirm that a deterministic network gives the same results with block and round-robin placement."""
+
+    def simulate(placement):
+        nest.ResetKernel()
+        nest.total_num_virtual_procs = 6
+        nest.node_placement = placement
+
+        neurons = nest.Create("iaf_psc_alpha", 20, params={"I_e": np.linspace(380.0, 480.0, 20)})
+        sr = nest.Create("spike_recorder")
+        nest.Connect(neurons, neurons, {"rule": "all_to_all", "allow_autapses": False}, {"weight": 20.0, "delay": 1.5})
+        nest.Connect(neurons, sr)
+
+        nest.Simulate(200.0)
+
+        assert nest.num_connections == 20 * 19 + 20  # recurrent and to the spike recorder
+        return sorted(zip(sr.events["senders"], sr.events["times"]))
+
+    round_robin = simulate("round_robin")
+    block = simulate("block")
+
+    if nest.NumProcesses() == 1:
+        # with several ranks, each rank only records its local neurons, which depend on placement
+        assert block == round_robin
+        assert len(block) > 0
@@ -0,0 +1,91 @@
+# -*- coding: utf-8 -*-
+#
+# test_overlap_spike_communication.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that overlapping spike communication does not change simulation results.
+"""
+
+import nest
+import numpy.testing as nptest
+import pytest
+
+
+def _simulate_network(overlap, off_grid, sim_times):
+    """
+    Simulate a small random network and return sorted (sender, time) pairs recorded locally.
+
+    The network is simulated in chunks given by ``sim_times`` so that the exchange
+    pending at the end of each chunk is also covered.
+    """
+
+    nest.ResetKernel()
+    nest.total_num_virtual_procs = 2
+    nest.overlap_spike_communication = overlap
+
+    model = "iaf_psc_exp_ps" if off_grid else "iaf_psc_exp"
+    neurons = nest.Create(model, 50, params={"I_e": 400.0})
+    noise = nest.Create("poisson_generator", params={"rate": 20000.0})
+    sr = nest.Create("spike_recorder")
+
+    nest.Connect(noise, neurons, syn_spec={"weight": 10.0})
+    nest.Connect(
+        neurons,
+        neurons,
+        {"rule": "fixed_indegree", "indegree": 10},
+        syn_spec={"weight": -20.0, "delay": 1.5},
+    )
+    nest.Connect(neurons, sr)
+
+    for t in sim_times:
+        nest.Simulate(t)
+
+    events = sr.events
+    return sorted(zip(events["senders"], events["times"]))
+
+
+@pytest.mark.skipif_missing_threads
+@pytest.mark.parametrize("off_grid", [False, True])
+@pytest.mark.parametrize("sim_times", [[100.0], [33.3, 25.0, 41.7]])
+def test_overlap_gives_identical_spikes(off_grid, sim_times):
+    """
+    Spike trains must be identical with and without overlapping spike communication.
+    """
+
+    reference = _simulate_network(False, off_grid, sim_times)
+    overlapped = _simulate_network(True, off_grid, sim_times)
+
+    assert len(reference) > 0
+    nptest.assert_array_equal(overlapped, reference)
+
+
+def test_overlap_spike_communication_default():
+    """
+    Overlapping spike communication is off by default and reset by ResetKernel.
+    """
+
+    nest.ResetKernel()
+    assert not nest.overlap_spike_communication
+
+    nest.overlap_spike_communication = True
+    assert nest.overlap_spike_communication
+
+    nest.ResetKernel()
+    assert not nest.overlap_spike_communication
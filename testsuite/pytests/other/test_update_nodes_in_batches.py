@@ -0,0 +1,175 @@
+# -*- coding: utf-8 -*-
+#
+# test_update_nodes_in_batches.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+
+"""
+Test that updating nodes in per-model batches does not change simulation results.
+
+With ``update_nodes_in_batches``, the nodes of each thread are updated in runs of
+consecutive nodes of the same model. Spike output must be identical to updating
+the nodes one by one, also for networks mixing models with and without support
+for batched updates and containing frozen nodes.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def simulate_network(num_threads, update_nodes_in_batches):
+    """Simulate a recurrent network of interleaved models and return its sorted spikes and frozen nodes."""
+
+    nest.set(
+        local_num_threads=num_threads,
+        rng_seed=1234,
+        update_nodes_in_batches=update_nodes_in_batches,
+    )
+
+    # Alternate between models updated in batches and models updated one by one.
+    neurons = (
+        nest.Create("iaf_psc_alpha", 20, params={"I_e": 300.0})
+        + nest.Create("izhikevich", 10, params={"I_e": 8.0})
+        + nest.Create("iaf_psc_exp", 20, params={"I_e": 300.0})
+        + nest.Create("aeif_cond_alpha", 10, params={"I_e": 500.0})
+        + nest.Create("mat2_psc_exp", 10)
+        + nest.Create("iaf_psc_delta", 20, params={"I_e": 300.0})
+        + nest.Create("iaf_psc_alpha", 10, params={"I_e": 300.0})
+    )
+    neurons.V_m = nest.random.uniform(-70.0, -55.0)
+    frozen = neurons[::7]
+    frozen.frozen = True
+
+    noise = nest.Create("poisson_generator", params={"rate": 10000.0})
+    srec = nest.Create("spike_recorder")
+
+    nest.Connect(noise, neurons, syn_spec={"weight": 20.0, "delay": 1.0})
+    nest.Connect(
+        neurons,
+        neurons,
+        {"rule": "fixed_indegree", "indegree": 10},
+        {"weight": nest.random.uniform(-20.0, 20.0), "delay": nest.random.uniform(1.0, 3.0)},
+    )
+    nest.Connect(neurons, srec)
+
+    nest.Simulate(200.0)
+
+    events = srec.events
+    order = np.lexsort((events["senders"], events["times"]))
+    return events["senders"][order], events["times"][order], frozen.tolist()
+
+
+@pytest.mark.parametrize(
+    "num_threads",
+    [
+        1,
+        pytest.param(2, marks=pytest.mark.skipif_missing_threads),
+        pytest.param(4, marks=pytest.mark.skipif_missing_threads),
+    ],
+)
+def test_spikes_independent_of_batched_update(num_threads):
+    """Ensure that spikes are identical with and without batched updates."""
+
+    senders_batched, times_batched, frozen_ids = simulate_network(num_threads, True)
+    nest.ResetKernel()
+    senders_single, times_single, _ = simulate_network(num_threads, False)
+
+    assert len(times_batched) > 0
+    assert not np.isin(senders_batched, frozen_ids).any()
+    np.testing.assert_array_equal(senders_batched, senders_single)
+    np.testing.assert_array_equal(times_batched, times_single)
+
+
+def simulate_batch_state_model(model, params, record_from, update_nodes_in_batches):
+    """Simulate neurons in several runs and return recorded and final membrane potentials."""
+
+    nest.set(rng_seed=1234, update_nodes_in_batches=update_nodes_in_batches)
+
+    neurons = nest.Create(model, 30, params={"I_e": 300.0, "t_ref": 2.5} | params)
+    neurons.V_m = nest.random.uniform(-70.0, -55.0)
+    noise = nest.Create("poisson_generator", params={"rate": 20000.0})
+    mm = nest.Create("multimeter", params={"record_from": record_from, "interval": 0.1})
+
+    nest.Connect(noise, neurons, syn_spec={"weight": nest.random.uniform(-30.0, 30.0)})
+    nest.Connect(mm, neurons[::3])
+
+    # Change state and parameters between runs, which batched updates must pick up.
+    with nest.RunManager():
+        nest.Run(50.0)
+        neurons[::2].V_m = -60.0
+        neurons[1::2].I_e = 200.0
+        nest.Run(50.0)
+
+    events = mm.events
+    return [events["senders"]] + [events[name] for name in record_from] + [neurons.V_m]
+
+
+@pytest.mark.parametrize(
+    "model, params, record_from",
+    [
+        ("iaf_psc_alpha", {}, ["V_m", "I_syn_ex", "I_syn_in"]),
+        ("iaf_psc_exp", {}, ["V_m", "I_syn_ex", "I_syn_in"]),
+        ("iaf_psc_exp", {"delta": 2.0, "rho": 0.05}, ["V_m", "I_syn_ex", "I_syn_in"]),
+        ("iaf_psc_delta", {}, ["V_m"]),
+        ("iaf_psc_delta", {"refractory_input": True}, ["V_m"]),
+        ("iaf_psc_delta", {"ignore_and_spike": True, "ignore_and_spike_interval": 3.0}, ["V_m"]),
+    ],
+)
+def test_state_independent_of_batched_update(model, params, record_from):
+    """Ensure that recorded and final states of models holding batches in arrays do not depend on batching."""
+
+    batched = simulate_batch_state_model(model, params, record_from, True)
+    nest.ResetKernel()
+    single = simulate_batch_state_model(model, params, record_from, False)
+
+    assert len(batched[0]) > 0
+    for batched_values, single_values in zip(batched, single):
+        np.testing.assert_array_equal(batched_values, single_values)
+
+
+def test_update_nodes_in_batches_default():
+    """Ensure that nodes are updated one by one by default and after a kernel reset."""
+
+    assert not nest.update_nodes_in_batches
+
+    nest.update_nodes_in_batches = True
+    assert nest.update_nodes_in_batches
+
+    nest.ResetKernel()
+    assert not nest.update_nodes_in_batches
+
+
+def test_simulate_without_nodes_after_reset():
+    """Ensure that batches of nodes destructed by a kernel reset are not updated."""
+
+    nest.update_nodes_in_batches = True
+    nest.Create("iaf_psc_alpha", 10)
+    nest.Simulate(10.0)
+
+    nest.ResetKernel()
+    nest.update_nodes_in_batches = True
+    nest.Simulate(10.0)
+
+    assert nest.biological_time == 10.0
@@ -107,3 +107,45 @@ def test_use_wfr_set_correctly_in_created_node(use_wfr):
     nest.Simulate(5.0)
 
     assert nrn_gap.node_uses_wfr == use_wfr
+
+
+@pytest.mark.skipif_missing_gsl
+def test_wfr_incremental_exchange_matches_full_exchange():
+    """Ensure that exchanging only changed secondary events gives the same result as full exchange."""
+
+    def simulate(incremental):
+        nest.ResetKernel()
+        nest.set(use_wfr=True, wfr_tol=1e-6, wfr_incremental_exchange=incremental)
+
+        neurons = nest.Create("hh_psc_alpha_gap", 2, params={"I_e": [400.0, 0.0]})
+        nest.Connect(
+            neurons,
+            neurons,
+            {"rule": "all_to_all", "allow_autapses": False},
+            {"synapse_model": "gap_junction", "weight": 10.0},
+        )
+        nest.Simulate(20.0)
+        return neurons.V_m
+
+    assert simulate(True) == simulate(False)
+
+
+def test_wfr_incremental_exchange_matches_full_exchange_rate_neurons():
+    """Ensure that exchanging only changed rates gives the same result as full exchange."""
+
+    def simulate(incremental):
+        nest.ResetKernel()
+        nest.set(use_wfr=True, wfr_tol=1e-6, wfr_incremental_exchange=incremental)
+
+        neurons = nest.Create("lin_rate_ipn", 3, params={"mu": 0.0, "sigma": 0.0, "tau": 2.0})
+        neurons[0].mu = 5.0
+        nest.Connect(
+            neurons,
+            neurons,
+            {"rule": "all_to_all", "allow_autapses": False},
+            {"synapse_model": "rate_connection_instantaneous", "weight": 0.3},
+        )
+        nest.Simulate(20.0)
+        return neurons.rate
+
+    assert simulate(True) == simulate(False)
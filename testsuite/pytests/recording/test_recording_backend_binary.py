@@ -0,0 +1,113 @@
+# -*- coding: utf-8 -*-
+#
+# test_recording_backend_binary.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Tests for the binary recording backend and its reader.
+
+Data written by the binary backend must match the data recorded by the
+memory backend, also if records are written across several blocks and
+several calls to ``Run`` between ``Prepare`` and ``Cleanup``.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+
+@pytest.fixture(autouse=True)
+def prepare_kernel(tmp_path):
+    nest.ResetKernel()
+    nest.set(data_path=str(tmp_path), overwrite_files=True)
+
+
+def record(model, params, num_threads=1, buffer_size=4096):
+    nest.set(local_num_threads=num_threads)
+    nest.SetDefaults("binary", {"buffer_size": buffer_size})
+
+    neurons = nest.Create("iaf_psc_alpha", 4, params={"I_e": 400.0})
+    noise = nest.Create("poisson_generator", params={"rate": 20000.0})
+    nest.Connect(noise, neurons, syn_spec={"weight": 10.0})
+
+    rec_binary = nest.Create(model, params={"record_to": "binary", **params})
+    rec_memory = nest.Create(model, params={"record_to": "memory", **params})
+    if model == "spike_recorder":
+        nest.Connect(neurons, rec_binary + rec_memory)
+    else:
+        nest.Connect(rec_binary + rec_memory, neurons)
+
+    # Each call to Simulate rewrites the file, so use several calls to Run to
+    # test writing across runs
+    nest.Prepare()
+    nest.Run(60.0)
+    nest.Run(40.0)
+    nest.Cleanup()
+
+    return nest.read_binary_recording(rec_binary.filenames), rec_memory.events
+
+
+def assert_same_records(binary, memory, keys):
+    order_binary = np.lexsort((binary["senders"], binary["times"]))
+    order_memory = np.lexsort((memory["senders"], memory["times"]))
+    for key in keys:
+        nptest.assert_array_equal(binary[key][order_binary], np.asarray(memory[key])[order_memory])
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+@pytest.mark.parametrize("buffer_size", [1, 17, 4096])
+def test_spike_recorder_matches_memory_backend(num_threads, buffer_size):
+    binary, memory = record("spike_recorder", {}, num_threads, buffer_size)
+
+    assert len(binary["senders"]) > 0
+    assert_same_records(binary, memory, ["senders", "times"])
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_multimeter_matches_memory_backend(num_threads):
+    params = {"interval": 0.5, "record_from": ["V_m", "I_syn_ex"]}
+    binary, memory = record("multimeter", params, num_threads, buffer_size=23)
+
+    assert len(binary["senders"]) == len(memory["senders"]) > 0
+    assert_same_records(binary, memory, ["senders", "times", "V_m", "I_syn_ex"])
+
+
+def test_precise_times():
+    nest.resolution = 0.1
+    sg = nest.Create("spike_generator", params={"spike_times": [1.23, 4.56], "precise_times": True})
+    sr = nest.Create("spike_recorder", params={"record_to": "binary"})
+    nest.Connect(sg, sr)
+    nest.Simulate(10.0)
+
+    data = nest.read_binary_recording(sr.filenames)
+    nptest.assert_allclose(data["times"], [1.23, 4.56])
+    nptest.assert_array_equal(data["time_steps"], [13, 46])
+
+
+def test_buffer_size_must_be_positive():
+    with pytest.raises(nest.NESTError):
+        nest.SetDefaults("binary", {"buffer_size": 0})
+
+
+def test_filenames_and_label():
+    sr = nest.Create("spike_recorder", params={"record_to": "binary", "label": "my_spikes"})
+    assert len(sr.filenames) == 1
+    assert "my_spikes" in sr.filenames[0]
+    assert sr.filenames[0].endswith(".bin")
@@ -121,6 +121,38 @@ class TestRecordingBackendMemory(unittest.TestCase):
         with self.assertRaises(nest.NESTError):
             mm.time_in_steps = False
 
+    def testDrainEvents(self):
+        """Test that drained events match the events dict and are removed from the backend."""
+
+        nest.ResetKernel()
+        nest.local_num_threads = 2
+
+        mm = nest.Create("multimeter", params={"record_to": "memory"})
+        mm.set({"interval": 0.1, "record_from": ["V_m"]})
+        nest.Connect(mm, nest.Create("iaf_psc_alpha", 2))
+
+        nest.Simulate(15)
+        expected = mm.events
+
+        drained = mm.drain_events()
+        self.assertEqual(len(drained), 2)
+        self.assertEqual(mm.n_events, 0)
+        self.assertEqual(len(mm.events["times"]), 0)
+
+        for key in ["senders", "times", "V_m"]:
+            for thread_events in drained:
+                self.assertFalse(thread_events[key].flags.writeable)
+            values = np.concatenate([thread_events[key] for thread_events in drained])
+            np.testing.assert_array_equal(values, expected[key])
+
+        # Recording continues into fresh buffers after draining
+        nest.Simulate(1)
+        self.assertEqual(mm.n_events, 20)
+        self.assertEqual(sum(len(thread_events["times"]) for thread_events in mm.drain_events()), 20)
+
+        # Arrays drained before remain valid
+        self.assertEqual(sum(len(thread_events["times"]) for thread_events in drained), 280)
+
 
 def suite():
     suite = unittest.TestLoader()
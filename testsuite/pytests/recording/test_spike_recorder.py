@@ -56,3 +56,27 @@ def test_spike_recorder_different_resolutions(resolution):
 
     actual_spikes, expected_spikes = simulator(resolution)
     nptest.assert_almost_equal(actual_spikes, expected_spikes)
+
+
+@pytest.mark.parametrize("record_to", ["memory", "ascii", "binary"])
+def test_spike_recorder_records_spikes_from_last_step(record_to, tmp_path):
+    """
+    Test that spikes delivered in the last step of a run are recorded before the run ends.
+
+    The spike recorder hands received spikes to the backend in batches, so
+    spikes from devices, which are delivered immediately, must not be left
+    behind at the end of ``Simulate``.
+    """
+
+    nest.ResetKernel()
+    nest.set(data_path=str(tmp_path), overwrite_files=True)
+
+    sgen = nest.Create("spike_generator", params={"spike_times": [1.0, 5.0, 10.0, 15.0]})
+    srec = nest.Create("spike_recorder", params={"record_to": record_to})
+    nest.Connect(sgen, srec)
+
+    nest.Simulate(10.0)
+    assert srec.n_events == 3
+
+    nest.Simulate(5.0)
+    assert srec.n_events == 4
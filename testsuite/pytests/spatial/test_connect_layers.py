@@ -316,6 +316,51 @@ class ConnectLayersTestCase(unittest.TestCase):
         }
         self._check_connections_statistical_bernoulli(conn_spec, p, 108)
 
+    def test_connect_layers_bernoulli_deterministic_kernel(self):
+        """Connecting layers with pairwise_bernoulli and a kernel that is zero or one"""
+        layer = nest.Create(
+            "iaf_psc_alpha", positions=nest.spatial.grid(self.dim, extent=self.extent, edge_wrap=True)
+        )
+        max_dist = 3.0
+        p = nest.logic.conditional(2.0 * nest.spatial.distance < 2.0 * max_dist, 1.0, 0.0)
+        nest.Connect(layer, layer, {"rule": "pairwise_bernoulli", "p": p, "allow_autapses": False})
+
+        expected = set()
+        for i, src in enumerate(layer):
+            for j, tgt in enumerate(layer):
+                if i != j and nest.Distance(src, tgt)[0] < max_dist:
+                    expected.add((src.global_id, tgt.global_id))
+
+        conns = nest.GetConnections()
+        self.assertEqual(set(zip(conns.source, conns.target)), expected)
+
+    def test_connect_layers_bernoulli_batched_kernel_as_per_pair(self):
+        """Connecting layers with pairwise_bernoulli and a distance kernel evaluated in batches or per pair"""
+
+        def connect(make_random):
+            nest.ResetKernel()
+            nest.rng_seed = 123
+            positions = nest.spatial.free(nest.random.uniform(-0.5, 0.5), num_dimensions=2, edge_wrap=True)
+            layer = nest.Create("iaf_psc_alpha", 50, positions=positions)
+            p = nest.spatial_distributions.gaussian(nest.spatial.distance, std=0.25)
+            if make_random:
+                # A kernel that may draw random numbers is evaluated per node pair. The random branch
+                # is never taken, so the random numbers drawn for the connections remain the same.
+                p = nest.logic.conditional(nest.spatial.distance >= 0.0, p, nest.random.uniform())
+            nest.Connect(
+                layer,
+                layer,
+                {"rule": "pairwise_bernoulli", "p": p},
+                {"weight": nest.random.normal(mean=1.0, std=0.1)},
+            )
+            conns = nest.GetConnections()
+            return sorted(zip(conns.source, conns.target, conns.weight))
+
+        batched = connect(make_random=False)
+        per_pair = connect(make_random=True)
+        self.assertGreater(len(batched), 0)
+        self.assertEqual(batched, per_pair)
+
     def test_connect_nonlayers_mask_bernoulli(self):
         """Throw when connecting non-layer NodeCollections with mask."""
         neurons = nest.Create("iaf_psc_alpha", 20)
@@ -0,0 +1,150 @@
+# -*- coding: utf-8 -*-
+#
+# test_kernel_cutoff.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+
+"""
+Tests for the ``kernel_cutoff`` and ``skip_sampling`` options of spatial ``pairwise_bernoulli`` connections.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def connect_and_get_pairs(layer, conn_spec):
+    nest.Connect(layer, layer, conn_spec)
+    conns = nest.GetConnections()
+    return set(zip(conns.source, conns.target))
+
+
+@pytest.mark.parametrize("use_on_source", [False, True])
+@pytest.mark.parametrize("edge_wrap", [False, True])
+def test_kernel_cutoff_with_threshold_kernel_gives_same_connections(use_on_source, edge_wrap):
+    """Ensure that a cutoff derived from an explicit distance threshold does not change deterministic connectivity."""
+
+    pos = nest.spatial.free(nest.random.uniform(-0.5, 0.5), edge_wrap=edge_wrap, extent=[1.0, 1.0])
+    kernel = nest.logic.conditional(nest.spatial.distance < 0.2, 1.0, 0.0)
+
+    layer = nest.Create("iaf_psc_alpha", 200, positions=pos)
+    expected = connect_and_get_pairs(layer, {"rule": "pairwise_bernoulli", "p": kernel, "use_on_source": use_on_source})
+
+    nest.ResetKernel()
+    layer = nest.Create("iaf_psc_alpha", 200, positions=pos)
+    actual = connect_and_get_pairs(
+        layer, {"rule": "pairwise_bernoulli", "p": kernel, "use_on_source": use_on_source, "kernel_cutoff": 0.0}
+    )
+
+    assert len(expected) > 0
+    assert actual == expected
+
+
+@pytest.mark.parametrize(
+    "kernel, max_distance",
+    [
+        (nest.spatial_distributions.gaussian(nest.spatial.distance, std=0.05), 0.05 * np.sqrt(-2 * np.log(1e-3))),
+        (nest.spatial_distributions.exponential(nest.spatial.distance, beta=0.05), -0.05 * np.log(1e-3)),
+        (0.5 * nest.spatial_distributions.exponential(nest.spatial.distance, beta=0.05), -0.05 * np.log(2e-3)),
+    ],
+)
+def test_kernel_cutoff_restricts_distance(kernel, max_distance):
+    """Ensure that connections are only created within the distance derived from the kernel."""
+
+    layer = nest.Create("iaf_psc_alpha", positions=nest.spatial.grid(shape=[30, 30], extent=[1.0, 1.0]))
+    nest.Connect(layer, layer, {"rule": "pairwise_bernoulli", "p": kernel, "kernel_cutoff": 1e-3})
+    conns = nest.GetConnections()
+
+    assert len(conns) > 0
+
+    positions = np.array(nest.GetPosition(layer))
+    first_id = layer[0].global_id
+    displacements = positions[np.array(conns.source) - first_id] - positions[np.array(conns.target) - first_id]
+    assert np.max(np.linalg.norm(displacements, axis=1)) <= max_distance + 1e-12
+
+
+@pytest.mark.parametrize(
+    "p, allow_autapses, expected",
+    [(0.0, True, 0), (1.0, True, 400), (1.0, False, 380), (1.5, True, 400), (1.5, False, 380)],
+)
+def test_skip_sampling_extreme_probabilities(p, allow_autapses, expected):
+    """Ensure that skip sampling creates no connections for probability zero and all for probabilities from one."""
+
+    layer = nest.Create("iaf_psc_alpha", positions=nest.spatial.grid(shape=[4, 5]))
+    nest.Connect(
+        layer,
+        layer,
+        {"rule": "pairwise_bernoulli", "p": p, "skip_sampling": True, "allow_autapses": allow_autapses},
+    )
+
+    assert nest.num_connections == expected
+
+
+@pytest.mark.parametrize("skip_sampling", [False, True])
+def test_kernel_cutoff_ignored_for_constant_kernel(skip_sampling):
+    """Ensure that a constant kernel not exceeding the cutoff still connects sources at any distance."""
+
+    layer = nest.Create("iaf_psc_alpha", positions=nest.spatial.grid(shape=[4, 5]))
+    nest.Connect(
+        layer,
+        layer,
+        {"rule": "pairwise_bernoulli", "p": 1.0, "kernel_cutoff": 1.0, "skip_sampling": skip_sampling},
+    )
+
+    assert nest.num_connections == 400
+
+
+@pytest.mark.parametrize("use_on_source", [False, True])
+def test_skip_sampling_number_of_connections(use_on_source):
+    """Ensure that skip sampling yields the expected number of connections."""
+
+    p = 0.1
+    n = 400
+    layer = nest.Create("iaf_psc_alpha", positions=nest.spatial.grid(shape=[20, 20]))
+    nest.Connect(
+        layer, layer, {"rule": "pairwise_bernoulli", "p": p, "skip_sampling": True, "use_on_source": use_on_source}
+    )
+
+    mean = p * n * n
+    std = np.sqrt(n * n * p * (1 - p))
+    assert abs(nest.num_connections - mean) < 5 * std
+
+
+@pytest.mark.parametrize("option", [{"kernel_cutoff": 0.0}, {"skip_sampling": True}])
+def test_options_raise_for_other_rules(option):
+    """Ensure that the options are rejected for rules other than pairwise_bernoulli."""
+
+    layer = nest.Create("iaf_psc_alpha", positions=nest.spatial.grid(shape=[4, 4]))
+    with pytest.raises(nest.NESTErrors.BadProperty):
+        nest.Connect(
+            layer, layer, {"rule": "fixed_indegree", "indegree": 2, "mask": {"circular": {"radius": 0.5}}, **option}
+        )
+
+
+def test_negative_kernel_cutoff_raises():
+    """Ensure that a negative cutoff is rejected."""
+
+    layer = nest.Create("iaf_psc_alpha", positions=nest.spatial.grid(shape=[4, 4]))
+    with pytest.raises(nest.NESTErrors.BadProperty):
+        nest.Connect(layer, layer, {"rule": "pairwise_bernoulli", "p": 0.5, "kernel_cutoff": -1.0})
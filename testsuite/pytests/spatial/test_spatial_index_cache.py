@@ -0,0 +1,99 @@
+# -*- coding: utf-8 -*-
+#
+# test_spatial_index_cache.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+
+"""
+Tests for the cache of global positions used when connecting spatial layers.
+"""
+
+import nest
+import pytest
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+@pytest.fixture
+def layers():
+    pos = nest.spatial.free(nest.random.uniform(-0.5, 0.5), num_dimensions=2)
+    return [nest.Create("iaf_psc_alpha", 50, positions=pos) for _ in range(4)]
+
+
+def connect_masked(pre, post):
+    nest.Connect(pre, post, {"rule": "pairwise_bernoulli", "p": 0.5, "mask": {"circular": {"radius": 0.2}}})
+
+
+def test_cache_keeps_several_layers(layers):
+    """Ensure that positions of several layers are kept, so that alternating between pools does not collect again."""
+
+    a, b, c, d = layers
+    connect_masked(a, b)
+    connect_masked(c, b)
+    misses = nest.spatial_index_cache_misses
+    hits = nest.spatial_index_cache_hits
+
+    connect_masked(a, d)
+    connect_masked(c, d)
+
+    assert nest.spatial_index_cache_misses == misses
+    assert nest.spatial_index_cache_hits == hits + 2
+    assert nest.spatial_index_cache_memory > 0
+
+
+def test_cache_respects_budget(layers):
+    """Ensure that with zero budget only the most recently used positions are kept."""
+
+    nest.spatial_index_cache_budget = 0.0
+    a, b, c, d = layers
+    connect_masked(a, b)
+    connect_masked(c, b)
+    misses = nest.spatial_index_cache_misses
+
+    connect_masked(c, d)
+    assert nest.spatial_index_cache_misses == misses
+
+    connect_masked(a, d)
+    assert nest.spatial_index_cache_misses == misses + 1
+
+
+def test_cache_distinguishes_slices(layers):
+    """Ensure that sliced layers do not reuse the positions of the full layer."""
+
+    a, b, _, _ = layers
+    nest.Connect(a, b, {"rule": "pairwise_bernoulli", "p": 1.0, "mask": {"circular": {"radius": 2.0}}})
+    nest.Connect(a[:10], b, {"rule": "pairwise_bernoulli", "p": 1.0, "mask": {"circular": {"radius": 2.0}}})
+
+    assert nest.num_connections == 50 * 50 + 10 * 50
+
+
+def test_reset_clears_cache(layers):
+    """Ensure that ResetKernel clears the cache and its statistics."""
+
+    a, b, _, _ = layers
+    connect_masked(a, b)
+    nest.ResetKernel()
+
+    assert nest.spatial_index_cache_hits == 0
+    assert nest.spatial_index_cache_misses == 0
+    assert nest.spatial_index_cache_memory == 0
+    assert nest.spatial_index_cache_budget == 1024.0
@@ -0,0 +1,201 @@
+# -*- coding: utf-8 -*-
+#
+# test_spike_train_file.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that ``spike_generator`` and ``spike_train_injector`` replay spike trains read from a spike train file
+exactly as the same spike trains given as ``spike_times``.
+"""
+
+import nest
+import numpy as np
+import numpy.testing as nptest
+import pytest
+
+SPIKE_TIMES = {
+    1: [1.0, 2.5, 2.5, 7.3],
+    2: [0.4, 5.0],
+    3: [],
+    4: [3.2, 3.3, 9.9],
+}
+
+
+@pytest.fixture
+def spike_file(tmp_path):
+    """Write the spike trains of SPIKE_TIMES in shuffled order to a spike train file."""
+
+    senders = np.concatenate([np.full(len(times), sender) for sender, times in SPIKE_TIMES.items()])
+    times = np.concatenate([times for times in SPIKE_TIMES.values()])
+    order = np.random.default_rng(1234).permutation(len(senders))
+
+    filename = str(tmp_path / "spikes.bin")
+    nest.write_spike_train_file(filename, senders[order], times[order])
+    return filename
+
+
+@pytest.fixture(autouse=True)
+def prepare_kernel():
+    nest.ResetKernel()
+    nest.local_num_threads = 2
+    nest.resolution = 0.1
+
+
+def record_spikes(model, params_list):
+    """Simulate one device per parameter dictionary and return its spikes as sorted (sender index, time) pairs."""
+
+    devices = nest.Create(model, len(params_list))
+    for device, params in zip(devices, params_list):
+        device.set(params)
+
+    srec = nest.Create("spike_recorder")
+    nest.Connect(devices, srec)
+    nest.Simulate(12.0)
+
+    events = srec.events
+    senders = np.array(events["senders"]) - devices[0].global_id
+    return sorted(zip(senders, events["times"]))
+
+
+@pytest.mark.parametrize("model", ["spike_generator", "spike_train_injector"])
+@pytest.mark.parametrize("precise_times", [False, True])
+def test_file_replays_spike_times(tmp_path, model, precise_times):
+    """Ensure that spike trains read from the file are emitted like the same spike times set directly."""
+
+    # precise spike times need not lie on the grid
+    shift = 0.05 if precise_times else 0.0
+    spike_times = {sender: [t + shift for t in times] for sender, times in SPIKE_TIMES.items()}
+
+    expected = record_spikes(
+        model, [{"precise_times": precise_times, "spike_times": times} for times in spike_times.values()]
+    )
+
+    nest.ResetKernel()
+    nest.local_num_threads = 2
+    nest.resolution = 0.1
+
+    filename = str(tmp_path / "spikes.bin")
+    senders = np.concatenate([np.full(len(times), sender) for sender, times in spike_times.items()])
+    nest.write_spike_train_file(filename, senders, np.concatenate(list(spike_times.values())))
+
+    actual = record_spikes(
+        model,
+        [
+            {"precise_times": precise_times, "spike_train_file": filename, "spike_train_sender": sender}
+            for sender in spike_times
+        ],
+    )
+
+    assert len(actual) == sum(len(times) for times in SPIKE_TIMES.values())
+    nptest.assert_array_equal(actual, expected)
+
+
+def test_default_sender_is_own_node_id(spike_file):
+    """Ensure that a generator reads the spike train of its own node ID if no sender is given."""
+
+    sg = nest.Create("spike_generator", 4, params={"spike_train_file": spike_file})
+    srec = nest.Create("spike_recorder")
+    nest.Connect(sg, srec)
+    nest.Simulate(12.0)
+
+    for sender, times in SPIKE_TIMES.items():
+        nptest.assert_array_almost_equal(np.sort(srec.events["times"][srec.events["senders"] == sender]), times)
+
+
+def test_status_reports_file_and_sender(spike_file):
+    sg = nest.Create("spike_generator", params={"spike_train_file": spike_file, "spike_train_sender": 2})
+
+    assert sg.spike_train_file == spike_file
+    assert sg.spike_train_sender == 2
+    assert len(sg.spike_times) == 0
+
+    sg.spike_train_file = ""
+    assert sg.spike_train_file == ""
+
+
+def test_spike_times_and_file_are_exclusive(spike_file):
+    sg = nest.Create("spike_generator", params={"spike_times": [1.0]})
+
+    with pytest.raises(nest.NESTError, match="cannot be used together with spike_train_file"):
+        sg.spike_train_file = spike_file
+
+
+def test_invalid_file_raises(tmp_path):
+    filename = str(tmp_path / "not_spikes.bin")
+    with open(filename, "wb") as f:
+        f.write(b"NESTBIN\0" + bytes(24))
+
+    sg = nest.Create("spike_generator")
+    with pytest.raises(nest.NESTError, match="is not a spike train file"):
+        sg.spike_train_file = filename
+
+
+def test_offgrid_time_in_file_raises_on_simulate(tmp_path):
+    filename = str(tmp_path / "spikes.bin")
+    nest.write_spike_train_file(filename, [1, 1], [1.0, 1.05])
+
+    nest.Create("spike_generator", params={"spike_train_file": filename})
+    with pytest.raises(nest.NESTError, match="not representable in current resolution"):
+        nest.Simulate(2.0)
+
+
+def test_rewriting_file_keeps_devices_using_it_intact(spike_file):
+    """Ensure that rewriting a file in use does not affect devices reading it, while new devices see the new spikes."""
+
+    old_sg = nest.Create("spike_generator", params={"spike_train_file": spike_file, "spike_train_sender": 1})
+    nest.write_spike_train_file(spike_file, [1], [4.0])
+    new_sg = nest.Create("spike_generator", params={"spike_train_file": spike_file, "spike_train_sender": 1})
+
+    srec = nest.Create("spike_recorder")
+    nest.Connect(old_sg + new_sg, srec)
+    nest.Simulate(12.0)
+
+    events = srec.events
+    nptest.assert_array_almost_equal(np.sort(events["times"][events["senders"] == old_sg.global_id]), SPIKE_TIMES[1])
+    nptest.assert_array_almost_equal(events["times"][events["senders"] == new_sg.global_id], [4.0])
+
+
+def test_number_of_spikes_larger_than_file_raises(tmp_path):
+    filename = str(tmp_path / "spikes.bin")
+    nest.write_spike_train_file(filename, [1], [1.0])
+
+    # overwrite the number of spikes in the header with a value for which the expected file size overflows
+    with open(filename, "r+b") as f:
+        f.seek(16)
+        f.write((2**60 + 1).to_bytes(8, "little" if np.little_endian else "big"))
+
+    sg = nest.Create("spike_generator")
+    with pytest.raises(nest.NESTError, match="does not match its number of spikes"):
+        sg.spike_train_file = filename
+
+
+@pytest.mark.parametrize("senders, times", [([2, 1], [1.0, 2.0]), ([1, 1], [2.0, 1.0])])
+def test_unsorted_records_raise(tmp_path, senders, times):
+    filename = str(tmp_path / "spikes.bin")
+    nest.write_spike_train_file(filename, [1, 1], [1.0, 2.0])
+
+    # overwrite the records, which write_spike_train_file() would have sorted
+    records = np.array(list(zip(senders, times)), dtype=[("sender", np.uint64), ("time", np.float64)])
+    with open(filename, "r+b") as f:
+        f.seek(24)
+        f.write(records.tobytes())
+
+    sg = nest.Create("spike_generator")
+    with pytest.raises(nest.NESTError, match="must be sorted by sender and time"):
+        sg.spike_train_file = filename
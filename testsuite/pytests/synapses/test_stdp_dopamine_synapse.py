@@ -0,0 +1,135 @@
+# -*- coding: utf-8 -*-
+#
+# test_stdp_dopamine_synapse.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test weight updates of ``stdp_dopamine_synapse`` triggered by a volume transmitter.
+
+The volume transmitter updates all connections of a synapse model in one
+batch. Labeled and unlabeled connections are stored in different
+connectors and must evolve identically. Without pre- and postsynaptic
+spikes, the weights follow from the dopamine spikes in closed form.
+"""
+
+import math
+
+import nest
+import numpy.testing as nptest
+import pytest
+
+
+def simulate_weights(synapse_model, num_threads):
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads, rng_seed=1234)
+
+    pre = nest.Create("parrot_neuron", 20)
+    post = nest.Create("iaf_psc_alpha", 10, params={"I_e": 370.0})
+    dopa = nest.Create("parrot_neuron", 5)
+    vt = nest.Create("volume_transmitter", params={"deliver_interval": 3})
+
+    pre_noise = nest.Create("poisson_generator", params={"rate": 20.0})
+    dopa_noise = nest.Create("poisson_generator", params={"rate": 50.0})
+    nest.Connect(pre_noise, pre)
+    nest.Connect(dopa_noise, dopa)
+    nest.Connect(dopa, vt)
+
+    nest.SetDefaults(
+        synapse_model, {"volume_transmitter": vt, "A_plus": 0.1, "A_minus": 0.15, "b": 0.01, "Wmax": 100.0}
+    )
+    nest.Connect(pre, post, syn_spec={"synapse_model": synapse_model, "weight": 50.0, "delay": 1.0})
+
+    nest.Simulate(500.0)
+
+    conns = nest.GetConnections(synapse_model=synapse_model)
+    weights = sorted(zip(conns.source, conns.target, conns.weight))
+    return [w for _, _, w in weights]
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+def test_labeled_and_unlabeled_weights_agree(num_threads):
+    weights = simulate_weights("stdp_dopamine_synapse", num_threads)
+    weights_lbl = simulate_weights("stdp_dopamine_synapse_lbl", num_threads)
+
+    assert any(w != 50.0 for w in weights)
+    nptest.assert_array_equal(weights, weights_lbl)
+
+
+
+def expected_weight(w, c, n, dopa_spikes, t_end, cp):
+    """
+    Integrate dw/dt = c * (n - b) with freely decaying eligibility trace c.
+
+    Dopamine spikes are given as (time, multiplicity) and increase the
+    dopamine trace n by multiplicity / tau_n.
+    """
+
+    tau_s = cp["tau_c"] * cp["tau_n"] / (cp["tau_c"] + cp["tau_n"])
+    t = 0.0
+    for t_next, multiplicity in dopa_spikes + [(t_end, 0)]:
+        dt = t_next - t
+        w += c * n * tau_s * -math.expm1(-dt / tau_s) - cp["b"] * c * cp["tau_c"] * -math.expm1(-dt / cp["tau_c"])
+        c *= math.exp(-dt / cp["tau_c"])
+        n = n * math.exp(-dt / cp["tau_n"]) + multiplicity / cp["tau_n"]
+        t = t_next
+    return w
+
+
+@pytest.mark.parametrize("num_threads", [1, pytest.param(2, marks=pytest.mark.skipif_missing_threads)])
+def test_weights_follow_dopamine_spikes(num_threads):
+    """
+    Test batched weight updates over several dopamine spikes and deliver intervals against the closed form.
+    """
+
+    nest.ResetKernel()
+    nest.set(local_num_threads=num_threads)
+
+    cp = {"tau_c": 50.0, "tau_n": 20.0, "b": 0.01, "Wmin": -1000.0, "Wmax": 1000.0}
+    spike_times = [2.0, 4.5, 4.5, 11.3, 17.0, 25.2]
+    delay = 1.0
+    t_end = 30.0
+
+    # dopamine spikes reach the volume transmitter after passing a parrot neuron
+    sg = nest.Create("spike_generator", params={"spike_times": spike_times, "allow_offgrid_times": False})
+    dopa = nest.Create("parrot_neuron")
+    vt = nest.Create("volume_transmitter", params={"deliver_interval": 3})
+    nest.Connect(sg, dopa, syn_spec={"delay": delay})
+    nest.Connect(dopa, vt, syn_spec={"delay": delay})
+
+    # connections without pre- or postsynaptic spikes
+    pre = nest.Create("parrot_neuron", 4)
+    post = nest.Create("parrot_neuron", 3)
+    nest.SetDefaults("stdp_dopamine_synapse", dict(cp, volume_transmitter=vt))
+    nest.Connect(pre, post, syn_spec={"synapse_model": "stdp_dopamine_synapse", "delay": delay})
+
+    conns = nest.GetConnections(synapse_model="stdp_dopamine_synapse")
+    initial = [(10.0 + k, 0.3 * (k + 1) * (-1) ** k, 0.1 * (k % 3)) for k in range(len(conns))]
+    conns.set(weight=[w for w, _, _ in initial], c=[c for _, c, _ in initial], n=[n for _, _, n in initial])
+
+    nest.Simulate(t_end)
+
+    arrivals = {}
+    for t in spike_times:
+        arrivals[t + 2 * delay] = arrivals.get(t + 2 * delay, 0) + 1
+    dopa_spikes = sorted(arrivals.items())
+    assert len(dopa_spikes) == 5
+
+    expected = [expected_weight(w, c, n, dopa_spikes, t_end, cp) for w, c, n in initial]
+    assert all(abs(e - w) > 1e-3 for e, (w, _, _) in zip(expected, initial))
+    nptest.assert_allclose(conns.weight, expected, rtol=1e-12)